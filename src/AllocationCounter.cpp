@@ -0,0 +1,195 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "AllocationCounter.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+#if defined(_MSC_VER)
+#define ALLOCATION_NOINLINE __declspec(noinline)
+#else
+#define ALLOCATION_NOINLINE __attribute__((noinline))
+#endif
+
+// In a translation unit of their own, so the compiler never sees malloc and
+// free paired with a new expression and warns about a mismatch
+static std::atomic<uint64_t> allocations{ 0 };
+static thread_local uint64_t threadAllocations = 0;
+
+uint64_t allocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+uint64_t threadAllocationCount() {
+    return threadAllocations;
+}
+
+#if !defined(NDEBUG)
+
+namespace {
+
+// Sites in an open addressing table keyed by a hash of their frames. It never
+// grows (that would allocate); sites that don't fit are only counted in total.
+constexpr size_t SITE_SLOTS = 4096;
+constexpr size_t SITE_PROBES = 64;
+
+struct SiteSlot {
+    std::atomic<uint64_t> key{ 0 };
+    std::atomic<void*> frames[ALLOCATION_SITE_FRAMES] = {};
+    std::atomic<uint64_t> count{ 0 };
+};
+
+SiteSlot siteSlots[SITE_SLOTS];
+thread_local bool recordingSite = false;
+
+// Frames of recordSite(), allocate() and operator new itself, skipped
+constexpr int SKIPPED_FRAMES = 3;
+
+ALLOCATION_NOINLINE void recordSite() {
+    // Walking the stack may allocate the first time round
+    if (recordingSite) return;
+    recordingSite = true;
+
+    void* stack[SKIPPED_FRAMES + ALLOCATION_SITE_FRAMES] = {};
+#ifdef _WIN32
+    ::RtlCaptureStackBackTrace(0, static_cast<DWORD>(SKIPPED_FRAMES + ALLOCATION_SITE_FRAMES), stack, NULL);
+#else
+    backtrace(stack, SKIPPED_FRAMES + static_cast<int>(ALLOCATION_SITE_FRAMES));
+#endif
+    void** frames = stack + SKIPPED_FRAMES;
+
+    uint64_t key = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < ALLOCATION_SITE_FRAMES; i++) key = (key ^ reinterpret_cast<uintptr_t>(frames[i])) * 0x100000001B3ull;
+    key |= 1; // 0 marks a free slot
+
+    size_t slot = static_cast<size_t>(key >> 20) % SITE_SLOTS;
+    for (size_t probe = 0; probe < SITE_PROBES; probe++, slot = (slot + 1) % SITE_SLOTS) {
+        SiteSlot& site = siteSlots[slot];
+        uint64_t current = site.key.load(std::memory_order_acquire);
+        if (current == 0 && site.key.compare_exchange_strong(current, key)) {
+            for (size_t i = 0; i < ALLOCATION_SITE_FRAMES; i++) site.frames[i].store(frames[i], std::memory_order_relaxed);
+            current = key;
+        }
+        if (current != key) continue;
+        site.count.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+    recordingSite = false;
+}
+
+} // namespace
+
+std::vector<AllocationSite> allocationSites(size_t limit) {
+    std::vector<AllocationSite> sites;
+    for (const SiteSlot& slot : siteSlots) {
+        uint64_t count = slot.count.load(std::memory_order_relaxed);
+        if (count == 0) continue;
+        AllocationSite site;
+        for (size_t i = 0; i < ALLOCATION_SITE_FRAMES; i++) site.frames[i] = slot.frames[i].load(std::memory_order_relaxed);
+        site.count = count;
+        sites.push_back(site);
+    }
+    std::sort(sites.begin(), sites.end(), [](const AllocationSite& a, const AllocationSite& b) { return a.count > b.count; });
+    if (sites.size() > limit) sites.resize(limit);
+    return sites;
+}
+
+void resetAllocationSites() {
+    for (SiteSlot& slot : siteSlots) {
+        slot.count.store(0, std::memory_order_relaxed);
+        slot.key.store(0, std::memory_order_relaxed);
+    }
+}
+
+#else
+
+std::vector<AllocationSite> allocationSites(size_t) {
+    return {};
+}
+
+void resetAllocationSites() {}
+
+#endif
+
+std::string describeCodeAddress(void* address) {
+    char text[512];
+#ifdef _WIN32
+    HMODULE module = NULL;
+    char path[MAX_PATH];
+    if (::GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, static_cast<LPCSTR>(address), &module)
+        && ::GetModuleFileNameA(module, path, MAX_PATH)) {
+        const char* name = strrchr(path, '\\');
+        snprintf(text, sizeof(text), "%s+0x%zx", name ? name + 1 : path,
+            static_cast<size_t>(static_cast<const char*>(address) - reinterpret_cast<const char*>(module)));
+        return text;
+    }
+#else
+    Dl_info info;
+    if (dladdr(address, &info)) {
+        if (info.dli_sname) {
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            snprintf(text, sizeof(text), "%s+0x%zx", status == 0 && demangled ? demangled : info.dli_sname,
+                static_cast<size_t>(static_cast<const char*>(address) - static_cast<const char*>(info.dli_saddr)));
+            std::free(demangled);
+            return text;
+        }
+        if (info.dli_fname) {
+            const char* name = strrchr(info.dli_fname, '/');
+            snprintf(text, sizeof(text), "%s+0x%zx", name ? name + 1 : info.dli_fname,
+                static_cast<size_t>(static_cast<const char*>(address) - static_cast<const char*>(info.dli_fbase)));
+            return text;
+        }
+    }
+#endif
+    snprintf(text, sizeof(text), "%p", address);
+    return text;
+}
+
+// Helper function behind every operator new, so they all have the same frames above recordSite()
+static ALLOCATION_NOINLINE void* allocate(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    threadAllocations++;
+#if !defined(NDEBUG)
+    recordSite();
+#endif
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
@@ -0,0 +1,60 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Counts every allocation made through the global operator new, for benchmarks
+// that report allocations per line. Linking AllocationCounter.cpp replaces the
+// global operator new and delete of the whole program, so only the benchmark
+// links it.
+//
+// Debug builds (NDEBUG not defined) also attribute allocations to where they
+// were made: the few return addresses above operator new, so an allocation
+// inside std::string still shows the code that grew the string.
+//
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Allocations so far, on every thread
+uint64_t allocationCount();
+
+// Allocations so far on the calling thread; feeds setInstrumentAllocationCounter()
+uint64_t threadAllocationCount();
+
+#if defined(NDEBUG)
+constexpr bool ALLOCATION_SITES_AVAILABLE = false;
+#else
+constexpr bool ALLOCATION_SITES_AVAILABLE = true;
+#endif
+
+constexpr size_t ALLOCATION_SITE_FRAMES = 3;
+
+struct AllocationSite {
+    void* frames[ALLOCATION_SITE_FRAMES] = {}; // innermost first, null past the stack's end
+    uint64_t count = 0;
+};
+
+// The `limit` sites with the most allocations since resetAllocationSites(); empty in release builds
+std::vector<AllocationSite> allocationSites(size_t limit);
+void resetAllocationSites();
+
+// A code address as "function+0x12" where the symbol is known, else "module+0x1234"
+std::string describeCodeAddress(void* address);
@@ -72,6 +72,7 @@ extern "C" __declspec(dllexport) void beNotified(SCNotification *notifyCode)
 	{
 		case NPPN_SHUTDOWN:
 		{
+			stopExportJob();
 			commandMenuCleanUp();
 		}
 		break;
@@ -0,0 +1,134 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "PerfCounters.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char* perfCounterName(PerfCounter counter) {
+    switch (counter) {
+    case PerfCounter::Cycles: return "cycles";
+    case PerfCounter::Instructions: return "instructions";
+    case PerfCounter::BranchMisses: return "branch-misses";
+    case PerfCounter::L1dMisses: return "L1d-misses";
+    case PerfCounter::LlcMisses: return "LLC-misses";
+    default: return "?";
+    }
+}
+
+bool PerfCounters::available() const {
+    for (int fd : _fds) {
+        if (fd >= 0) return true;
+    }
+    return false;
+}
+
+#if defined(__linux__)
+
+namespace {
+
+// Helper function to describe a counter to perf_event_open
+perf_event_attr counterAttributes(PerfCounter counter) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.disabled = 1;
+    attr.inherit = 1;          // threads started while counting, e.g. the parallel export
+    attr.exclude_kernel = 1;   // allowed with perf_event_paranoid up to 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    auto cache = [&](uint64_t cacheId) {
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cacheId | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+    switch (counter) {
+    case PerfCounter::Cycles: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+    case PerfCounter::Instructions: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+    case PerfCounter::BranchMisses: attr.type = PERF_TYPE_HARDWARE; attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+    case PerfCounter::L1dMisses: cache(PERF_COUNT_HW_CACHE_L1D); break;
+    default: cache(PERF_COUNT_HW_CACHE_LL); break;
+    }
+    return attr;
+}
+
+} // namespace
+
+PerfCounters::PerfCounters() {
+    int lastError = 0;
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        perf_event_attr attr = counterAttributes(static_cast<PerfCounter>(i));
+        _fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+        if (_fds[i] < 0) lastError = errno;
+    }
+    if (!available()) {
+        _error = std::string("perf_event_open: ") + std::strerror(lastError);
+        if (lastError == EACCES || lastError == EPERM) _error += " (see /proc/sys/kernel/perf_event_paranoid)";
+        else if (lastError == ENOENT || lastError == EOPNOTSUPP) _error += " (no hardware counters, e.g. in a VM or container)";
+    }
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+void PerfCounters::start() {
+    for (int fd : _fds) {
+        if (fd < 0) continue;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+PerfSample PerfCounters::stop() {
+    for (int fd : _fds) {
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+    PerfSample sample;
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        uint64_t data[3]; // value, time enabled, time running
+        if (_fds[i] < 0 || read(_fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) continue;
+        sample.values[i] = static_cast<double>(data[0]) * (static_cast<double>(data[1]) / static_cast<double>(data[2]));
+        sample.valid[i] = true;
+    }
+    return sample;
+}
+
+#else
+
+PerfCounters::PerfCounters() : _error("hardware counters are only read on Linux") {
+    for (int& fd : _fds) fd = -1;
+}
+
+PerfCounters::~PerfCounters() = default;
+
+void PerfCounters::start() {}
+
+PerfSample PerfCounters::stop() {
+    return PerfSample();
+}
+
+#endif
@@ -0,0 +1,70 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Hardware performance counters for the benchmarks: cycles, instructions, branch
+// misses and L1d/LLC misses of the calling thread and the threads it starts,
+// user space only. On Linux they come from perf_event_open; each counter is
+// opened on its own, so the ones a CPU, VM or container doesn't offer are just
+// missing. Elsewhere, or with none at all, available() is false and error() says why.
+//
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class PerfCounter {
+    Cycles,
+    Instructions,
+    BranchMisses,
+    L1dMisses,
+    LlcMisses,
+    Count
+};
+
+constexpr size_t PERF_COUNTER_COUNT = static_cast<size_t>(PerfCounter::Count);
+
+const char* perfCounterName(PerfCounter counter);
+
+// Counts between start() and stop(), scaled up if the kernel multiplexed them
+struct PerfSample {
+    double values[PERF_COUNTER_COUNT] = {};
+    bool valid[PERF_COUNTER_COUNT] = {};
+
+    bool has(PerfCounter counter) const { return valid[static_cast<size_t>(counter)]; }
+    double operator[](PerfCounter counter) const { return values[static_cast<size_t>(counter)]; }
+};
+
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const;
+    const std::string& error() const { return _error; }
+
+    void start();
+    PerfSample stop();
+
+private:
+    int _fds[PERF_COUNTER_COUNT];
+    std::string _error;
+};
@@ -17,15 +17,21 @@
 
 #include "PluginDefinition.h"
 #include "menuCmdID.h"
+#include <algorithm>
+#include <atomic>
 #include <string>
-#include <regex>
-#include <sstream>
+#include <string_view>
 #include <filesystem>
-#include <fstream>
-#include <set>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 #include <windows.h>
+#include <shlobj.h>
 #include <tchar.h>
 #include "Scintilla.h"
+#include "SdkCore/EditorCommands.h"
+#include "SdkCore/Instrument.h"
 
 // Define Scintilla messages if not already defined
 #ifndef SCI_GETLENGTH
@@ -78,11 +84,32 @@ FuncItem funcItem[nbFunc];
 //
 NppData nppData;
 
+//
+// The export running in the background, and the hidden window its progress and
+// completion are posted to so that they run on Notepad++'s thread
+//
+static HINSTANCE pluginInstance = NULL;
+static ExportJob exportJob;
+static HWND jobWindow = NULL;
+const UINT WM_JOB_CALLBACK = WM_APP + 1;
+
+//
+// The job reads the document that was current when it started through a hidden
+// Scintilla of its own holding a reference to it, so the user can switch tabs or
+// even close the document meanwhile. Its edit notifications tell the job that the
+// document changed under it.
+//
+static HWND jobReader = NULL;
+static LRESULT jobDocument = 0;
+static std::atomic<bool> jobDocumentEdited = false;
+static thread_local bool onJobThread = false;
+
 //
 // Initialize your plugin data here
 // It will be called while plugin loading   
-void pluginInit(HANDLE /*hModule*/)
+void pluginInit(HANDLE hModule)
 {
+    pluginInstance = static_cast<HINSTANCE>(hModule);
 }
 
 //
@@ -106,10 +133,18 @@ bool commandMenuInit()
     TCHAR* exportToSDK = _tcsdup(TEXT("Export Selection to Master SDK"));
     TCHAR* exportAsFile = _tcsdup(TEXT("Export Selection as Individual File"));
     TCHAR* exportEntireFile = _tcsdup(TEXT("Export Entire File to SDK"));
+    TCHAR* exportShards = _tcsdup(TEXT("Export Entire File as Individual Files"));
+    TCHAR* exportMatching = _tcsdup(TEXT("Export Classes Matching Selection"));
+    TCHAR* editFilter = _tcsdup(TEXT("Edit Export Filter..."));
+    TCHAR* cancelJob = _tcsdup(TEXT("Cancel Export"));
 
     setCommand(0, exportToSDK, exportToMasterSDK, NULL, false);
     setCommand(1, exportAsFile, exportAsIndividualFile, NULL, false);
     setCommand(2, exportEntireFile, exportEntireFileToSDK, NULL, false);
+    setCommand(3, exportShards, exportEntireFileAsShards, NULL, false);
+    setCommand(4, exportMatching, exportMatchingClasses, NULL, false);
+    setCommand(5, editFilter, editExportFilter, NULL, false);
+    setCommand(6, cancelJob, cancelExport, NULL, false);
 
     return true;
 }
@@ -147,656 +182,377 @@ void showError(const TCHAR* message) {
     ::MessageBox(nppData._nppHandle, message, TEXT("SDK Formatter Error"), MB_OK | MB_ICONERROR);
 }
 
-// Helper function to get the current selection
-std::string getCurrentSelection() {
-    try {
-        HWND curScintilla;
-        int which = -1;
-        ::SendMessage(nppData._nppHandle, NPPM_GETCURRENTSCINTILLA, 0, (LPARAM)&which);
-        if (which == -1) {
-            showError(TEXT("Failed to get current editor window."));
-            return "";
-        }
-        curScintilla = (which == 0) ? nppData._scintillaMainHandle : nppData._scintillaSecondHandle;
-
-        // Get selection start and end positions
-        size_t selStart = ::SendMessage(curScintilla, SCI_GETSELECTIONSTART, 0, 0);
-        size_t selEnd = ::SendMessage(curScintilla, SCI_GETSELECTIONEND, 0, 0);
-        if (selStart == selEnd) return "";
+// Helper function to convert UTF-8 text for the Windows API
+std::wstring toWide(std::string_view text) {
+    if (text.empty()) return std::wstring();
+    int length = MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), NULL, 0);
+    std::wstring wide(length, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), &wide[0], length);
+    return wide;
+}
 
-        // Get the selected text
-        size_t textLength = selEnd - selStart;
-        if (textLength == 0) { // Only check for empty selection
-            showError(TEXT("Invalid selection length."));
-            return "";
-        }
+// Helper function to convert text from the Windows API to UTF-8
+std::string toUtf8(const wchar_t* text) {
+    int length = static_cast<int>(WideCharToMultiByte(CP_UTF8, 0, text, -1, NULL, 0, NULL, NULL) - 1);
+    if (length <= 0) return std::string();
+    std::string utf8(length, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, text, -1, &utf8[0], length + 1, NULL, NULL);
+    return utf8;
+}
 
-        char* buffer = nullptr;
-        try {
-            buffer = new char[textLength + 1];
-            ::SendMessage(curScintilla, SCI_GETSELTEXT, 0, (LPARAM)buffer);
-            std::string selectedText(buffer);
-            delete[] buffer;
-            return selectedText;
-        }
-        catch (...) {
-            delete[] buffer;
-            showError(TEXT("Failed to allocate memory for text selection."));
-            return "";
-        }
-    }
-    catch (...) {
-        showError(TEXT("Unexpected error while getting text selection."));
-        return "";
-    }
+// Helper function to get the Scintilla window of the current view, NULL if there is none
+HWND getCurrentScintilla() {
+    int which = -1;
+    ::SendMessage(nppData._nppHandle, NPPM_GETCURRENTSCINTILLA, 0, (LPARAM)&which);
+    if (which == -1) return NULL;
+    return (which == 0) ? nppData._scintillaMainHandle : nppData._scintillaSecondHandle;
 }
 
 // Helper function to replace the current selection
 void replaceSelection(const std::string& newText) {
-    HWND curScintilla;
-    int which = -1;
-    ::SendMessage(nppData._nppHandle, NPPM_GETCURRENTSCINTILLA, 0, (LPARAM)&which);
-    if (which == -1) return;
-    curScintilla = (which == 0) ? nppData._scintillaMainHandle : nppData._scintillaSecondHandle;
+    HWND curScintilla = getCurrentScintilla();
+    if (!curScintilla) return;
 
     ::SendMessage(curScintilla, SCI_REPLACESEL, 0, (LPARAM)newText.c_str());
 }
 
-// Function to format a line as an Offset
-std::string formatAsOffset(const std::string& line) {
-    try {
-        if (line.empty()) return "";
-
-        // Regular expression to match the format [offset][type] fieldName : dataType
-        std::regex pattern(R"(\[([0-9A-F]+)\](?:\[[CS]\])?\s+(\w+)\s*:\s*(.+))");
-        std::smatch matches;
-
-        if (std::regex_search(line, matches, pattern)) {
-            // Validate the offset is a valid hex number
-            std::string offset = matches[1].str();
-            std::string fieldName = matches[2].str();
-            std::string dataType = matches[3].str();
-
-            // Additional validation
-            if (offset.empty() || fieldName.empty() || dataType.empty()) {
-                return "";
-            }
-
-            // Validate hex format
-            try {
-                unsigned long hexValue = std::stoul(offset, nullptr, 16);
-                if (hexValue == 0 && offset != "0") {
-                    // Invalid hex value (zero but not "0")
-                    return "";
-                }
-            }
-            catch (...) {
-                return "";
-            }
-
-            // Format the output
-            std::stringstream ss;
-            ss << "\t\tpublic const uint " << fieldName << " = 0x" << offset << "; // " << dataType;
-            return ss.str();
-        }
-    }
-    catch (...) {
-        // Silently skip problematic lines
-        return "";
+// Runs the callbacks the export job posts, on Notepad++'s thread, and notes edits
+// to the document the job reads
+static LRESULT CALLBACK jobWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    if (msg == WM_NOTIFY) {
+        const SCNotification* notification = reinterpret_cast<const SCNotification*>(lParam);
+        if (notification->nmhdr.hwndFrom == jobReader && notification->nmhdr.code == SCN_MODIFIED) jobDocumentEdited = true;
+        return 0;
     }
-    return "";
+    if (msg != WM_JOB_CALLBACK) return ::DefWindowProc(hwnd, msg, wParam, lParam);
+    std::unique_ptr<std::function<void()>> callback(reinterpret_cast<std::function<void()>*>(lParam));
+    (*callback)();
+    return 0;
 }
 
-// Helper function to check if a class exists in the SDK file and get its line range
-bool checkClassExists(const std::string& className, const std::string& sdkPath, size_t& startLine, size_t& endLine) {
-    std::ifstream file(sdkPath);
-    if (!file.is_open()) return false;
-
-    std::string line;
-    std::regex classPattern("public\\s+readonly\\s+partial\\s+struct\\s+" + className);
-    size_t currentLine = 0;
-    bool found = false;
-    int braceCount = 0;
-    
-    while (std::getline(file, line)) {
-        currentLine++;
-        
-        if (!found && std::regex_search(line, classPattern)) {
-            found = true;
-            startLine = currentLine;
-            braceCount = 0;
-            for (char c : line) {
-                if (c == '{') braceCount++;
-            }
-            continue;
-        }
-        
-        if (found) {
-            for (char c : line) {
-                if (c == '{') braceCount++;
-                if (c == '}') braceCount--;
-            }
-            if (braceCount <= 0) {
-                endLine = currentLine;
-                return true;
-            }
-        }
-    }
-    return found;
+// Helper function to create the job's hidden window, once
+static bool createJobWindow() {
+    if (jobWindow) return true;
+    WNDCLASSEX windowClass = { 0 };
+    windowClass.cbSize = sizeof(WNDCLASSEX);
+    windowClass.lpfnWndProc = jobWindowProc;
+    windowClass.hInstance = pluginInstance;
+    windowClass.lpszClassName = TEXT("SdkFormatterJobWindow");
+    if (!::RegisterClassEx(&windowClass) && ::GetLastError() != ERROR_CLASS_ALREADY_EXISTS) return false;
+    jobWindow = ::CreateWindowEx(0, windowClass.lpszClassName, TEXT(""), 0, 0, 0, 0, 0, HWND_MESSAGE, NULL, pluginInstance, NULL);
+    return jobWindow != NULL;
 }
 
-// Helper function to check if file ends with proper namespace closure
-bool hasProperNamespaceClosure(const std::string& sdkPath) {
-    std::ifstream file(sdkPath);
-    if (!file.is_open()) return false;
-
-    // Read the entire file into a string
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string content = buffer.str();
-
-    // Trim whitespace from the end
-    content.erase(std::find_if(content.rbegin(), content.rend(), [](unsigned char ch) {
-        return !std::isspace(ch);
-    }).base(), content.end());
-
-    // Check if the file ends with a closing brace
-    return content.empty() || content.back() == '}';
+// Helper function to give the job's reader a reference to the document of `scintilla`
+static bool attachJobDocument(HWND scintilla) {
+    if (!jobReader) {
+        jobReader = reinterpret_cast<HWND>(::SendMessage(nppData._nppHandle, NPPM_CREATESCINTILLAHANDLE, 0, reinterpret_cast<LPARAM>(jobWindow)));
+        if (!jobReader) return false;
+        ::SendMessage(jobReader, SCI_SETMODEVENTMASK, SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT, 0);
+    }
+    jobDocument = ::SendMessage(scintilla, SCI_GETDOCPOINTER, 0, 0);
+    ::SendMessage(jobReader, SCI_ADDREFDOCUMENT, 0, jobDocument);
+    ::SendMessage(jobReader, SCI_SETDOCPOINTER, 0, jobDocument);
+    jobDocumentEdited = false;
+    return true;
 }
 
-// Helper function to format warning message with line numbers
-std::wstring formatWarningMessage(const std::string& className, size_t startLine, size_t endLine) {
-    std::wstringstream ss;
-    std::wstring wClassName;
-    int classLen = static_cast<int>(MultiByteToWideChar(CP_UTF8, 0, className.c_str(), -1, NULL, 0) - 1);
-    wClassName.resize(classLen);
-    MultiByteToWideChar(CP_UTF8, 0, className.c_str(), -1, &wClassName[0], classLen + 1);
-    
-    ss << L"The class '" << wClassName
-       << L"' already exists in the SDK file (lines " << startLine << L"-" << endLine 
-       << L").\n\nDo you want to replace the existing definition?";
-    return ss.str();
+// Helper function to let go of the document attachJobDocument() took
+static void detachJobDocument() {
+    if (!jobDocument) return;
+    ::SendMessage(jobReader, SCI_SETDOCPOINTER, 0, 0);
+    ::SendMessage(jobReader, SCI_RELEASEDOCUMENT, 0, jobDocument);
+    jobDocument = 0;
 }
 
-// Helper function to remove existing class from SDK file
-void removeExistingClass(const std::string& className, const std::string& sdkPath) {
-    std::ifstream inFile(sdkPath);
-    std::stringstream buffer;
-    std::string line;
-    bool skipping = false;
-    int braceCount = 0;
-
-    while (std::getline(inFile, line)) {
-        if (!skipping) {
-            std::regex classPattern("public\\s+readonly\\s+partial\\s+struct\\s+" + className);
-            if (std::regex_search(line, classPattern)) {
-                skipping = true;
-                braceCount = 0;
-                continue;
-            }
-            buffer << line << "\n";
-        }
-        else {
-            // Count braces to find the end of the class
-            for (char c : line) {
-                if (c == '{') braceCount++;
-                if (c == '}') braceCount--;
-            }
-            if (braceCount <= 0) {
-                skipping = false;
-            }
+// Helper function to copy the text of `scintilla` out a window at a time, which
+// leaves the buffer's gap where it is. With `edited`, a window read after an edit
+// is never handed on.
+static void readScintilla(HWND scintilla, size_t chunkSize, const std::function<void(std::string_view chunk)>& onChunk, const std::atomic<bool>* edited) {
+    if (chunkSize == 0) chunkSize = 1;
+    size_t textLength = ::SendMessage(scintilla, SCI_GETLENGTH, 0, 0);
+    std::vector<char> buffer((std::min)(chunkSize, textLength) + 1);
+    for (size_t pos = 0; pos < textLength; pos += chunkSize) {
+        size_t length = (std::min)(chunkSize, textLength - pos);
+        {
+            SDK_INSTRUMENT_STAGE(Read);
+            Sci_TextRangeFull range;
+            range.chrg.cpMin = static_cast<Sci_Position>(pos);
+            range.chrg.cpMax = static_cast<Sci_Position>(pos + length);
+            range.lpstrText = buffer.data();
+            ::SendMessage(scintilla, SCI_GETTEXTRANGEFULL, 0, reinterpret_cast<LPARAM>(&range));
         }
+        if (edited && *edited) throw std::runtime_error("The document was edited during the export; export it again.");
+        onChunk(std::string_view(buffer.data(), length));
     }
-    inFile.close();
+}
 
-    std::ofstream outFile(sdkPath);
-    outFile << buffer.str();
+// Helper function to run `callback` on Notepad++'s thread, from any thread
+static void postToNpp(std::function<void()> callback) {
+    auto* posted = new std::function<void()>(std::move(callback));
+    if (!::PostMessage(jobWindow, WM_JOB_CALLBACK, 0, reinterpret_cast<LPARAM>(posted))) delete posted;
 }
 
-// Function to format selected text into SDK format
-std::string formatSelectedText(std::string& className, int& processedLines) {
-    std::string selectedText = getCurrentSelection();
-    if (selectedText.empty()) {
-        showError(TEXT("Please select some text first."));
-        return "";
-    }
+// Helper function to show the job's progress where Notepad++ shows the language
+static void setJobStatus(const std::wstring& text) {
+    ::SendMessage(nppData._nppHandle, NPPM_SETSTATUSBAR, STATUSBAR_DOC_TYPE, reinterpret_cast<LPARAM>(text.c_str()));
+}
 
-    std::stringstream input(selectedText);
-    std::stringstream output;
-    std::string line;
-    processedLines = 0;
-    std::string currentClass;
-    std::stringstream currentClassOutput;
-    bool insideClass = false;
-
-    while (std::getline(input, line)) {
-        // Check if this is a class declaration line
-        std::regex classPattern(R"(\[Class\]\s+([^:]+)(?:\s*:\s*([^{]+))?)");
-        std::smatch classMatches;
-        
-        if (std::regex_search(line, classMatches, classPattern)) {
-            // If we were processing a previous class, close and add it to the output
-            if (insideClass) {
-                currentClassOutput << "    }\n\n";
-                output << currentClassOutput.str();
-                currentClassOutput.str(""); // Clear the buffer
-            }
+// Starts the folder picker in the folder passed as `data`
+static int CALLBACK browseFolderCallback(HWND hwnd, UINT msg, LPARAM, LPARAM data) {
+    if (msg == BFFM_INITIALIZED) ::SendMessage(hwnd, BFFM_SETSELECTION, TRUE, data);
+    return 0;
+}
 
-            std::string originalClassName = classMatches[1].str();
-            currentClass = originalClassName;
-            
-            // Clean up the class name for C# compatibility
-            // Remove special characters except underscores
-            currentClass.erase(std::remove_if(currentClass.begin(), currentClass.end(), 
-                [](char c) { return !std::isalnum(c) && c != '_' && c != '.'; }), currentClass.end());
-            
-            // Replace dots with underscores
-            std::replace(currentClass.begin(), currentClass.end(), '.', '_');
-            
-            // Ensure the name starts with a letter or underscore
-            if (!currentClass.empty() && !std::isalpha(currentClass[0]) && currentClass[0] != '_') {
-                currentClass = "_" + currentClass;
+//
+// The commands' view of Notepad++: Scintilla and Notepad++ messages, message
+// boxes and the common dialogs
+//
+class NppEditorHost : public EditorHost {
+public:
+    std::string selection() override {
+        try {
+            HWND curScintilla = getCurrentScintilla();
+            if (!curScintilla) {
+                ::showError(TEXT("Failed to get current editor window."));
+                return "";
             }
-            
-            insideClass = true;
-            className = currentClass; // Store the last processed class name
-
-            // Start building the output for this class
-            currentClassOutput << "    // " << line << "\n";
-            currentClassOutput << "    public readonly partial struct " << currentClass << "\n    {\n";
-            continue;
-        }
 
-        // If we're inside a class definition, process the line
-        if (insideClass) {
-            std::string formattedLine = formatAsOffset(line);
-            if (!formattedLine.empty()) {
-                currentClassOutput << "        " << formattedLine.substr(formattedLine.find_first_not_of("\t ")) << "\n";
-                processedLines++;
-            }
+            // Get selection start and end positions
+            size_t selStart = ::SendMessage(curScintilla, SCI_GETSELECTIONSTART, 0, 0);
+            size_t selEnd = ::SendMessage(curScintilla, SCI_GETSELECTIONEND, 0, 0);
+            if (selStart == selEnd) return "";
+
+            // Get the selected text
+            std::vector<char> buffer(selEnd - selStart + 1);
+            ::SendMessage(curScintilla, SCI_GETSELTEXT, 0, (LPARAM)buffer.data());
+            return std::string(buffer.data());
+        }
+        catch (...) {
+            ::showError(TEXT("Unexpected error while getting text selection."));
+            return "";
         }
     }
 
-    // Close and add the last class if we were processing one
-    if (insideClass) {
-        currentClassOutput << "    }\n\n";
-        output << currentClassOutput.str();
+    size_t documentLength() override {
+        HWND curScintilla = getCurrentScintilla();
+        return curScintilla ? static_cast<size_t>(::SendMessage(curScintilla, SCI_GETLENGTH, 0, 0)) : 0;
     }
 
-    return processedLines > 0 ? output.str() : "";
-}
+    bool documentView(std::string_view& text) override {
+        HWND curScintilla = getCurrentScintilla();
+        if (!curScintilla) return false;
 
-//
-// Plugin command functions
-//
-void exportToMasterSDK()
-{
-    try {
-        std::string className;
-        int processedLines = 0;
-        std::string formattedText = formatSelectedText(className, processedLines);
-        
-        if (formattedText.empty()) return;
-
-        // Get current file's directory path
-        TCHAR currentPath[MAX_PATH];
-        if (::SendMessage(nppData._nppHandle, NPPM_GETCURRENTDIRECTORY, MAX_PATH, (LPARAM)currentPath) == 0) {
-            showError(TEXT("Failed to get current directory."));
-            return;
-        }
-        
-        // Construct path to custom_SDK.cs
-        std::wstring sdkPathW = std::wstring(currentPath) + L"\\custom_SDK.cs";
-        std::string sdkPath;
-        int pathLen = static_cast<int>(WideCharToMultiByte(CP_UTF8, 0, sdkPathW.c_str(), -1, NULL, 0, NULL, NULL) - 1);
-        sdkPath.resize(pathLen);
-        WideCharToMultiByte(CP_UTF8, 0, sdkPathW.c_str(), -1, &sdkPath[0], pathLen + 1, NULL, NULL);
-        
-        // Check if class already exists
-        size_t startLine = 0, endLine = 0;
-        if (checkClassExists(className, sdkPath, startLine, endLine)) {
-            std::wstring warningMsg = formatWarningMessage(className, startLine, endLine);
-            if (::MessageBox(NULL, warningMsg.c_str(),
-                TEXT("SDK Formatter - Class Already Exists"),
-                MB_YESNO | MB_ICONWARNING) == IDNO) {
-                return;
-            }
-            // Remove existing class definition
-            removeExistingClass(className, sdkPath);
+        // Scintilla closes the gap in its buffer and hands out the text in place
+        size_t textLength = ::SendMessage(curScintilla, SCI_GETLENGTH, 0, 0);
+        const char* characters = reinterpret_cast<const char*>(::SendMessage(curScintilla, SCI_GETCHARACTERPOINTER, 0, 0));
+        if (!characters) return false;
+        text = std::string_view(characters, textLength);
+        return true;
+    }
+
+    bool readDocument(size_t chunkSize, const std::function<void(std::string_view chunk)>& onChunk) override {
+        // An export job reads the document it started on, and reports problems through its result
+        if (onJobThread) {
+            if (!jobDocument) throw std::runtime_error("The export has no document to read.");
+            readScintilla(jobReader, chunkSize, onChunk, &jobDocumentEdited);
+            return true;
         }
 
-        // Check if file exists and validate its structure
-        bool fileExists = std::filesystem::exists(sdkPath);
-        if (fileExists && !hasProperNamespaceClosure(sdkPath)) {
-            showError(TEXT("The SDK file appears to be corrupted or improperly formatted.\nPlease check the file structure."));
-            return;
+        HWND curScintilla = getCurrentScintilla();
+        if (!curScintilla) {
+            ::showError(TEXT("Failed to get current editor window."));
+            return false;
         }
+        readScintilla(curScintilla, chunkSize, onChunk, nullptr);
+        return true;
+    }
 
-        // Open file in append mode if it exists, create new otherwise
-        std::ofstream file;
-        if (fileExists) {
-            file.open(sdkPath, std::ios::app);
-        } else {
-            file.open(sdkPath);
-            file << "namespace SDK\n{\n";
+    bool runJob(ExportJob::Work work, ExportJob::Done done) override {
+        if (exportJob.running()) return false;
+        HWND curScintilla = getCurrentScintilla();
+        if (!curScintilla || !createJobWindow() || !attachJobDocument(curScintilla)) {
+            ::showError(TEXT("Failed to start the export."));
+            return true;
         }
 
-        if (!file.is_open()) {
-            showError(TEXT("Failed to open or create SDK file. Please check file permissions."));
-            return;
+        // Both callbacks come on the job's thread and are posted on to Notepad++'s
+        auto report = [](const ExportProgress& progress) {
+            std::wstring text = L"SDK export: " + toWide(formatExportProgress(progress));
+            postToNpp([text] { setJobStatus(text); });
+        };
+        auto finish = [done = std::move(done)](const ExportJobResult& result) {
+            postToNpp([done, result] {
+                detachJobDocument();
+                setJobStatus(result.outcome == ExportJobOutcome::Completed ? L"SDK export done"
+                    : result.outcome == ExportJobOutcome::Cancelled ? L"SDK export cancelled" : L"SDK export failed");
+                done(result);
+            });
+        };
+        auto start = [work = std::move(work)](ExportProgressTracker& progress) {
+            onJobThread = true;
+            work(progress);
+        };
+        if (!exportJob.start(std::move(start), report, finish)) {
+            detachJobDocument();
+            return false;
         }
+        setJobStatus(L"SDK export started (Plugins > SDK Formatter > Cancel Export stops it)");
+        return true;
+    }
+
+    bool currentDirectory(std::filesystem::path& dir) override {
+        TCHAR currentPath[MAX_PATH];
+        if (::SendMessage(nppData._nppHandle, NPPM_GETCURRENTDIRECTORY, MAX_PATH, (LPARAM)currentPath) == 0) return false;
+        dir = currentPath;
+        return true;
+    }
 
-        // Add the new class
-        file << formattedText;
-        file.close();
+    std::string setting(std::string_view section, std::string_view key) override {
+        TCHAR value[4096] = { 0 };
+        ::GetPrivateProfileString(toWide(section).c_str(), toWide(key).c_str(), TEXT(""), value, 4096, settingsPath().wstring().c_str());
+        return toUtf8(value);
+    }
 
-        if (!file.good()) {
-            showError(TEXT("An error occurred while writing to the SDK file."));
-            return;
-        }
+    std::filesystem::path settingsPath() override {
+        TCHAR configDir[MAX_PATH] = { 0 };
+        ::SendMessage(nppData._nppHandle, NPPM_GETPLUGINSCONFIGDIR, MAX_PATH, (LPARAM)configDir);
+        return std::wstring(configDir) + L"\\SdkFormatter.ini";
+    }
 
-        // Open the SDK file in Notepad++
-        if (::SendMessage(nppData._nppHandle, NPPM_DOOPEN, 0, (LPARAM)sdkPathW.c_str()) == 0) {
-            showError(TEXT("Failed to open the SDK file after writing."));
-            return;
+    bool openFile(const std::filesystem::path& path, EditorLanguage language) override {
+        if (::SendMessage(nppData._nppHandle, NPPM_DOOPEN, 0, (LPARAM)path.c_str()) == 0) return false;
+        if (language != EditorLanguage::Auto) {
+            int langType = language == EditorLanguage::Cpp ? L_CPP : language == EditorLanguage::Rust ? L_RUST : language == EditorLanguage::Text ? L_TEXT : L_CS;
+            ::SendMessage(nppData._nppHandle, NPPM_SETCURRENTLANGTYPE, 0, langType);
         }
-        
-        // Set the language to C# for proper syntax highlighting
-        ::SendMessage(nppData._nppHandle, NPPM_SETCURRENTLANGTYPE, 0, L_CS);
+        return true;
     }
-    catch (const std::filesystem::filesystem_error& e) {
-        std::wstringstream ss;
-        ss << L"Filesystem error: " << e.what();
-        showError(ss.str().c_str());
+
+    void showError(std::string_view message) override {
+        ::showError(toWide(message).c_str());
     }
-    catch (const std::exception& e) {
-        std::wstringstream ss;
-        ss << L"Error: " << e.what();
-        showError(ss.str().c_str());
+
+    void showMessage(std::string_view message) override {
+        ::MessageBox(nppData._nppHandle, toWide(message).c_str(), TEXT("SDK Formatter"), MB_OK | MB_ICONINFORMATION);
     }
-    catch (...) {
-        showError(TEXT("An unexpected error occurred while processing the text."));
+
+    bool askYesNo(std::string_view title, std::string_view question) override {
+        return ::MessageBox(nppData._nppHandle, toWide(question).c_str(), toWide(title).c_str(), MB_YESNO | MB_ICONWARNING) == IDYES;
     }
-}
 
-void exportAsIndividualFile()
-{
-    try {
-        std::string className;
-        int processedLines = 0;
-        std::string formattedText = formatSelectedText(className, processedLines);
-        
-        if (formattedText.empty()) return;
-
-        // Get current file's directory path
-        TCHAR currentPath[MAX_PATH];
-        ::SendMessage(nppData._nppHandle, NPPM_GETCURRENTDIRECTORY, MAX_PATH, (LPARAM)currentPath);
-        
-        // Create suggested filename based on class name
-        std::wstring suggestedName;
-        int nameLen = static_cast<int>(MultiByteToWideChar(CP_UTF8, 0, className.c_str(), -1, NULL, 0) - 1);
-        suggestedName.resize(nameLen);
-        MultiByteToWideChar(CP_UTF8, 0, className.c_str(), -1, &suggestedName[0], nameLen + 1);
-        suggestedName += L"_Offsets.cs";
-        
-        // Setup save dialog
+    bool askSavePath(const std::vector<EditorFileType>& types, std::string_view defaultExtension,
+        std::filesystem::path& path, size_t& type) override {
+        // "Description\0pattern\0...\0"
+        std::wstring filter;
+        for (const EditorFileType& fileType : types) {
+            filter += toWide(fileType.description);
+            filter += L'\0';
+            filter += toWide(fileType.pattern);
+            filter += L'\0';
+        }
+        std::wstring initialDir = path.parent_path().wstring();
+        std::wstring defExt = toWide(defaultExtension);
+
         TCHAR fileName[MAX_PATH];
-        wcscpy_s(fileName, suggestedName.c_str());
-        
+        wcsncpy_s(fileName, path.filename().wstring().c_str(), _TRUNCATE);
+
         OPENFILENAME ofn = { 0 };
         ofn.lStructSize = sizeof(OPENFILENAME);
         ofn.hwndOwner = nppData._nppHandle;
-        ofn.lpstrFilter = TEXT("C# Files (*.cs)\0*.cs\0All Files (*.*)\0*.*\0");
+        ofn.lpstrFilter = filter.c_str();
+        ofn.nFilterIndex = static_cast<DWORD>(type + 1);
         ofn.lpstrFile = fileName;
         ofn.nMaxFile = MAX_PATH;
-        ofn.lpstrInitialDir = currentPath;
-        ofn.lpstrDefExt = TEXT("cs");
+        ofn.lpstrInitialDir = initialDir.c_str();
+        ofn.lpstrDefExt = defExt.c_str();
         ofn.Flags = OFN_OVERWRITEPROMPT | OFN_PATHMUSTEXIST;
 
-        // Show save dialog
-        if (GetSaveFileName(&ofn)) {
-            // Add namespace structure to individual file
-            std::stringstream fullOutput;
-            fullOutput << "namespace SDK\n{\n" << formattedText << "}\n";
-
-            // Open the file
-            FILE* fp = nullptr;
-            if (_wfopen_s(&fp, fileName, L"w") == 0 && fp != nullptr) {
-                std::string finalText = fullOutput.str();
-                fwrite(finalText.c_str(), 1, finalText.length(), fp);
-                fclose(fp);
-
-                // Open the saved file in Notepad++
-                ::SendMessage(nppData._nppHandle, NPPM_DOOPEN, 0, (LPARAM)fileName);
-                
-                // Set the language to C# for proper syntax highlighting
-                ::SendMessage(nppData._nppHandle, NPPM_SETCURRENTLANGTYPE, 0, L_CS);
-            }
-            else {
-                showError(TEXT("Failed to write to the selected file."));
-            }
-        }
+        if (!GetSaveFileName(&ofn)) return false;
+        path = fileName;
+        type = ofn.nFilterIndex > 0 ? ofn.nFilterIndex - 1 : 0;
+        return true;
     }
-    catch (...) {
-        showError(TEXT("An unexpected error occurred while processing the text."));
-    }
-}
 
-// Helper function to get the entire file content
-std::string getCurrentFileContent() {
-    try {
-        HWND curScintilla;
-        int which = -1;
-        ::SendMessage(nppData._nppHandle, NPPM_GETCURRENTSCINTILLA, 0, (LPARAM)&which);
-        if (which == -1) {
-            showError(TEXT("Failed to get current editor window."));
-            return "";
-        }
-        curScintilla = (which == 0) ? nppData._scintillaMainHandle : nppData._scintillaSecondHandle;
+    bool askFolder(std::string_view title, std::filesystem::path& folder) override {
+        std::wstring wTitle = toWide(title);
+        std::wstring start = folder.wstring();
 
-        // Get the file length
-        size_t textLength = ::SendMessage(curScintilla, SCI_GETLENGTH, 0, 0);
-        if (textLength == 0) {
-            showError(TEXT("File is empty."));
-            return "";
-        }
+        BROWSEINFO info = { 0 };
+        info.hwndOwner = nppData._nppHandle;
+        info.lpszTitle = wTitle.c_str();
+        info.ulFlags = BIF_RETURNONLYFSDIRS | BIF_NEWDIALOGSTYLE;
+        info.lpfn = browseFolderCallback;
+        info.lParam = reinterpret_cast<LPARAM>(start.c_str());
 
-        // Allocate buffer for entire file
-        std::vector<char> buffer(textLength + 1);
-        
-        // Get the text directly
-        ::SendMessage(curScintilla, SCI_GETTEXT, textLength + 1, reinterpret_cast<LPARAM>(buffer.data()));
-        
-        // Convert to string
-        return std::string(buffer.data(), textLength);
-    }
-    catch (...) {
-        showError(TEXT("Unexpected error while reading file content."));
-        return "";
+        PIDLIST_ABSOLUTE item = ::SHBrowseForFolder(&info);
+        if (!item) return false;
+        TCHAR path[MAX_PATH];
+        bool ok = ::SHGetPathFromIDList(item, path) != FALSE;
+        ::CoTaskMemFree(item);
+        if (ok) folder = path;
+        return ok;
     }
-}
-
-// Function to export entire file to SDK format
-void exportEntireFileToSDK() {
-    try {
-        // Get the entire file content at once
-        std::string fileContent = getCurrentFileContent();
-        if (fileContent.empty()) {
-            return; // Error already shown in getCurrentFileContent
-        }
+};
 
-        // Get path to custom_SDK.cs
-        TCHAR path[MAX_PATH];
-        ::SendMessage(nppData._nppHandle, NPPM_GETCURRENTDIRECTORY, MAX_PATH, (LPARAM)path);
-        std::wstring sdkPath = path;
-        sdkPath += TEXT("\\custom_SDK.cs");
-
-        // Open output file
-        FILE* fp = nullptr;
-        if (_wfopen_s(&fp, sdkPath.c_str(), L"w") != 0 || !fp) {
-            showError(TEXT("Failed to open custom_SDK.cs for writing."));
-            return;
-        }
+// One host for every command, as an export job goes on using it after its command has returned
+static NppEditorHost editorHost;
 
-        // Write namespace header
-        std::string header = "namespace SDK\n{\n";
-        fwrite(header.c_str(), sizeof(char), header.length(), fp);
-
-        // Track processed classes to avoid duplicates
-        std::set<std::string> processedClasses;
-        int classCount = 0;
-
-        // Process each line
-        std::istringstream iss(fileContent);
-        std::string line;
-        std::ostringstream classContent;
-        bool insideClass = false;
-        std::string currentClassName;
-        std::string originalClassLine;
-
-        while (std::getline(iss, line)) {
-            // Check for class declaration
-            size_t classPos = line.find("[Class]");
-            if (classPos != std::string::npos) {
-                // If we were processing a class, write it out
-                if (insideClass) {
-                    classContent << "    }\n\n";
-                    std::string content = classContent.str();
-                    fwrite(content.c_str(), sizeof(char), content.length(), fp);
-                    classContent.str("");
-                    classContent.clear();
-                }
-
-                // Extract class name and base class
-                std::string className = line.substr(classPos);
-                // Trim whitespace
-                while (!className.empty() && std::isspace(className.front())) className.erase(0, 1);
-                while (!className.empty() && std::isspace(className.back())) className.pop_back();
-
-                // Create valid C# struct name from the class name
-                std::string structName = className;
-                size_t colonPos = structName.find(':');
-                if (colonPos != std::string::npos) {
-                    structName = structName.substr(7, colonPos - 7); // 7 is length of "[Class]"
-                }
-                // Trim whitespace
-                while (!structName.empty() && std::isspace(structName.front())) structName.erase(0, 1);
-                while (!structName.empty() && std::isspace(structName.back())) structName.pop_back();
-
-                // Make the struct name valid C#
-                std::string validStructName = structName;
-                // Replace periods with underscores
-                std::replace(validStructName.begin(), validStructName.end(), '.', '_');
-                // Add underscore prefix if needed
-                if (!validStructName.empty() && !std::isalpha(validStructName[0]) && validStructName[0] != '_') {
-                    validStructName = '_' + validStructName;
-                }
-                // Replace any remaining invalid characters with underscore
-                for (char& c : validStructName) {
-                    if (!std::isalnum(c) && c != '_') {
-                        c = '_';
-                    }
-                }
-
-                // Skip if already processed
-                if (processedClasses.find(validStructName) != processedClasses.end()) {
-                    insideClass = false;
-                    continue;
-                }
-
-                processedClasses.insert(validStructName);
-                classCount++;
-                insideClass = true;
-                currentClassName = validStructName;
-                originalClassLine = className;
-
-                // Write class header
-                classContent << "    // " << className << "\n";
-                classContent << "    public readonly partial struct " << validStructName << "\n    {\n";
-                continue;
-            }
+//
+// Plugin command functions: the commands themselves are in SdkCore/EditorCommands.cpp
+//
+void exportToMasterSDK()
+{
+    exportToMasterSDK(editorHost);
+}
 
-            // Process fields if inside a class
-            if (insideClass) {
-                size_t offsetStart = line.find('[');
-                size_t offsetEnd = line.find(']', offsetStart);
-                if (offsetStart != std::string::npos && offsetEnd != std::string::npos) {
-                    // Get offset and field
-                    std::string offset = line.substr(offsetStart + 1, offsetEnd - offsetStart - 1);
-                    std::string field = line.substr(offsetEnd + 1);
-
-                    // Check for [S] or [C] tag and skip it if present
-                    size_t tagStart = line.find('[', offsetEnd + 1);
-                    size_t tagEnd = line.find(']', tagStart);
-                    size_t fieldStart;
-                    
-                    if (tagStart != std::string::npos && tagEnd != std::string::npos && tagStart < tagEnd) {
-                        fieldStart = tagEnd + 1;
-                    } else {
-                        fieldStart = offsetEnd + 1;
-                    }
-
-                    field = line.substr(fieldStart);
-
-                    // Verify it's a valid hex offset
-                    bool validHex = true;
-                    for (char c : offset) {
-                        if (!std::isxdigit(static_cast<unsigned char>(c))) {
-                            validHex = false;
-                            break;
-                        }
-                    }
-
-                    if (validHex && !offset.empty()) {
-                        // Extract field name and type
-                        size_t colonPos = field.find(':');
-                        if (colonPos != std::string::npos) {
-                            std::string fieldName = field.substr(0, colonPos);
-                            std::string fieldType = field.substr(colonPos + 1);
-
-                            // Trim whitespace
-                            while (!fieldName.empty() && std::isspace(fieldName.front())) fieldName.erase(0, 1);
-                            while (!fieldName.empty() && std::isspace(fieldName.back())) fieldName.pop_back();
-                            while (!fieldType.empty() && std::isspace(fieldType.front())) fieldType.erase(0, 1);
-                            while (!fieldType.empty() && std::isspace(fieldType.back())) fieldType.pop_back();
-
-                            // Format the field line exactly like the example
-                            classContent << "        public const uint " << fieldName << " = 0x" << offset << "; // " << fieldType << "\n";
-                        }
-                    }
-                }
-            }
-        }
+void exportAsIndividualFile()
+{
+    exportAsIndividualFile(editorHost);
+}
 
-        // Close last class if any
-        if (insideClass) {
-            classContent << "    }\n";
-            std::string content = classContent.str();
-            fwrite(content.c_str(), sizeof(char), content.length(), fp);
-        }
+void exportEntireFileToSDK() {
+    exportEntireFileToSDK(editorHost);
+}
 
-        // Close namespace
-        std::string footer = "}\n";
-        fwrite(footer.c_str(), sizeof(char), footer.length(), fp);
+void exportEntireFileAsShards() {
+    exportEntireFileAsShards(editorHost);
+}
 
-        fclose(fp);
+void exportMatchingClasses() {
+    exportMatchingClasses(editorHost);
+}
 
-        // Show success message
-        TCHAR msg[256];
-        _stprintf_s(msg, TEXT("Successfully exported %d classes to custom_SDK.cs"), classCount);
-        ::MessageBox(nppData._nppHandle, msg, TEXT("SDK Formatter"), MB_OK | MB_ICONINFORMATION);
+void editExportFilter() {
+    editExportFilter(editorHost);
+}
 
-        // Open the file in Notepad++
-        ::SendMessage(nppData._nppHandle, NPPM_DOOPEN, 0, (LPARAM)sdkPath.c_str());
-        ::SendMessage(nppData._nppHandle, NPPM_SETCURRENTLANGTYPE, 0, L_CS);
+void cancelExport() {
+    if (!exportJob.running()) {
+        editorHost.showMessage("No export is running.");
+        return;
     }
-    catch (const std::exception& e) {
-        TCHAR msg[256];
-        size_t convertedChars = 0;
-        mbstowcs_s(&convertedChars, msg, e.what(), _TRUNCATE);
-        showError(msg);
+    exportJob.cancel();
+}
+
+void stopExportJob() {
+    exportJob.cancel();
+    // The job may be waiting for this thread to answer a message to Scintilla
+    MSG msg;
+    while (exportJob.running()) {
+        ::MsgWaitForMultipleObjects(0, NULL, FALSE, 50, QS_SENDMESSAGE);
+        ::PeekMessage(&msg, NULL, 0, 0, PM_NOREMOVE | PM_QS_SENDMESSAGE);
     }
-    catch (...) {
-        showError(TEXT("Unexpected error while exporting file."));
+    exportJob.wait();
+
+    // What the job posted and Notepad++ hasn't run yet is dropped
+    if (jobWindow) {
+        while (::PeekMessage(&msg, jobWindow, WM_JOB_CALLBACK, WM_JOB_CALLBACK, PM_REMOVE)) {
+            delete reinterpret_cast<std::function<void()>*>(msg.lParam);
+        }
+        detachJobDocument();
+        ::DestroyWindow(jobWindow);
+        jobWindow = NULL;
+        jobReader = NULL;
     }
 }
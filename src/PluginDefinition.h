@@ -36,7 +36,7 @@ const TCHAR NPP_PLUGIN_NAME[] = TEXT("SDK Formatter");
 //
 // Here define the number of your plugin commands
 //
-const int nbFunc = 3;
+const int nbFunc = 7;
 
 //
 // Initialization of your plugin data
@@ -71,6 +71,15 @@ bool setCommand(size_t index, TCHAR *cmdName, PFUNCPLUGINCMD pFunc, ShortcutKey
 void exportToMasterSDK();
 void exportAsIndividualFile();
 void exportEntireFileToSDK();  // New function for entire file conversion
+void exportEntireFileAsShards();
+void exportMatchingClasses();
+void editExportFilter();
+void cancelExport();
+
+//
+// Cancels a running export and waits for it; called when Notepad++ shuts down
+//
+void stopExportJob();
 
 //
 // Variables
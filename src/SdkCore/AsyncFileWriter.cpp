@@ -0,0 +1,79 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "AsyncFileWriter.h"
+#include "Instrument.h"
+
+AsyncFileWriter::AsyncFileWriter(FILE* out, size_t chunkSize, size_t maxQueued)
+    : _out(out), _chunkSize(chunkSize), _maxQueued(maxQueued) {
+    _chunk.reserve(_chunkSize);
+    _thread = std::thread([this] { run(); });
+}
+
+void AsyncFileWriter::write(std::string_view data) {
+    _chunk.append(data);
+    if (_chunk.size() >= _chunkSize) queueChunk();
+}
+
+void AsyncFileWriter::queueChunk() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    // Only a writer that is far behind applies back pressure
+    _drained.wait(lock, [this] { return _queue.size() < _maxQueued; });
+    _queue.push_back(std::move(_chunk));
+    if (!_spare.empty()) {
+        _chunk = std::move(_spare.back());
+        _spare.pop_back();
+    }
+    else {
+        _chunk = std::string();
+        _chunk.reserve(_chunkSize);
+    }
+    lock.unlock();
+    _ready.notify_one();
+}
+
+void AsyncFileWriter::finish() {
+    if (!_thread.joinable()) return;
+    if (!_chunk.empty()) queueChunk();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finishing = true;
+    }
+    _ready.notify_one();
+    _thread.join();
+}
+
+void AsyncFileWriter::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _ready.wait(lock, [this] { return !_queue.empty() || _finishing; });
+        if (_queue.empty()) return;
+
+        std::string chunk = std::move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        {
+            SDK_INSTRUMENT_STAGE(Write);
+            fwrite(chunk.data(), sizeof(char), chunk.size(), _out);
+        }
+        chunk.clear();
+        lock.lock();
+
+        _spare.push_back(std::move(chunk));
+        _drained.notify_one();
+    }
+}
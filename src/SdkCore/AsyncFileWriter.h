@@ -0,0 +1,61 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Buffered writer that hands full chunks to its own thread, so the code that
+// produces the text never waits on the disk unless the writer falls far behind.
+//
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+class AsyncFileWriter {
+public:
+    // `out` stays owned by the caller and must outlive finish()
+    explicit AsyncFileWriter(FILE* out, size_t chunkSize = 1 << 20, size_t maxQueued = 32);
+    ~AsyncFileWriter() { finish(); }
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    void write(std::string_view data);
+
+    // Writes everything still buffered and stops the thread
+    void finish();
+
+private:
+    void queueChunk();
+    void run();
+
+    FILE* _out;
+    size_t _chunkSize;
+    size_t _maxQueued;
+    std::string _chunk;
+    std::mutex _mutex;
+    std::condition_variable _ready;   // a chunk was queued, or finish() was called
+    std::condition_variable _drained; // a chunk was written
+    std::deque<std::string> _queue;
+    std::vector<std::string> _spare;  // written chunks kept for reuse
+    bool _finishing = false;
+    std::thread _thread;
+};
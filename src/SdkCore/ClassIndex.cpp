@@ -0,0 +1,120 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "ClassIndex.h"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include "DumpParser.h"
+
+bool globMatch(std::string_view pattern, std::string_view text) {
+    size_t p = 0, t = 0;
+    size_t starP = std::string_view::npos, starT = 0;
+    while (t < text.size()) {
+        if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t])) {
+            p++;
+            t++;
+        }
+        else if (p < pattern.size() && pattern[p] == '*') {
+            starP = p++;
+            starT = t;
+        }
+        else if (starP != std::string_view::npos) {
+            // Let the last '*' swallow one more character and retry
+            p = starP + 1;
+            t = ++starT;
+        }
+        else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') p++;
+    return p == pattern.size();
+}
+
+void ClassIndex::build(std::string_view dump) {
+    _byName.clear();
+
+    // Headers are rare compared to field lines, so skip ahead with a substring
+    // search instead of looking at every line
+    static constexpr std::string_view marker = "[Class]";
+    const std::boyer_moore_horspool_searcher searcher(marker.begin(), marker.end());
+
+    auto it = dump.begin();
+    while (true) {
+        it = std::search(it, dump.end(), searcher);
+        if (it == dump.end()) break;
+
+        size_t markerPos = static_cast<size_t>(it - dump.begin());
+        size_t lineStart = dump.rfind('\n', markerPos);
+        lineStart = lineStart == std::string_view::npos ? 0 : lineStart + 1;
+        size_t lineEnd = dump.find('\n', markerPos);
+        if (lineEnd == std::string_view::npos) lineEnd = dump.size();
+
+        DumpClassHeader header;
+        parseClassHeader(dump.substr(lineStart, lineEnd - lineStart), header);
+
+        // The previous block ends where this header line starts
+        if (!_byName.empty()) _byName.back().end = lineStart;
+        _byName.push_back({ header.name, lineStart, dump.size() });
+
+        it = dump.begin() + static_cast<std::ptrdiff_t>(lineEnd);
+    }
+
+    std::stable_sort(_byName.begin(), _byName.end(), [](const ClassSpan& a, const ClassSpan& b) {
+        return a.name < b.name;
+    });
+}
+
+size_t ClassIndex::lowerBound(std::string_view name) const {
+    auto it = std::lower_bound(_byName.begin(), _byName.end(), name, [](const ClassSpan& span, std::string_view value) {
+        return span.name < value;
+    });
+    return static_cast<size_t>(it - _byName.begin());
+}
+
+size_t ClassIndex::find(std::string_view name) const {
+    size_t i = lowerBound(name);
+    return i < _byName.size() && _byName[i].name == name ? i : _byName.size();
+}
+
+std::vector<ClassSpan> ClassIndex::matchPrefix(std::string_view prefix) const {
+    std::vector<ClassSpan> result;
+    for (size_t i = lowerBound(prefix); i < _byName.size() && _byName[i].name.substr(0, prefix.size()) == prefix; i++) {
+        result.push_back(_byName[i]);
+    }
+    return result;
+}
+
+std::vector<ClassSpan> ClassIndex::matchGlob(std::string_view pattern) const {
+    std::vector<ClassSpan> result;
+    for (size_t i : matchGlobPositions(pattern)) result.push_back(_byName[i]);
+    return result;
+}
+
+std::vector<size_t> ClassIndex::matchGlobPositions(std::string_view pattern) const {
+    // Without a wildcard only the exact name matches
+    size_t wildcard = pattern.find_first_of("*?");
+    std::string_view prefix = pattern.substr(0, wildcard);
+
+    std::vector<size_t> result;
+    for (size_t i = lowerBound(prefix); i < _byName.size() && _byName[i].name.substr(0, prefix.size()) == prefix; i++) {
+        const std::string_view name = _byName[i].name;
+        if (wildcard == std::string_view::npos ? name.size() == pattern.size() : globMatch(pattern, name)) result.push_back(i);
+    }
+    return result;
+}
@@ -0,0 +1,67 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Sorted index of the fully qualified class names in a dump, so namespace
+// wildcards ("EFT.InventoryLogic.*", "-.Player.*") resolve to the byte ranges
+// of the matching class blocks without parsing anything else.
+//
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// A class block: its "[Class]" line plus every line up to the next header
+struct ClassSpan {
+    std::string_view name; // points into the dump
+    size_t begin = 0;      // byte offset of the start of the header line
+    size_t end = 0;        // byte offset one past the block
+};
+
+// Glob match where '*' is any run of characters and '?' any single one
+bool globMatch(std::string_view pattern, std::string_view text);
+
+class ClassIndex {
+public:
+    // Finds every "[Class]" header in `dump`. The dump must outlive the index.
+    void build(std::string_view dump);
+
+    // Uses spans found elsewhere instead, e.g. in a SidecarIndex; they must be sorted by name
+    void assign(std::vector<ClassSpan> spans) { _byName = std::move(spans); }
+
+    size_t size() const { return _byName.size(); }
+    const std::vector<ClassSpan>& byName() const { return _byName; }
+
+    // Classes whose name starts with `prefix`, in name order
+    std::vector<ClassSpan> matchPrefix(std::string_view prefix) const;
+
+    // Classes matching a glob. Only the range sharing the pattern's literal
+    // prefix is examined, so the cost follows the matches, not the dump.
+    std::vector<ClassSpan> matchGlob(std::string_view pattern) const;
+
+    // Same as matchGlob(), returning positions in byName() instead of copies
+    std::vector<size_t> matchGlobPositions(std::string_view pattern) const;
+
+    // Position in byName() of the first class called `name`, or size() if there is none
+    size_t find(std::string_view name) const;
+
+private:
+    size_t lowerBound(std::string_view name) const;
+
+    std::vector<ClassSpan> _byName;
+};
@@ -0,0 +1,250 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "ColumnStore.h"
+#include <bit>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SDKCORE_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+uint32_t StringPool::intern(std::string_view s) {
+    auto it = _ids.find(s);
+    if (it != _ids.end()) return it->second;
+
+    // Copy the bytes into the current block, or a dedicated one for huge strings
+    char* dest;
+    if (s.size() > BLOCK_SIZE / 4) {
+        _blocks.emplace_back(new char[s.size()]);
+        dest = _blocks.back().get();
+        _blockUsed = BLOCK_SIZE; // the next small string starts a fresh block
+    }
+    else {
+        if (_blockUsed + s.size() > BLOCK_SIZE) {
+            _blocks.emplace_back(new char[BLOCK_SIZE]);
+            _blockUsed = 0;
+        }
+        dest = _blocks.back().get() + _blockUsed;
+        _blockUsed += s.size();
+    }
+    if (!s.empty()) std::memcpy(dest, s.data(), s.size());
+
+    uint32_t id = static_cast<uint32_t>(_strings.size());
+    std::string_view stored(dest, s.size());
+    _strings.push_back(stored);
+    _ids.emplace(stored, id);
+    return id;
+}
+
+uint32_t StringPool::find(std::string_view s) const {
+    auto it = _ids.find(s);
+    return it == _ids.end() ? NOT_FOUND : it->second;
+}
+
+void StringPool::clear() {
+    _blocks.clear();
+    _blockUsed = BLOCK_SIZE;
+    _strings.clear();
+    _ids.clear();
+}
+
+uint32_t ColumnStore::beginClass(std::string_view name) {
+    classNames.push_back(strings.intern(name));
+    return static_cast<uint32_t>(classNames.size() - 1);
+}
+
+void ColumnStore::addField(uint32_t cls, const DumpField& field) {
+    classId.push_back(cls);
+    offset.push_back(field.offset);
+    tag.push_back(static_cast<uint8_t>(field.tag));
+    nameId.push_back(strings.intern(field.name));
+    typeId.push_back(strings.intern(field.type));
+}
+
+void ColumnStore::dropLastClass(size_t fieldMark) {
+    classNames.pop_back();
+    classId.resize(fieldMark);
+    offset.resize(fieldMark);
+    tag.resize(fieldMark);
+    nameId.resize(fieldMark);
+    typeId.resize(fieldMark);
+}
+
+void ColumnStore::reserve(size_t fields) {
+    classId.reserve(fields);
+    offset.reserve(fields);
+    tag.reserve(fields);
+    nameId.reserve(fields);
+    typeId.reserve(fields);
+}
+
+void ColumnStore::clear() {
+    classId.clear();
+    offset.clear();
+    tag.clear();
+    nameId.clear();
+    typeId.clear();
+    classNames.clear();
+    strings.clear();
+}
+
+void ColumnStoreBuilder::onClass(const DumpClassHeader& header) {
+    // The key must outlive the dump text, so it is the interned copy
+    uint32_t nameId = _store.strings.intern(header.name);
+    std::string_view key = _store.strings.str(nameId);
+    if (_seen.find(key) != _seen.end()) {
+        _insideClass = false;
+        return;
+    }
+    _currentClass = _store.beginClass(key);
+    _seen.emplace(key, _currentClass);
+    _insideClass = true;
+}
+
+void ColumnStoreBuilder::onField(const DumpField& field) {
+    if (_insideClass) _store.addField(_currentClass, field);
+}
+
+// Helper function to append the row indices of the set bits in a compare mask
+static inline size_t emitMask(unsigned mask, uint32_t base, uint32_t* out, size_t n) {
+    while (mask) {
+        out[n++] = base + static_cast<uint32_t>(std::countr_zero(mask));
+        mask &= mask - 1;
+    }
+    return n;
+}
+
+size_t selectEqual(const uint32_t* column, size_t count, uint32_t value, uint32_t* out) {
+    size_t n = 0;
+    size_t i = 0;
+#ifdef SDKCORE_HAVE_SSE2
+    const __m128i needle = _mm_set1_epi32(static_cast<int>(value));
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(column + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle))));
+        n = emitMask(mask, static_cast<uint32_t>(i), out, n);
+    }
+#endif
+    for (; i < count; i++) {
+        out[n] = static_cast<uint32_t>(i);
+        n += column[i] == value;
+    }
+    return n;
+}
+
+size_t selectEqual(const uint8_t* column, size_t count, uint8_t value, uint32_t* out) {
+    size_t n = 0;
+    size_t i = 0;
+#ifdef SDKCORE_HAVE_SSE2
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+    for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(column + i));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+        n = emitMask(mask, static_cast<uint32_t>(i), out, n);
+    }
+#endif
+    for (; i < count; i++) {
+        out[n] = static_cast<uint32_t>(i);
+        n += column[i] == value;
+    }
+    return n;
+}
+
+size_t selectAtLeast(const uint64_t* column, size_t count, uint64_t minValue, uint32_t* out) {
+    size_t n = 0;
+    size_t i = 0;
+#ifdef SDKCORE_HAVE_SSE2
+    //
+    // SSE2 has no 64-bit compare, so each half is compared on its own: flipping the
+    // sign bits turns the signed 32-bit compares into unsigned ones, and a value is
+    // at least minValue if its high half is greater, or equal with the low half at
+    // least as large. The answer ends up in the high half, whose sign bit movemask_pd reads.
+    //
+    const __m128i flip = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const __m128i needle = _mm_xor_si128(_mm_set1_epi64x(static_cast<long long>(minValue)), flip);
+    auto atLeast = [&](const uint64_t* values) {
+        __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)), flip);
+        __m128i greater = _mm_cmpgt_epi32(v, needle);
+        __m128i equal = _mm_cmpeq_epi32(v, needle);
+        __m128i lowAtLeast = _mm_shuffle_epi32(_mm_or_si128(greater, equal), _MM_SHUFFLE(2, 2, 0, 0));
+        __m128i result = _mm_or_si128(greater, _mm_and_si128(equal, lowAtLeast));
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(result)));
+    };
+    for (; i + 4 <= count; i += 4) {
+        unsigned mask = atLeast(column + i) | (atLeast(column + i + 2) << 2);
+        n = emitMask(mask, static_cast<uint32_t>(i), out, n);
+    }
+#endif
+    for (; i < count; i++) {
+        out[n] = static_cast<uint32_t>(i);
+        n += column[i] >= minValue;
+    }
+    return n;
+}
+
+size_t refineEqual(const uint32_t* column, const uint32_t* selection, size_t count, uint32_t value, uint32_t* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t row = selection[i];
+        out[n] = row;
+        n += column[row] == value;
+    }
+    return n;
+}
+
+size_t refineEqual(const uint8_t* column, const uint32_t* selection, size_t count, uint8_t value, uint32_t* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t row = selection[i];
+        out[n] = row;
+        n += column[row] == value;
+    }
+    return n;
+}
+
+size_t refineAtLeast(const uint64_t* column, const uint32_t* selection, size_t count, uint64_t minValue, uint32_t* out) {
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t row = selection[i];
+        out[n] = row;
+        n += column[row] >= minValue;
+    }
+    return n;
+}
+
+void tagHistogram(const uint8_t* tags, size_t count, size_t (&histogram)[FIELD_TAG_COUNT]) {
+    size_t statics = 0, consts = 0;
+    size_t i = 0;
+#ifdef SDKCORE_HAVE_SSE2
+    const __m128i staticTag = _mm_set1_epi8(static_cast<char>(FieldTag::Static));
+    const __m128i constTag = _mm_set1_epi8(static_cast<char>(FieldTag::Const));
+    for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tags + i));
+        statics += std::popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, staticTag))));
+        consts += std::popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, constTag))));
+    }
+#endif
+    for (; i < count; i++) {
+        statics += tags[i] == static_cast<uint8_t>(FieldTag::Static);
+        consts += tags[i] == static_cast<uint8_t>(FieldTag::Const);
+    }
+    histogram[static_cast<size_t>(FieldTag::Instance)] = count - statics - consts;
+    histogram[static_cast<size_t>(FieldTag::Static)] = statics;
+    histogram[static_cast<size_t>(FieldTag::Const)] = consts;
+}
@@ -0,0 +1,115 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Columnar (structure-of-arrays) view of a parsed dump, for bulk questions such as
+// "every field of type UnityEngine.Transform[]" or "every offset above 0x1000"
+// without going back to the text.
+//
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "DumpParser.h"
+
+//
+// Interns strings into dense 32-bit ids. The bytes live in large blocks owned by
+// the pool, so views returned by str() stay valid until clear().
+//
+class StringPool {
+public:
+    static constexpr uint32_t NOT_FOUND = 0xFFFFFFFFu;
+
+    uint32_t intern(std::string_view s);
+    uint32_t find(std::string_view s) const;
+    std::string_view str(uint32_t id) const { return _strings[id]; }
+    size_t size() const { return _strings.size(); }
+    void clear();
+
+private:
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    size_t _blockUsed = BLOCK_SIZE;
+    std::vector<std::string_view> _strings;
+    std::unordered_map<std::string_view, uint32_t> _ids;
+};
+
+//
+// Parallel arrays, one entry per field. classId indexes classNames; nameId,
+// typeId and classNames index strings.
+//
+struct ColumnStore {
+    std::vector<uint32_t> classId;
+    std::vector<uint64_t> offset;
+    std::vector<uint8_t> tag;      // FieldTag
+    std::vector<uint32_t> nameId;
+    std::vector<uint32_t> typeId;
+
+    std::vector<uint32_t> classNames;
+    StringPool strings;
+
+    size_t fieldCount() const { return offset.size(); }
+    size_t classCount() const { return classNames.size(); }
+
+    uint32_t beginClass(std::string_view name);
+    void addField(uint32_t cls, const DumpField& field);
+    // Removes the most recent class and its fields, `fieldMark` being fieldCount() before it began
+    void dropLastClass(size_t fieldMark);
+    void reserve(size_t fields);
+    void clear();
+};
+
+//
+// Visitor for scanDump() that fills a ColumnStore on its own, for callers that
+// don't also export. Repeated class names are skipped like the SDK export does.
+//
+class ColumnStoreBuilder {
+public:
+    explicit ColumnStoreBuilder(ColumnStore& store) : _store(store) {}
+
+    void onClass(const DumpClassHeader& header);
+    void onField(const DumpField& field);
+
+private:
+    ColumnStore& _store;
+    std::unordered_map<std::string_view, uint32_t> _seen;
+    bool _insideClass = false;
+    uint32_t _currentClass = 0;
+};
+
+//
+// Scan/filter kernels. The select* functions write the indices of matching rows to
+// `out` (which must have room for `count` entries) and return how many matched.
+// The refine* variants do the same over an existing selection, so filters chain.
+// The select* kernels compare 16 bytes of the column at a time with SSE2 where
+// available. The refine* ones read the rows the selection points at, which SSE2
+// can't gather, so they are branch-free scalar loops.
+//
+size_t selectEqual(const uint32_t* column, size_t count, uint32_t value, uint32_t* out);
+size_t selectEqual(const uint8_t* column, size_t count, uint8_t value, uint32_t* out);
+size_t selectAtLeast(const uint64_t* column, size_t count, uint64_t minValue, uint32_t* out);
+
+size_t refineEqual(const uint32_t* column, const uint32_t* selection, size_t count, uint32_t value, uint32_t* out);
+size_t refineEqual(const uint8_t* column, const uint32_t* selection, size_t count, uint8_t value, uint32_t* out);
+size_t refineAtLeast(const uint64_t* column, const uint32_t* selection, size_t count, uint64_t minValue, uint32_t* out);
+
+// Counts how many fields carry each FieldTag
+void tagHistogram(const uint8_t* tags, size_t count, size_t (&histogram)[FIELD_TAG_COUNT]);
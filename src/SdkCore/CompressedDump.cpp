@@ -0,0 +1,340 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "CompressedDump.h"
+#include "Instrument.h"
+#include <algorithm>
+#include <climits>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifdef SDKCORE_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef SDKCORE_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef SDKCORE_WITH_LZMA
+#include <lzma.h>
+#endif
+
+DumpCompression sniffDumpCompression(std::string_view data) {
+    auto startsWith = [&](std::string_view magic) { return data.substr(0, magic.size()) == magic; };
+    if (startsWith(std::string_view("\x1F\x8B", 2))) return DumpCompression::Gzip;
+    if (startsWith(std::string_view("\x28\xB5\x2F\xFD", 4))) return DumpCompression::Zstd;
+    if (startsWith(std::string_view("\xFD" "7zXZ\x00", 6))) return DumpCompression::Xz;
+    return DumpCompression::None;
+}
+
+const char* dumpCompressionName(DumpCompression compression) {
+    switch (compression) {
+    case DumpCompression::Gzip: return "gzip";
+    case DumpCompression::Zstd: return "zstd";
+    case DumpCompression::Xz: return "xz";
+    default: return "none";
+    }
+}
+
+bool dumpCompressionSupported(DumpCompression compression) {
+    switch (compression) {
+#ifdef SDKCORE_WITH_ZLIB
+    case DumpCompression::Gzip: return true;
+#endif
+#ifdef SDKCORE_WITH_ZSTD
+    case DumpCompression::Zstd: return true;
+#endif
+#ifdef SDKCORE_WITH_LZMA
+    case DumpCompression::Xz: return true;
+#endif
+    case DumpCompression::None: return true;
+    default: return false;
+    }
+}
+
+namespace {
+
+constexpr size_t CHUNK_SIZE = 1 << 20;
+constexpr size_t MAX_QUEUED = 8;
+
+// Thrown on the decompressing thread when the parsing side has given up
+struct DecompressionCancelled {};
+
+// Chunks handed from the decompressing thread to the parsing one; buffers go
+// back and forth, so steady state decompression doesn't allocate
+class ChunkQueue {
+public:
+    // Decompressing side: blocks while the queue is full
+    void push(std::string& chunk) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _drained.wait(lock, [this] { return _queue.size() < MAX_QUEUED || _cancelled; });
+        if (_cancelled) throw DecompressionCancelled();
+        _queue.push_back(std::move(chunk));
+        if (!_spare.empty()) {
+            chunk = std::move(_spare.back());
+            _spare.pop_back();
+        }
+        else {
+            chunk = std::string();
+        }
+        lock.unlock();
+        _ready.notify_one();
+    }
+
+    void close(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _closed = true;
+            _error = error;
+        }
+        _ready.notify_one();
+    }
+
+    // Parsing side: returns false once the input has ended
+    bool pop(std::string& chunk) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _ready.wait(lock, [this] { return !_queue.empty() || _closed; });
+        if (_queue.empty()) return false;
+        if (chunk.capacity() > 0) _spare.push_back(std::move(chunk));
+        chunk = std::move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        _drained.notify_one();
+        return true;
+    }
+
+    void cancel() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _cancelled = true;
+        }
+        _drained.notify_one();
+    }
+
+    std::exception_ptr error() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _error;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::condition_variable _drained;
+    std::deque<std::string> _queue;
+    std::vector<std::string> _spare;
+    bool _closed = false;
+    bool _cancelled = false;
+    std::exception_ptr _error;
+};
+
+// Output side of a decoder: hands out free space in the current chunk and
+// queues the chunk once it is full
+class ChunkWriter {
+public:
+    explicit ChunkWriter(ChunkQueue& queue) : _queue(queue) {}
+
+    char* space(size_t& available) {
+        if (_used == _chunk.size()) flush();
+        available = _chunk.size() - _used;
+        return _chunk.data() + _used;
+    }
+
+    void commit(size_t bytes) { _used += bytes; }
+
+    void flush() {
+        if (_used > 0) {
+            _chunk.resize(_used);
+            _queue.push(_chunk);
+        }
+        _chunk.resize(CHUNK_SIZE);
+        _used = 0;
+    }
+
+private:
+    ChunkQueue& _queue;
+    std::string _chunk;
+    size_t _used = 0;
+};
+
+[[maybe_unused]] [[noreturn]] void throwCorrupt(DumpCompression compression, const char* detail) {
+    throw std::runtime_error(std::string("corrupt ") + dumpCompressionName(compression) + " dump" + (detail ? std::string(": ") + detail : ""));
+}
+
+#ifdef SDKCORE_WITH_ZLIB
+void decodeGzip(std::string_view data, ChunkWriter& writer) {
+    z_stream stream = {};
+    // 15 + 32: the largest window, with the gzip (or zlib) header detected automatically
+    if (inflateInit2(&stream, 15 + 32) != Z_OK) throw std::runtime_error("failed to start gzip decompression");
+    struct End {
+        z_stream& stream;
+        ~End() { inflateEnd(&stream); }
+    } end{ stream };
+
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(data.data());
+    size_t left = data.size();
+    while (true) {
+        // avail_in is 32 bits, so big dumps go in a gigabyte at a time
+        if (stream.avail_in == 0 && left > 0) {
+            uInt take = static_cast<uInt>(std::min<size_t>(left, 1u << 30));
+            stream.next_in = const_cast<unsigned char*>(input);
+            stream.avail_in = take;
+            input += take;
+            left -= take;
+        }
+        size_t available;
+        char* out = writer.space(available);
+        uInt room = static_cast<uInt>(std::min<size_t>(available, UINT_MAX));
+        stream.next_out = reinterpret_cast<unsigned char*>(out);
+        stream.avail_out = room;
+        int result = inflate(&stream, Z_NO_FLUSH);
+        writer.commit(room - stream.avail_out);
+
+        if (result == Z_STREAM_END) {
+            if (stream.avail_in == 0 && left == 0) return;
+            // gzip files may hold several members one after the other
+            if (inflateReset(&stream) != Z_OK) throwCorrupt(DumpCompression::Gzip, nullptr);
+        }
+        else if (result == Z_BUF_ERROR && stream.avail_in == 0 && left == 0) {
+            throwCorrupt(DumpCompression::Gzip, "unexpected end of data");
+        }
+        else if (result != Z_OK && result != Z_BUF_ERROR) {
+            throwCorrupt(DumpCompression::Gzip, stream.msg);
+        }
+    }
+}
+#endif
+
+#ifdef SDKCORE_WITH_ZSTD
+void decodeZstd(std::string_view data, ChunkWriter& writer) {
+    ZSTD_DStream* stream = ZSTD_createDStream();
+    if (!stream) throw std::runtime_error("failed to start zstd decompression");
+    struct End {
+        ZSTD_DStream* stream;
+        ~End() { ZSTD_freeDStream(stream); }
+    } end{ stream };
+    ZSTD_initDStream(stream);
+
+    // Concatenated frames are decoded one after the other by the same stream
+    ZSTD_inBuffer input = { data.data(), data.size(), 0 };
+    size_t hint = 1;
+    while (true) {
+        size_t available;
+        char* out = writer.space(available);
+        ZSTD_outBuffer output = { out, available, 0 };
+        hint = ZSTD_decompressStream(stream, &output, &input);
+        if (ZSTD_isError(hint)) throwCorrupt(DumpCompression::Zstd, ZSTD_getErrorName(hint));
+        writer.commit(output.pos);
+        // All input consumed and the output not filled: nothing is left inside the decoder
+        if (input.pos == input.size && output.pos < output.size) break;
+    }
+    if (hint != 0) throwCorrupt(DumpCompression::Zstd, "unexpected end of data");
+}
+#endif
+
+#ifdef SDKCORE_WITH_LZMA
+void decodeXz(std::string_view data, ChunkWriter& writer) {
+    lzma_stream stream = LZMA_STREAM_INIT;
+    if (lzma_stream_decoder(&stream, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) throw std::runtime_error("failed to start xz decompression");
+    struct End {
+        lzma_stream& stream;
+        ~End() { lzma_end(&stream); }
+    } end{ stream };
+
+    // The whole input is there from the start, so the decoder can be told it ends
+    stream.next_in = reinterpret_cast<const uint8_t*>(data.data());
+    stream.avail_in = data.size();
+    while (true) {
+        size_t available;
+        char* out = writer.space(available);
+        stream.next_out = reinterpret_cast<uint8_t*>(out);
+        stream.avail_out = available;
+        lzma_ret result = lzma_code(&stream, LZMA_FINISH);
+        writer.commit(available - stream.avail_out);
+        if (result == LZMA_STREAM_END) return;
+        if (result == LZMA_BUF_ERROR) throwCorrupt(DumpCompression::Xz, "unexpected end of data");
+        if (result != LZMA_OK) throwCorrupt(DumpCompression::Xz, nullptr);
+    }
+}
+#endif
+
+void decode([[maybe_unused]] std::string_view data, DumpCompression compression, [[maybe_unused]] ChunkWriter& writer) {
+    switch (compression) {
+#ifdef SDKCORE_WITH_ZLIB
+    case DumpCompression::Gzip: decodeGzip(data, writer); break;
+#endif
+#ifdef SDKCORE_WITH_ZSTD
+    case DumpCompression::Zstd: decodeZstd(data, writer); break;
+#endif
+#ifdef SDKCORE_WITH_LZMA
+    case DumpCompression::Xz: decodeXz(data, writer); break;
+#endif
+    default: break;
+    }
+}
+
+} // namespace
+
+void decompressDump(std::string_view data, DumpCompression compression, const std::function<void(std::string_view chunk)>& onChunk) {
+    if (compression == DumpCompression::None) {
+        for (size_t pos = 0; pos < data.size(); pos += CHUNK_SIZE) onChunk(data.substr(pos, CHUNK_SIZE));
+        return;
+    }
+    if (!dumpCompressionSupported(compression)) {
+        throw std::runtime_error(std::string("this build can't read ") + dumpCompressionName(compression)
+                                 + " compressed dumps; decompress it first");
+    }
+
+    ChunkQueue queue;
+    std::thread decompressor([&] {
+        try {
+            SDK_INSTRUMENT_STAGE(Decode);
+            ChunkWriter writer(queue);
+            decode(data, compression, writer);
+            writer.flush();
+            queue.close(nullptr);
+        }
+        catch (const DecompressionCancelled&) {
+            queue.close(nullptr);
+        }
+        catch (...) {
+            queue.close(std::current_exception());
+        }
+    });
+
+    try {
+        std::string chunk;
+        while (queue.pop(chunk)) onChunk(chunk);
+    }
+    catch (...) {
+        queue.cancel();
+        decompressor.join();
+        throw;
+    }
+    decompressor.join();
+    if (std::exception_ptr error = queue.error()) std::rethrow_exception(error);
+}
+
+std::string decompressDumpToString(std::string_view data, DumpCompression compression) {
+    std::string text;
+    decompressDump(data, compression, [&](std::string_view chunk) { text.append(chunk); });
+    return text;
+}
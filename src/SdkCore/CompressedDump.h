@@ -0,0 +1,151 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Compressed dumps (.gz, .zst, .xz), recognised by their magic bytes rather than
+// their name. Decompression runs on a thread of its own and hands the text over
+// in chunks, so scanCompressedDump() parses while the next chunk is being
+// decompressed and never holds the whole dump in memory.
+//
+// Each codec is compiled in only when the build defines its flag and links the
+// library: SDKCORE_WITH_ZLIB (zlib), SDKCORE_WITH_ZSTD (libzstd) and
+// SDKCORE_WITH_LZMA (liblzma). Without it such dumps are still recognised, and
+// rejected with an error naming the missing codec.
+//
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include "DumpParser.h"
+
+enum class DumpCompression : uint8_t {
+    None,
+    Gzip,
+    Zstd,
+    Xz,
+};
+
+// Recognises a compressed dump from its first bytes
+DumpCompression sniffDumpCompression(std::string_view data);
+
+// "gzip", "zstd", "xz", or "none"
+const char* dumpCompressionName(DumpCompression compression);
+
+// True if this build can decompress the format
+bool dumpCompressionSupported(DumpCompression compression);
+
+//
+// Decompresses `data` on another thread and calls onChunk() on the calling
+// thread with consecutive pieces of the text, each valid only during the call.
+// Throws std::runtime_error if the format isn't supported or the data is corrupt.
+//
+void decompressDump(std::string_view data, DumpCompression compression, const std::function<void(std::string_view chunk)>& onChunk);
+
+// Same, into a single string, for commands that need the whole text at once
+std::string decompressDumpToString(std::string_view data, DumpCompression compression);
+
+//
+// Feeds text arriving in arbitrary chunks to scanDump() in runs of whole class
+// blocks, cut just before a "[Class]" header line. A run stays in memory until
+// the next one has been scanned, so the visitor may keep views into a class
+// until the next class header arrives, as with scanDump() over the whole text;
+// the last run lives as long as the scanner.
+//
+template <typename Visitor>
+class DumpStreamScanner {
+public:
+    explicit DumpStreamScanner(Visitor& visitor) : _visitor(visitor) {}
+
+    void feed(std::string_view chunk) {
+        _pending.append(chunk);
+        // Cut before the last header seen so far; everything before it is complete
+        size_t cut = lastHeaderLine(_pending, _scannedTo);
+        _scannedTo = _pending.size();
+        if (cut == 0 || cut == std::string::npos) return;
+        scanRun(cut);
+    }
+
+    // Scans whatever is left; call once the input has ended
+    void finish() {
+        if (!_pending.empty()) scanRun(_pending.size());
+    }
+
+private:
+    // Helper function to find the start of the last line holding "[Class]", looking
+    // only at text from `from` on (less a marker's length, which may straddle it)
+    static size_t lastHeaderLine(std::string_view text, size_t from) {
+        size_t start = from > 7 ? from - 7 : 0;
+        size_t marker = text.substr(start).rfind("[Class]");
+        if (marker == std::string_view::npos) return std::string_view::npos;
+        size_t lineStart = text.rfind('\n', start + marker);
+        return lineStart == std::string_view::npos ? 0 : lineStart + 1;
+    }
+
+    void scanRun(size_t length) {
+        // The previous run is released only now, after the visitor has moved past it
+        _previous.swap(_current);
+        _current.assign(_pending, 0, length);
+        _pending.erase(0, length);
+        _scannedTo = _pending.size();
+        scanDump(_current, _visitor);
+    }
+
+    Visitor& _visitor;
+    std::string _pending;   // text after the last cut
+    std::string _current;   // the run being scanned
+    std::string _previous;  // the run before it
+    size_t _scannedTo = 0;  // how much of _pending was already searched for headers
+};
+
+//
+// Parses a compressed dump the way scanDump() parses plain text. The text is gone
+// once this returns, so a visitor still holding views into the last class must
+// be done with them in atEnd(), which runs while they are valid.
+//
+template <typename Visitor, typename AtEnd>
+void scanCompressedDump(std::string_view data, DumpCompression compression, Visitor& visitor, AtEnd&& atEnd) {
+    DumpStreamScanner<Visitor> scanner(visitor);
+    decompressDump(data, compression, [&](std::string_view chunk) { scanner.feed(chunk); });
+    scanner.finish();
+    atEnd();
+}
+
+template <typename Visitor>
+void scanCompressedDump(std::string_view data, DumpCompression compression, Visitor& visitor) {
+    scanCompressedDump(data, compression, visitor, [] {});
+}
+
+// scanDump() for text that may be compressed, told apart by sniffDumpCompression()
+template <typename Visitor, typename AtEnd>
+void scanAnyDump(std::string_view data, Visitor& visitor, AtEnd&& atEnd) {
+    DumpCompression compression = sniffDumpCompression(data);
+    if (compression != DumpCompression::None) {
+        scanCompressedDump(data, compression, visitor, atEnd);
+        return;
+    }
+    scanDump(data, visitor);
+    atEnd();
+}
+
+template <typename Visitor>
+void scanAnyDump(std::string_view data, Visitor& visitor) {
+    scanAnyDump(data, visitor, [] {});
+}
@@ -0,0 +1,529 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "DfaRegex.h"
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr size_t MAX_DFA_STATES = 4096;
+constexpr size_t MAX_NFA_STATES = 8192;
+constexpr int MAX_REPEAT = 1000;
+
+using ByteSet = std::bitset<256>;
+
+struct NfaState {
+    enum Kind { Bytes, Split, Epsilon, AssertStart, AssertEnd, Match } kind;
+    ByteSet bytes;
+    int out = -1;
+    int out1 = -1;
+};
+
+constexpr bool isAsciiAlpha(int b) { return (b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z'); }
+constexpr bool isAsciiDigit(int b) { return b >= '0' && b <= '9'; }
+
+// The byte if `set` holds exactly one, else -1
+int onlyByte(const ByteSet& set) {
+    if (set.count() != 1) return -1;
+    int b = 0;
+    while (!set.test(static_cast<size_t>(b))) b++;
+    return b;
+}
+
+// Thompson construction fragment: entry state plus the exits still to be patched
+struct Fragment {
+    int start;
+    std::vector<std::pair<int, int>> exits; // (state, 0 = out / 1 = out1)
+};
+
+// Recursive descent parser producing a Thompson NFA
+class NfaBuilder {
+public:
+    explicit NfaBuilder(std::string_view pattern) : _pattern(pattern) {}
+
+    std::vector<NfaState> build(int& start) {
+        Fragment whole = parseAlternation();
+        if (_pos < _pattern.size()) fail("unexpected ')'");
+        int match = addState(NfaState::Match);
+        patch(whole, match);
+        start = whole.start;
+        return std::move(_states);
+    }
+
+private:
+    [[noreturn]] void fail(const char* what) const {
+        throw std::runtime_error(std::string("regex: ") + what + " at position " + std::to_string(_pos) + " in \"" + std::string(_pattern) + "\"");
+    }
+
+    [[noreturn]] void unsupported(const std::string& construct) const {
+        fail(("unsupported construct " + construct).c_str());
+    }
+
+    int addState(NfaState::Kind kind) {
+        NfaState s;
+        s.kind = kind;
+        _states.push_back(s);
+        return static_cast<int>(_states.size() - 1);
+    }
+
+    void patch(const Fragment& f, int target) {
+        for (auto& exit : f.exits) {
+            if (exit.second == 0) _states[exit.first].out = target;
+            else _states[exit.first].out1 = target;
+        }
+    }
+
+    Fragment byteFragment(const ByteSet& bytes) {
+        int s = addState(NfaState::Bytes);
+        _states[s].bytes = bytes;
+        return { s, { { s, 0 } } };
+    }
+
+    Fragment parseAlternation() {
+        Fragment left = parseConcatenation();
+        while (_pos < _pattern.size() && _pattern[_pos] == '|') {
+            _pos++;
+            Fragment right = parseConcatenation();
+            int split = addState(NfaState::Split);
+            _states[split].out = left.start;
+            _states[split].out1 = right.start;
+            left.start = split;
+            left.exits.insert(left.exits.end(), right.exits.begin(), right.exits.end());
+        }
+        return left;
+    }
+
+    Fragment parseConcatenation() {
+        int eps = addState(NfaState::Epsilon);
+        Fragment result{ eps, { { eps, 0 } } };
+        while (_pos < _pattern.size() && _pattern[_pos] != '|' && _pattern[_pos] != ')') {
+            Fragment next = parseRepeat();
+            patch(result, next.start);
+            result.exits = std::move(next.exits);
+        }
+        return result;
+    }
+
+    // Copies `f`, whose states are those in [first, last); the copy is left unpatched
+    Fragment clone(const Fragment& f, size_t first, size_t last) {
+        int delta = static_cast<int>(_states.size() - first);
+        for (size_t i = first; i < last; i++) {
+            NfaState s = _states[i];
+            if (s.out >= 0) s.out += delta;
+            if (s.out1 >= 0) s.out1 += delta;
+            _states.push_back(s);
+        }
+        if (_states.size() > MAX_NFA_STATES) fail("pattern is too complex");
+        Fragment copy{ f.start + delta, f.exits };
+        for (auto& exit : copy.exits) exit.first += delta;
+        return copy;
+    }
+
+    Fragment star(Fragment f) {
+        int split = addState(NfaState::Split);
+        _states[split].out = f.start;
+        patch(f, split);
+        return { split, { { split, 1 } } };
+    }
+
+    Fragment plus(Fragment f) {
+        int split = addState(NfaState::Split);
+        _states[split].out = f.start;
+        patch(f, split);
+        f.exits = { { split, 1 } };
+        return f;
+    }
+
+    Fragment optional(Fragment f) {
+        int split = addState(NfaState::Split);
+        _states[split].out = f.start;
+        f.start = split;
+        f.exits.push_back({ split, 1 });
+        return f;
+    }
+
+    int parseNumber() {
+        size_t begin = _pos;
+        int value = 0;
+        while (_pos < _pattern.size() && _pattern[_pos] >= '0' && _pattern[_pos] <= '9') {
+            value = value * 10 + (_pattern[_pos++] - '0');
+            if (value > MAX_REPEAT) fail("repeat count is too large");
+        }
+        if (_pos == begin) fail("invalid repeat count");
+        return value;
+    }
+
+    //
+    // Applies the "{n}", "{n,}" or "{n,m}" at _pos to `atom`, whose states are
+    // those from `first` on: n copies of it, then x* or m - n optional copies.
+    //
+    Fragment parseCount(const Fragment& atom, size_t first) {
+        _pos++;
+        int min = parseNumber();
+        int max = min;
+        if (_pos < _pattern.size() && _pattern[_pos] == ',') {
+            _pos++;
+            max = _pos < _pattern.size() && _pattern[_pos] == '}' ? -1 : parseNumber();
+        }
+        if (_pos >= _pattern.size() || _pattern[_pos] != '}' || (max >= 0 && max < min)) fail("invalid repeat count");
+        _pos++;
+
+        size_t last = _states.size();
+        int eps = addState(NfaState::Epsilon);
+        Fragment result{ eps, { { eps, 0 } } };
+        auto append = [&](Fragment next) {
+            patch(result, next.start);
+            result.exits = std::move(next.exits);
+        };
+        for (int i = 0; i < min; i++) append(clone(atom, first, last));
+        if (max < 0) append(star(clone(atom, first, last)));
+        for (int i = min; i < max; i++) append(optional(clone(atom, first, last)));
+        return result;
+    }
+
+    Fragment parseRepeat() {
+        bool assertion = _pattern[_pos] == '^' || _pattern[_pos] == '$';
+        // Every state of the atom, repeated or not, is added from here on
+        size_t first = _states.size();
+        Fragment atom = parseAtom();
+        while (_pos < _pattern.size()) {
+            char q = _pattern[_pos];
+            if (q != '*' && q != '+' && q != '?' && q != '{') break;
+            if (assertion) fail("nothing to repeat");
+            if (q == '{') {
+                atom = parseCount(atom, first);
+                continue;
+            }
+            _pos++;
+            if (q == '*') atom = star(atom);
+            else if (q == '+') atom = plus(atom);
+            else atom = optional(atom); // also a lazy "*?", which matches the same texts
+        }
+        return atom;
+    }
+
+    Fragment parseAtom() {
+        char c = _pattern[_pos++];
+        switch (c) {
+        case '(': {
+            if (_pos < _pattern.size() && _pattern[_pos] == '?') {
+                if (_pos + 1 >= _pattern.size() || _pattern[_pos + 1] != ':') unsupported(std::string(_pattern.substr(_pos - 1, 3)));
+                _pos += 2;
+            }
+            Fragment inner = parseAlternation();
+            if (_pos >= _pattern.size() || _pattern[_pos] != ')') fail("missing ')'");
+            _pos++;
+            return inner;
+        }
+        case '.': {
+            ByteSet any;
+            any.set();
+            any.reset('\n');
+            return byteFragment(any);
+        }
+        case '[':
+            return byteFragment(parseClass());
+        case '\\':
+            return byteFragment(parseEscape(false));
+        case '*': case '+': case '?': case '{':
+            _pos--;
+            fail("nothing to repeat");
+        case '^': case '$': {
+            // Zero-width: lets the search through only at the start or end of the text
+            int s = addState(c == '^' ? NfaState::AssertStart : NfaState::AssertEnd);
+            return { s, { { s, 0 } } };
+        }
+        default: {
+            ByteSet one;
+            one.set(static_cast<unsigned char>(c));
+            return byteFragment(one);
+        }
+        }
+    }
+
+    // Reads `digits` hex digits as a character code
+    unsigned parseHex(size_t digits, const char* escape) {
+        if (_pos + digits > _pattern.size()) fail(escape);
+        unsigned value = 0;
+        for (size_t i = 0; i < digits; i++) {
+            char h = _pattern[_pos++];
+            unsigned digit = h >= '0' && h <= '9' ? unsigned(h - '0') : h >= 'a' && h <= 'f' ? unsigned(h - 'a' + 10) : h >= 'A' && h <= 'F' ? unsigned(h - 'A' + 10) : 16u;
+            if (digit == 16) fail(escape);
+            value = value * 16 + digit;
+        }
+        return value;
+    }
+
+    //
+    // A letter or digit after a backslash means only what is listed here; the
+    // others throw, as std::regex implementations don't agree on them. Any other
+    // character stands for itself, e.g. "\." or "\{".
+    //
+    ByteSet parseEscape(bool inClass) {
+        if (_pos >= _pattern.size()) fail("trailing backslash");
+        char e = _pattern[_pos++];
+        ByteSet set;
+        switch (e) {
+        case 'd': case 'D':
+            for (int b = '0'; b <= '9'; b++) set.set(static_cast<size_t>(b));
+            if (e == 'D') set.flip();
+            break;
+        case 'w': case 'W':
+            for (int b = 0; b < 256; b++) {
+                if ((b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z') || (b >= '0' && b <= '9') || b == '_') set.set(static_cast<size_t>(b));
+            }
+            if (e == 'W') set.flip();
+            break;
+        case 's': case 'S':
+            for (char b : std::string_view(" \t\r\n\v\f")) set.set(static_cast<unsigned char>(b));
+            if (e == 'S') set.flip();
+            break;
+        case 'n': set.set('\n'); break;
+        case 'r': set.set('\r'); break;
+        case 't': set.set('\t'); break;
+        case 'f': set.set('\f'); break;
+        case 'v': set.set('\v'); break;
+        case 'x': set.set(parseHex(2, "\\x needs two hex digits")); break;
+        case 'u': {
+            unsigned code = parseHex(4, "\\u needs four hex digits");
+            if (code > 0x7F) unsupported("\\u above \\u007F");
+            set.set(code);
+            break;
+        }
+        case '0':
+            if (_pos < _pattern.size() && _pattern[_pos] >= '0' && _pattern[_pos] <= '9') unsupported("octal escape");
+            set.set(0);
+            break;
+        case 'b':
+            // A backspace in a class, a word boundary outside
+            if (!inClass) unsupported("\\b (word boundary)");
+            set.set('\b');
+            break;
+        default:
+            if (e >= '1' && e <= '9') unsupported(std::string("\\") + e + " (backreference)");
+            if (isAsciiAlpha(e)) unsupported(std::string("\\") + e);
+            set.set(static_cast<unsigned char>(e));
+            break;
+        }
+        return set;
+    }
+
+    // Parses a "[:name:]" inside a class into its bytes; only ASCII bytes ever belong to one
+    ByteSet parseNamedClass() {
+        size_t end = _pattern.find(":]", _pos + 2);
+        if (end == std::string_view::npos) fail("missing ':]'");
+        std::string_view name = _pattern.substr(_pos + 2, end - _pos - 2);
+        bool (*test)(int) = nullptr;
+        static constexpr std::pair<std::string_view, bool (*)(int)> classes[] = {
+            { "alnum", [](int b) { return isAsciiAlpha(b) || isAsciiDigit(b); } },
+            { "alpha", [](int b) { return isAsciiAlpha(b); } },
+            { "blank", [](int b) { return b == ' ' || b == '\t'; } },
+            { "cntrl", [](int b) { return b < 0x20 || b == 0x7F; } },
+            { "digit", [](int b) { return isAsciiDigit(b); } },
+            { "graph", [](int b) { return b > 0x20 && b < 0x7F; } },
+            { "lower", [](int b) { return b >= 'a' && b <= 'z'; } },
+            { "print", [](int b) { return b >= 0x20 && b < 0x7F; } },
+            { "punct", [](int b) { return b > 0x20 && b < 0x7F && !isAsciiAlpha(b) && !isAsciiDigit(b); } },
+            { "space", [](int b) { return b == ' ' || (b >= '\t' && b <= '\r'); } },
+            { "upper", [](int b) { return b >= 'A' && b <= 'Z'; } },
+            { "xdigit", [](int b) { return isAsciiDigit(b) || (b >= 'a' && b <= 'f') || (b >= 'A' && b <= 'F'); } },
+        };
+        for (const auto& named : classes) {
+            if (named.first == name) test = named.second;
+        }
+        if (!test) fail("unknown character class");
+        _pos = end + 2;
+        ByteSet set;
+        for (int b = 0; b < 0x80; b++) {
+            if (test(b)) set.set(static_cast<size_t>(b));
+        }
+        return set;
+    }
+
+    // Parses one member of a class: a byte, an escape or a "[:name:]"
+    ByteSet parseClassAtom() {
+        char c = _pattern[_pos];
+        if (c == '[' && _pos + 1 < _pattern.size()) {
+            char kind = _pattern[_pos + 1];
+            if (kind == ':') return parseNamedClass();
+            if (kind == '=' || kind == '.') unsupported("collating element or equivalence class");
+        }
+        _pos++;
+        if (c == '\\') return parseEscape(true);
+        ByteSet one;
+        one.set(static_cast<unsigned char>(c));
+        return one;
+    }
+
+    ByteSet parseClass() {
+        ByteSet set;
+        bool negate = _pos < _pattern.size() && _pattern[_pos] == '^';
+        if (negate) _pos++;
+        bool first = true;
+        while (true) {
+            if (_pos >= _pattern.size()) fail("missing ']'");
+            if (_pattern[_pos] == ']' && !first) {
+                _pos++;
+                break;
+            }
+            first = false;
+            ByteSet lo = parseClassAtom();
+            if (_pos + 1 < _pattern.size() && _pattern[_pos] == '-' && _pattern[_pos + 1] != ']') {
+                _pos++;
+                if (_pos >= _pattern.size()) fail("missing ']'");
+                ByteSet hi = parseClassAtom();
+                int from = onlyByte(lo), to = onlyByte(hi);
+                if (from < 0 || to < 0 || to < from) fail("invalid range in character class");
+                for (int b = from; b <= to; b++) set.set(static_cast<size_t>(b));
+            }
+            else {
+                set |= lo;
+            }
+        }
+        if (negate) set.flip();
+        return set;
+    }
+
+    std::string_view _pattern;
+    size_t _pos = 0;
+    std::vector<NfaState> _states;
+};
+
+//
+// Adds `state` and everything reachable from it without consuming input. '^'
+// is passed only `atStart` and '$' only `atEnd`; a '$' met elsewhere stays in
+// the set, as whether it holds depends on whether more input follows.
+//
+void addClosure(const std::vector<NfaState>& nfa, int state, bool atStart, bool atEnd, std::vector<uint8_t>& seen, std::vector<int>& set) {
+    if (state < 0 || seen[static_cast<size_t>(state)]) return;
+    seen[static_cast<size_t>(state)] = 1;
+    const NfaState& s = nfa[static_cast<size_t>(state)];
+    switch (s.kind) {
+    case NfaState::Split:
+        addClosure(nfa, s.out, atStart, atEnd, seen, set);
+        addClosure(nfa, s.out1, atStart, atEnd, seen, set);
+        break;
+    case NfaState::Epsilon:
+        addClosure(nfa, s.out, atStart, atEnd, seen, set);
+        break;
+    case NfaState::AssertStart:
+        if (atStart) addClosure(nfa, s.out, atStart, atEnd, seen, set);
+        break;
+    case NfaState::AssertEnd:
+        if (atEnd) addClosure(nfa, s.out, atStart, atEnd, seen, set);
+        else set.push_back(state);
+        break;
+    default:
+        set.push_back(state);
+        break;
+    }
+}
+
+// True if `set` contains the match state
+bool containsMatch(const std::vector<NfaState>& nfa, const std::vector<int>& set) {
+    for (int s : set) {
+        if (nfa[static_cast<size_t>(s)].kind == NfaState::Match) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+DfaRegex::DfaRegex(std::string_view pattern) {
+    int nfaStart = 0;
+    std::vector<NfaState> nfa = NfaBuilder(pattern).build(nfaStart);
+
+    // Subset construction. The NFA start is re-added after every byte, which
+    // turns the match into a search; past the first byte its '^' never holds.
+    std::map<std::vector<int>, int32_t> ids;
+    std::vector<std::vector<int>> sets;
+    std::vector<uint8_t> seen(nfa.size());
+
+    auto intern = [&](std::vector<int>& set) -> int32_t {
+        if (set.empty()) return DEAD;
+        std::sort(set.begin(), set.end());
+        auto it = ids.find(set);
+        if (it != ids.end()) return it->second;
+        if (sets.size() >= MAX_DFA_STATES) throw std::runtime_error("regex: pattern is too complex");
+        int32_t id = static_cast<int32_t>(sets.size());
+        ids.emplace(set, id);
+        sets.push_back(set);
+
+        // At the end of the text the pending '$' states hold as well
+        bool accepting = containsMatch(nfa, set);
+        bool acceptingAtEnd = accepting;
+        if (!accepting) {
+            std::vector<int> atEnd;
+            std::fill(seen.begin(), seen.end(), 0);
+            for (int s : set) {
+                if (nfa[static_cast<size_t>(s)].kind == NfaState::AssertEnd) addClosure(nfa, nfa[static_cast<size_t>(s)].out, false, true, seen, atEnd);
+            }
+            acceptingAtEnd = containsMatch(nfa, atEnd);
+        }
+        _accepting.push_back(accepting ? 1 : 0);
+        _acceptingAtEnd.push_back(acceptingAtEnd ? 1 : 0);
+        return id;
+    };
+
+    std::vector<int> emptyText;
+    addClosure(nfa, nfaStart, true, true, seen, emptyText);
+    _matchesEmpty = containsMatch(nfa, emptyText);
+
+    std::vector<int> startSet;
+    std::fill(seen.begin(), seen.end(), 0);
+    addClosure(nfa, nfaStart, true, false, seen, startSet);
+    _start = intern(startSet);
+
+    for (size_t d = 0; d < sets.size(); d++) {
+        _transitions.resize((d + 1) * 256, DEAD);
+        // Once a search has matched there is nothing left to decide
+        if (_accepting[d]) {
+            std::fill(_transitions.begin() + static_cast<ptrdiff_t>(d * 256), _transitions.end(), static_cast<int32_t>(d));
+            continue;
+        }
+        for (int b = 0; b < 256; b++) {
+            std::vector<int> next;
+            std::fill(seen.begin(), seen.end(), 0);
+            for (int s : sets[d]) {
+                const NfaState& st = nfa[static_cast<size_t>(s)];
+                if (st.kind == NfaState::Bytes && st.bytes.test(static_cast<size_t>(b))) addClosure(nfa, st.out, false, false, seen, next);
+            }
+            addClosure(nfa, nfaStart, false, false, seen, next);
+            int32_t target = intern(next);
+            _transitions[d * 256 + static_cast<size_t>(b)] = target;
+        }
+    }
+}
+
+bool DfaRegex::search(std::string_view text) const {
+    if (text.empty()) return _matchesEmpty;
+    int32_t state = _start;
+    if (state == DEAD) return false;
+    if (_accepting[static_cast<size_t>(state)]) return true;
+
+    const int32_t* table = _transitions.data();
+    for (char c : text) {
+        state = table[static_cast<size_t>(state) * 256 + static_cast<unsigned char>(c)];
+        if (state == DEAD) return false;
+        if (_accepting[static_cast<size_t>(state)]) return true;
+    }
+    return _acceptingAtEnd[static_cast<size_t>(state)] != 0;
+}
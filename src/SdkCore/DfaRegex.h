@@ -0,0 +1,53 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Small regular expression engine compiled ahead of time into a byte DFA, so
+// matching is one table lookup per input byte and never allocates.
+//
+// Supported: literals, '.', escapes (\. \\ \d \w \s \n \x41 \u0041 \0 and
+// friends), classes ([a-z_], [^...], [[:alpha:]]), groups ((...) and (?:...)),
+// '|', '*', '+', '?', '{n}', '{n,}', '{n,m}', and the anchors '^' and '$'
+// anywhere, e.g. "^System\.Action|Func$". Matching is a search with the
+// results of std::regex_search in its default ECMAScript mode. Anything else,
+// such as \b, backreferences or lookaheads, throws instead of being taken as
+// literal text.
+//
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class DfaRegex {
+public:
+    DfaRegex() = default;
+
+    // Throws std::runtime_error describing the problem if `pattern` can't be compiled
+    explicit DfaRegex(std::string_view pattern);
+
+    bool search(std::string_view text) const;
+
+private:
+    static constexpr int32_t DEAD = -1;
+
+    std::vector<int32_t> _transitions; // state * 256 + byte -> next state
+    std::vector<uint8_t> _accepting;      // a match has been seen, whatever follows
+    std::vector<uint8_t> _acceptingAtEnd; // a match if the text ends here
+    int32_t _start = DEAD;
+    bool _matchesEmpty = false;
+};
@@ -0,0 +1,490 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "DumpGenerator.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include "Hash.h"
+
+namespace {
+
+constexpr uint64_t GOLDEN = 0x9E3779B97F4A7C15ull;
+
+// Words for class, field and interface names, at most 11 characters each
+constexpr std::string_view WORDS[64] = {
+    "Player", "Body", "Inventory", "Weapon", "Sound", "Bank", "Hand", "Controller",
+    "Effect", "Grip", "Pose", "Sight", "Component", "Interactive", "Movement", "Context",
+    "Value", "Blender", "Loot", "Item", "Slot", "Magazine", "Ammo", "Health",
+    "Damage", "Audio", "Source", "Camera", "Transform", "Animator", "Physical", "Quest",
+    "Trader", "Profile", "Skill", "Armor", "Helmet", "Vest", "Backpack", "Stamina",
+    "Hydration", "Energy", "Event", "Callback", "State", "Cache", "Pool", "Manager",
+    "Handler", "Settings", "Template", "Owner", "Network", "Packet", "Data", "Info",
+    "Zone", "Door", "Switch", "Lamp", "Grenade", "Marker", "Bone", "Ragdoll",
+};
+
+// Pieces copied with one fixed-size move, then the cursor moves by their length
+struct Piece {
+    char text[24];
+    uint32_t length;
+};
+
+constexpr std::array<Piece, 64> WORD_PIECES = [] {
+    std::array<Piece, 64> pieces{};
+    for (size_t i = 0; i < pieces.size(); i++) {
+        for (size_t j = 0; j < WORDS[i].size(); j++) pieces[i].text[j] = WORDS[i][j];
+        pieces[i].length = static_cast<uint32_t>(WORDS[i].size());
+    }
+    return pieces;
+}();
+
+// Field name styles: _camelCase, PascalCase, m_Pascal and <Pascal>k__BackingField
+constexpr Piece NAME_PREFIXES[4] = { { "_", 1 }, { "", 0 }, { "m_", 2 }, { "<", 1 } };
+constexpr Piece NAME_SUFFIXES[4] = { { "", 0 }, { "", 0 }, { "", 0 }, { ">k__BackingField", 16 } };
+
+constexpr std::string_view NAMESPACES[8] = {
+    "-.", "-.", "-.", "EFT.", "EFT.InventoryLogic.", "EFT.Interactive.", "EFT.HealthSystem.", "Comfort.Common.",
+};
+
+constexpr std::string_view TYPES[32] = {
+    "Single", "Boolean", "Int32", "System.Int32", "String", "Single", "Boolean", "System.Byte",
+    "Double", "Int64", "UInt32", "IntPtr", "System.TimeSpan", "UnityEngine.Vector3", "UnityEngine.Vector2", "UnityEngine.Quaternion",
+    "UnityEngine.Transform", "UnityEngine.GameObject", "UnityEngine.AudioClip", "UnityEngine.Coroutine", "UnityEngine.LayerMask", "UnityEngine.Animator", "UnityEngine.Camera", "System.Action",
+    "System.Threading.CancellationTokenSource", "UnityEngine.Renderer", "UnityEngine.Collider", "UnityEngine.Rigidbody", "System.Object", "System.Guid", "Diz.Binding.BindableEvent", "Comfort.Common.Callback",
+};
+
+// Generic types taking one argument, then two
+constexpr std::string_view GENERICS[8] = {
+    "System.Action<", "System.Func<", "System.Collections.Generic.List<", "System.Collections.Generic.HashSet<",
+    "System.Action<", "System.Func<", "System.Collections.Generic.Dictionary<", "System.Collections.Generic.KeyValuePair<",
+};
+
+constexpr std::string_view ARGUMENTS[16] = {
+    "Single", "Int32", "Boolean", "String", "Player", "IPlayer", "Item", "SightComponent",
+    "Vector3", "Transform", "EFT.InventoryLogic.Item", "Byte", "Slot", "Int64", "Double", "GameObject",
+};
+
+struct RootClass {
+    std::string_view name;
+    uint32_t size;
+};
+
+constexpr RootClass ROOTS[4] = {
+    { "UnityEngine.MonoBehaviour", 0x18 }, { "System.Object", 0x10 }, { "UnityEngine.ScriptableObject", 0x18 }, { "", 0x10 },
+};
+
+constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
+
+// Per-class random numbers, so a repeated class comes out the same
+struct Random {
+    uint64_t state;
+    uint64_t next() { return hashMix(state += GOLDEN); }
+};
+
+inline char* put(char* p, std::string_view text) {
+    std::memcpy(p, text.data(), text.size());
+    return p + text.size();
+}
+
+inline char* put(char* p, const Piece& piece) {
+    std::memcpy(p, piece.text, sizeof(piece.text));
+    return p + piece.length;
+}
+
+// Uppercase hex with at least two digits, as the dumper writes offsets
+inline char* putHex(char* p, uint32_t value) {
+    char digits[16];
+    for (int i = 0; i < 8; i++) digits[i] = HEX_DIGITS[(value >> (28 - i * 4)) & 0xF];
+    const int count = std::max(2, (static_cast<int>(std::bit_width(value)) + 3) / 4);
+    std::memcpy(p, digits + 8 - count, 8);
+    return p + count;
+}
+
+inline char* putDecimal(char* p, uint64_t value) {
+    return std::to_chars(p, p + 20, value).ptr;
+}
+
+// A private-use name as the dumper escapes it, e.g. \uE7BE
+inline char* putEscape(char* p, uint64_t value) {
+    uint32_t code = 0xE000 + static_cast<uint32_t>(value % 0x1900);
+    *p++ = '\\';
+    *p++ = 'u';
+    for (int i = 3; i >= 0; i--) *p++ = HEX_DIGITS[(code >> (i * 4)) & 0xF];
+    return p;
+}
+
+inline char* putWords(char* p, uint64_t bits) {
+    p = put(p, WORD_PIECES[bits & 63]);
+    return put(p, WORD_PIECES[(bits >> 6) & 63]);
+}
+
+uint32_t threshold(double rate) {
+    if (!(rate > 0)) return 0;
+    return rate >= 1 ? 0x10000u : static_cast<uint32_t>(rate * 65536.0);
+}
+
+// Helper function to raise u in [0, 1) to `skew`. Whole and half skews (the
+// defaults among them) are multiplied out with sqrt(), which every platform
+// rounds the same, so those dumps are identical across maths libraries too.
+double skewUnit(double u, double skew) {
+    double twice = skew * 2.0;
+    if (twice != std::floor(twice) || skew < 0.5 || skew > 16.0) return std::pow(u, skew);
+    double result = twice - std::floor(skew) * 2.0 != 0.0 ? std::sqrt(u) : 1.0;
+    for (int i = static_cast<int>(skew); i > 0; i--) result *= u;
+    return result;
+}
+
+} // namespace
+
+bool parseGeneratorRange(std::string_view text, GeneratorRange& out) {
+    GeneratorRange range;
+    const char* p = text.data();
+    const char* end = p + text.size();
+    auto number = [&](uint32_t& value) {
+        auto result = std::from_chars(p, end, value);
+        if (result.ec != std::errc()) return false;
+        p = result.ptr;
+        return true;
+    };
+    if (!number(range.min)) return false;
+    range.max = range.min;
+    if (p < end && *p == '-') {
+        p++;
+        if (!number(range.max) || range.max < range.min) return false;
+    }
+    if (p < end && *p == '^') {
+        std::string skew(p + 1, end);
+        char* skewEnd = nullptr;
+        range.skew = strtod(skew.c_str(), &skewEnd);
+        if (skew.empty() || *skewEnd || !(range.skew > 0)) return false;
+        p = end;
+    }
+    if (p != end) return false;
+    out = range;
+    return true;
+}
+
+DumpGenerator::DumpGenerator(const DumpGeneratorOptions& options)
+    : _options(options), _state(hashMix(options.seed ^ GOLDEN)) {
+    _options.interfaces.max = std::min(_options.interfaces.max, 8u);
+    _options.interfaces.min = std::min(_options.interfaces.min, _options.interfaces.max);
+    _inherit = threshold(options.inheritRate);
+    _nested = threshold(options.nestedRate);
+    _escaped = threshold(options.escapedRate);
+    _const = threshold(options.constRate);
+    _static = std::min(threshold(options.staticRate), 0x10000u - _const);
+    _generic = threshold(options.genericRate);
+    _array = threshold(options.arrayRate);
+    _duplicate = threshold(options.duplicateRate);
+    _malformed = threshold(options.malformedRate);
+    buildTypes();
+}
+
+// The field types: generics, private-use and namespaced classes and common types,
+// in proportion to the rates
+void DumpGenerator::buildTypes() {
+    _types.resize(TYPE_COUNT);
+    Random random{ hashMix(_options.seed + 1) };
+    for (TypeName& type : _types) {
+        const uint64_t bits = random.next();
+        const uint32_t kind = static_cast<uint32_t>(bits >> 48);
+        char* p = type.text;
+        if (kind < _generic) {
+            const uint32_t generic = bits & 7;
+            p = put(p, GENERICS[generic]);
+            p = put(p, ARGUMENTS[(bits >> 3) & 15]);
+            if (generic >= 6 || ((bits >> 7) & 1)) {
+                p = put(p, ", ");
+                p = put(p, ARGUMENTS[(bits >> 8) & 15]);
+            }
+            *p++ = '>';
+        }
+        else if (kind < _generic + _escaped) {
+            p = put(p, "-.");
+            p = putEscape(p, bits >> 16);
+        }
+        else if (kind < _generic + _escaped + 0x1000) {
+            p = put(p, NAMESPACES[bits & 7]);
+            p = putWords(p, bits >> 16);
+        }
+        else p = put(p, TYPES[bits & 31]);
+        type.length = static_cast<uint32_t>(p - type.text);
+    }
+}
+
+uint64_t DumpGenerator::next() {
+    return hashMix(_state += GOLDEN);
+}
+
+uint32_t DumpGenerator::sample(const GeneratorRange& range) {
+    uint64_t bits = next();
+    if (range.max <= range.min) return range.min;
+    double u = static_cast<double>(bits >> 11) * 0x1p-53;
+    if (range.skew != 1.0) u = skewUnit(u, range.skew);
+    uint64_t value = range.min + static_cast<uint64_t>(u * (static_cast<double>(range.max - range.min) + 1.0));
+    return static_cast<uint32_t>(std::min<uint64_t>(value, range.max));
+}
+
+// Picks the next class's name, base, interfaces and layout
+void DumpGenerator::planClass(ClassRecord& record) {
+    const uint64_t index = _planned;
+    const size_t recent = static_cast<size_t>(std::min<uint64_t>(index, RING_SIZE - 1)); // not the slot being planned
+    auto ringAt = [&](uint64_t back) -> const ClassRecord& { return _ring[(index - 1 - back) % RING_SIZE]; };
+
+    char* p = put(record.header, "[Class] ");
+    const uint64_t bits = next();
+    if (recent && chance(_nested)) {
+        // "-.Outer.Inner", named after the last part of a recent class
+        const ClassRecord& outer = ringAt((bits >> 16) % recent);
+        std::string_view outerName(outer.header + 8, outer.nameLength);
+        p = put(p, "-.");
+        p = put(p, outerName.substr(outerName.find_last_of('.') + 1));
+        *p++ = '.';
+        if (chance(_escaped)) p = putEscape(p, index);
+        else p = putDecimal(putWords(p, bits), index);
+    }
+    else if (chance(_escaped)) {
+        p = put(p, "-.");
+        p = putEscape(p, index);
+        if (index >= 0x1900) p = putEscape(p, index / 0x1900);
+    }
+    else {
+        p = put(p, NAMESPACES[(bits >> 12) & 7]);
+        p = putDecimal(putWords(p, bits), index);
+    }
+    record.nameLength = static_cast<uint32_t>(p - record.header) - 8;
+
+    // Deep chains come from deriving mostly from the last few classes
+    const RootClass& root = ROOTS[(bits >> 20) & 3];
+    std::string_view base = root.name;
+    record.instanceStart = root.size;
+    record.depth = 0;
+    if (recent && chance(_inherit)) {
+        const ClassRecord& candidate = ringAt((bits >> 24) % std::min<size_t>(recent, 8));
+        if (candidate.depth < _options.maxDepth) {
+            base = std::string_view(candidate.header + 8, candidate.nameLength);
+            record.instanceStart = candidate.size;
+            record.depth = candidate.depth + 1;
+        }
+    }
+    uint32_t interfaces = sample(_options.interfaces);
+    if (!base.empty() || interfaces) {
+        p = put(p, " : ");
+        if (!base.empty()) p = put(p, base);
+        for (uint32_t i = 0; i < interfaces; i++) {
+            if (i || !base.empty()) p = put(p, ", ");
+            uint64_t word = next();
+            if (static_cast<uint32_t>(word >> 48) < _escaped) p = putEscape(p, word);
+            else {
+                *p++ = 'I';
+                p = put(p, WORDS[word & 63]);
+            }
+        }
+    }
+    record.headerLength = static_cast<uint32_t>(p - record.header);
+
+    record.fieldCount = sample(_options.fields);
+    uint32_t added = std::max(sample(_options.classSize), record.fieldCount * 4);
+    record.size = (record.instanceStart + added + 7) & ~7u;
+    record.bodySeed = next();
+}
+
+// Writes a class block; everything after the header comes from record.bodySeed
+char* DumpGenerator::writeClass(char* p, const ClassRecord& record, uint64_t& malformed) const {
+    p = put(p, std::string_view(record.header, record.headerLength));
+    *p++ = '\n';
+
+    Random random{ record.bodySeed };
+    std::string_view name(record.header + 8, record.nameLength);
+    std::string_view shortName = name.substr(name.find_last_of('.') + 1);
+
+    // Constants and statics come first, then instance fields by offset
+    const uint32_t fields = record.fieldCount;
+    const uint64_t rounding = random.next();
+    const uint32_t consts = static_cast<uint32_t>((uint64_t(fields) * _const + (rounding & 0xFFFF)) >> 16);
+    const uint32_t statics = std::min(fields - consts, static_cast<uint32_t>((uint64_t(fields) * _static + ((rounding >> 16) & 0xFFFF)) >> 16));
+    const uint32_t instances = fields - consts - statics;
+    const uint32_t span = record.size - record.instanceStart;
+    const uint32_t alignment = instances && span / instances >= 8 ? 8 : 4;
+    // Instance offsets spread evenly over the span, in 16.16 fixed point
+    const uint64_t step = instances ? (uint64_t(span) << 16) / instances : 0;
+    uint64_t position = uint64_t(record.instanceStart) << 16;
+
+    for (uint32_t i = 0; i < fields; i++) {
+        const uint64_t bits = random.next();
+        if (_malformed && static_cast<uint32_t>(bits >> 48) < _malformed) {
+            // A line every parser has to skip
+            const uint64_t kind = random.next();
+            p = put(p, "    ");
+            switch (kind % 5) {
+            case 0: *p++ = '['; p = putHex(p, i * 8); *p++ = ' '; p = putWords(p, kind >> 8); break;
+            case 1: p = put(p, "[0x"); p = putHex(p, i * 8); p = put(p, "] "); p = putWords(p, kind >> 8); p = put(p, " : Single"); break;
+            case 2: p = putWords(p, kind >> 8); p = put(p, " : Int32"); break;
+            case 3: *p++ = '['; p = putHex(p, i * 8); p = put(p, "][S] "); p = putWords(p, kind >> 8); break;
+            default: p = put(p, "<truncated>"); break;
+            }
+            *p++ = '\n';
+            malformed++;
+        }
+
+        p = put(p, "    [");
+        if (i < consts) p = put(p, "00][C] ");
+        else if (i < consts + statics) {
+            p = putHex(p, (i - consts) * 8);
+            p = put(p, "][S] ");
+        }
+        else {
+            p = putHex(p, static_cast<uint32_t>(position >> 16) & ~(alignment - 1));
+            position += step;
+            p = put(p, "] ");
+        }
+
+        // Name in one of the styles, or a private-use escape
+        if (static_cast<uint32_t>((bits >> 32) & 0xFFFF) < _escaped) p = putEscape(p, bits >> 12);
+        else {
+            const uint32_t style = (bits >> 12) & 3;
+            p = put(p, NAME_PREFIXES[style]);
+            char* first = p;
+            p = putWords(p, bits);
+            *first = static_cast<char>(*first | (style == 0 ? 0x20 : 0));
+            p = put(p, NAME_SUFFIXES[style]);
+        }
+        p = put(p, " : ");
+
+        // Type: one in sixteen is a class nested in this one, the rest come from the pool
+        const uint64_t typeBits = random.next();
+        if ((typeBits >> 60) == 0) {
+            p = put(p, "-.");
+            p = put(p, shortName);
+            *p++ = '.';
+            if ((typeBits >> 14) & 1) p = putEscape(p, typeBits >> 16);
+            else p = putWords(p, typeBits >> 16);
+        }
+        else {
+            const TypeName& type = _types[typeBits & (TYPE_COUNT - 1)];
+            std::memcpy(p, type.text, sizeof(type.text));
+            p += type.length;
+        }
+        std::memcpy(p, "[]", 2);
+        p += static_cast<uint32_t>(typeBits & 0xFFFF) < _array ? 2 : 0;
+        *p++ = '\n';
+    }
+    return p;
+}
+
+// Picks the next class: a new one, or with duplicateRate a recent one again
+const DumpGenerator::ClassRecord& DumpGenerator::nextClass(bool& duplicate) {
+    duplicate = _planned && chance(_duplicate);
+    if (duplicate) return _ring[(_planned - 1 - next() % std::min<uint64_t>(_planned, RING_SIZE - 1)) % RING_SIZE];
+    ClassRecord& planned = _ring[_planned % RING_SIZE];
+    planClass(planned);
+    _planned++;
+    return planned;
+}
+
+// Helper function to write a class at `pos`, growing `out` in large steps; returns the new end
+size_t DumpGenerator::appendClass(std::string& out, size_t pos, const ClassRecord& record, uint64_t& malformed) const {
+    const size_t bound = MAX_HEADER + size_t(record.fieldCount) * MAX_LINE * (_malformed ? 2 : 1);
+    if (out.size() - pos < bound) out.resize(std::max(pos + bound, out.size() + out.size() / 2));
+    return static_cast<size_t>(writeClass(out.data() + pos, record, malformed) - out.data());
+}
+
+void DumpGenerator::countClass(const ClassRecord& record, bool duplicate) {
+    _classCount++;
+    _duplicateCount += duplicate;
+    _fieldCount += record.fieldCount;
+}
+
+void DumpGenerator::generate(std::string& out, size_t bytes) {
+    size_t pos = out.size();
+    const size_t target = pos + bytes;
+    unsigned threads = _options.threads ? _options.threads : std::max(1u, std::thread::hardware_concurrency());
+    if (bytes < PARALLEL_BYTES) threads = 1;
+    // Trimmed at the end, so the text is zeroed once at most
+    out.resize(std::max(out.size(), target + (1 << 16)));
+
+    // Classes an earlier call picked but didn't need come first
+    while (pos < target && _pendingNext < _pending.size()) {
+        const PendingClass& pending = _pending[_pendingNext++];
+        pos = appendClass(out, pos, pending.record, _malformedCount);
+        countClass(pending.record, pending.duplicate);
+    }
+    if (_pendingNext == _pending.size()) {
+        _pending.clear();
+        _pendingNext = 0;
+    }
+
+    if (threads == 1) {
+        while (pos < target) {
+            bool duplicate;
+            const ClassRecord& record = nextClass(duplicate);
+            pos = appendClass(out, pos, record, _malformedCount);
+            countClass(record, duplicate);
+        }
+        out.resize(pos);
+        return;
+    }
+
+    // Classes are still picked one after another here; batches of them are then
+    // written on every core and appended in order up to the same class as above.
+    // The rest wait for the next call, so the text doesn't depend on the threads.
+    std::vector<PendingClass> batch;
+    std::vector<std::string> parts(threads);
+    std::vector<std::vector<std::pair<size_t, uint64_t>>> ends(threads); // end and malformed lines of each class
+    while (pos < target) {
+        batch.resize(threads * BATCH_CLASSES);
+        for (PendingClass& pending : batch) pending.record = nextClass(pending.duplicate);
+
+        auto work = [&](unsigned worker) {
+            const size_t begin = batch.size() * worker / threads, end = batch.size() * (worker + 1) / threads;
+            size_t at = 0;
+            parts[worker].clear();
+            ends[worker].clear();
+            for (size_t k = begin; k < end; k++) {
+                uint64_t malformed = 0;
+                at = appendClass(parts[worker], at, batch[k].record, malformed);
+                ends[worker].emplace_back(at, malformed);
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; t++) pool.emplace_back(work, t);
+        work(0);
+        for (std::thread& thread : pool) thread.join();
+
+        size_t k = 0;
+        for (unsigned worker = 0; worker < threads && pos < target; worker++) {
+            size_t used = 0;
+            for (const auto& [end, malformed] : ends[worker]) {
+                countClass(batch[k].record, batch[k].duplicate);
+                _malformedCount += malformed;
+                k++;
+                used = end;
+                if (pos + used >= target) break;
+            }
+            if (out.size() - pos < used) out.resize(std::max(pos + used, out.size() + out.size() / 2));
+            std::memcpy(out.data() + pos, parts[worker].data(), used);
+            pos += used;
+        }
+        _pending.assign(batch.begin() + static_cast<std::ptrdiff_t>(k), batch.end());
+    }
+    out.resize(pos);
+}
@@ -0,0 +1,144 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Synthetic Uninspect dumps for scale tests, in the dialect of "test file/example_txt":
+//     [Class] EFT.Weapon3 : EFT.Item2, IItemOwner, \uE7BE
+//         [00][C] MAX_STACK : Int32
+//         [08][S] OnChanged : System.Action<Single, Int32>
+//         [60] _grip : -.Weapon3.GripPose
+//         [68] <Magazine>k__BackingField : System.Collections.Generic.List<Item>[]
+// with constants, statics, generic and array types, private-use \uXXXX names,
+// nested "-.Outer.Inner" classes and inheritance chains whose instance fields
+// continue where the base class ends. A seed and the options fully determine the
+// output, however it is split across generate() calls and threads. Lines are
+// assembled from fixed-width pieces with few branches, one to two GB/s per core,
+// and large requests are written on every core.
+//
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A count drawn from [min, max]; skew > 1 favours small values (min + (max - min) * u^skew)
+struct GeneratorRange {
+    uint32_t min = 0;
+    uint32_t max = 0;
+    double skew = 1.0;
+};
+
+struct DumpGeneratorOptions {
+    uint64_t seed = 1;
+    GeneratorRange fields{ 1, 160, 2.5 };        // field lines per class
+    GeneratorRange classSize{ 8, 1024, 2.0 };    // bytes of instance fields a class adds to its base
+    GeneratorRange interfaces{ 0, 6, 3.0 };      // interfaces after the base class
+    uint32_t maxDepth = 12;        // longest inheritance chain
+    double inheritRate = 0.6;      // classes deriving from an earlier generated class
+    double nestedRate = 0.15;      // "-.Outer.Inner" classes
+    double escapedRate = 0.06;     // \uXXXX class, field and type names
+    double constRate = 0.08;       // [C] fields
+    double staticRate = 0.05;      // [S] fields
+    double genericRate = 0.12;     // generic field types
+    double arrayRate = 0.06;       // array field types
+    double duplicateRate = 0.0;    // classes repeated verbatim later on
+    double malformedRate = 0.0;    // lines the parsers must skip
+    unsigned threads = 0;          // 0: one per core; the output is the same either way
+};
+
+// Parses "min-max" or "min-max^skew" (a single number is a fixed count)
+bool parseGeneratorRange(std::string_view text, GeneratorRange& out);
+
+class DumpGenerator {
+public:
+    explicit DumpGenerator(const DumpGeneratorOptions& options);
+
+    // Appends whole classes to `out` until it has grown by at least `bytes`
+    void generate(std::string& out, size_t bytes);
+
+    uint64_t classCount() const { return _classCount; }
+    uint64_t duplicateCount() const { return _duplicateCount; }
+    uint64_t fieldCount() const { return _fieldCount; }
+    uint64_t malformedCount() const { return _malformedCount; }
+
+    // Longest header and field line generate() writes, in bytes
+    static constexpr size_t MAX_HEADER = 512;
+    static constexpr size_t MAX_LINE = 320;
+
+private:
+    struct ClassRecord {
+        char header[MAX_HEADER];   // "[Class] ..." without the newline
+        uint32_t headerLength = 0;
+        uint32_t nameLength = 0;   // the name starts after "[Class] "
+        uint32_t fieldCount = 0;
+        uint32_t instanceStart = 0;
+        uint32_t size = 0;         // where a derived class's fields start
+        uint32_t depth = 0;
+        uint64_t bodySeed = 0;
+    };
+
+    // A field type, padded so it is copied with a fixed-size move
+    struct TypeName {
+        char text[96];
+        uint32_t length;
+    };
+
+    uint64_t next();
+    bool chance(uint32_t threshold) { return static_cast<uint32_t>(next() >> 48) < threshold; }
+    uint32_t sample(const GeneratorRange& range);
+    void planClass(ClassRecord& record);
+    // A class picked for an earlier generate() call that ended before it
+    struct PendingClass {
+        ClassRecord record;
+        bool duplicate = false;
+    };
+
+    const ClassRecord& nextClass(bool& duplicate);
+    void countClass(const ClassRecord& record, bool duplicate);
+    size_t appendClass(std::string& out, size_t pos, const ClassRecord& record, uint64_t& malformed) const;
+    char* writeClass(char* p, const ClassRecord& record, uint64_t& malformed) const;
+    void buildTypes();
+
+    static constexpr size_t RING_SIZE = 64;   // recent classes, for bases, nesting and duplicates
+    static constexpr size_t TYPE_COUNT = 512; // a power of two
+    static constexpr size_t BATCH_CLASSES = 1024;        // per thread and batch
+    static constexpr size_t PARALLEL_BYTES = 16ull << 20; // smaller requests stay on the calling thread
+
+    DumpGeneratorOptions _options;
+    uint64_t _state;
+    // Rates as thresholds on 16 random bits
+    uint32_t _inherit, _nested, _escaped, _const, _static, _generic, _array, _duplicate, _malformed;
+    ClassRecord _ring[RING_SIZE];
+    std::vector<TypeName> _types;   // drawn once from the rates, so each field is a table lookup
+    std::vector<PendingClass> _pending;
+    size_t _pendingNext = 0;
+    uint64_t _planned = 0;          // classes picked, including pending ones
+    uint64_t _classCount = 0;
+    uint64_t _duplicateCount = 0;
+    uint64_t _fieldCount = 0;
+    uint64_t _malformedCount = 0;
+};
+
+// A dump of at least `bytes` bytes
+inline std::string generateDump(const DumpGeneratorOptions& options, size_t bytes) {
+    std::string out;
+    DumpGenerator(options).generate(out, bytes);
+    return out;
+}
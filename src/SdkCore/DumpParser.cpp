@@ -0,0 +1,90 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "DumpParser.h"
+
+static constexpr std::string_view CLASS_MARKER = "[Class]";
+
+// Helper function to decode a single hex digit, returns -1 if it is not one
+static inline int hexDigitValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool parseClassHeader(std::string_view line, DumpClassHeader& out) {
+    size_t classPos = line.find(CLASS_MARKER);
+    if (classPos == std::string_view::npos) return false;
+
+    out.line = trimView(line.substr(classPos));
+
+    std::string_view rest = out.line.substr(CLASS_MARKER.size());
+    size_t colonPos = rest.find(':');
+    if (colonPos != std::string_view::npos) {
+        out.name = trimView(rest.substr(0, colonPos));
+        out.bases = trimView(rest.substr(colonPos + 1));
+    }
+    else {
+        out.name = trimView(rest);
+        out.bases = std::string_view();
+    }
+    return true;
+}
+
+bool parseFieldLine(std::string_view line, DumpField& out) {
+    size_t offsetStart = line.find('[');
+    if (offsetStart == std::string_view::npos) return false;
+    size_t offsetEnd = line.find(']', offsetStart);
+    if (offsetEnd == std::string_view::npos || offsetEnd == offsetStart + 1) return false;
+
+    // Verify it's a valid hex offset; more than 16 digits wouldn't fit in 64 bits
+    std::string_view offsetText = line.substr(offsetStart + 1, offsetEnd - offsetStart - 1);
+    if (offsetText.size() > 16) return false;
+    uint64_t offset = 0;
+    for (char c : offsetText) {
+        int digit = hexDigitValue(c);
+        if (digit < 0) return false;
+        offset = (offset << 4) | static_cast<uint64_t>(digit);
+    }
+
+    // The [S] or [C] tag, if any, follows the offset directly. Brackets further
+    // along belong to the type ("Transform[]") and must not be taken as a tag.
+    FieldTag tag = FieldTag::Instance;
+    size_t fieldStart = offsetEnd + 1;
+    if (fieldStart < line.size() && line[fieldStart] == '[') {
+        size_t tagEnd = line.find(']', fieldStart);
+        if (tagEnd != std::string_view::npos) {
+            std::string_view tagText = line.substr(fieldStart + 1, tagEnd - fieldStart - 1);
+            if (tagText == "C") tag = FieldTag::Const;
+            else if (tagText == "S") tag = FieldTag::Static;
+            fieldStart = tagEnd + 1;
+        }
+    }
+
+    // Extract field name and type
+    std::string_view field = line.substr(fieldStart);
+    size_t colonPos = field.find(':');
+    if (colonPos == std::string_view::npos) return false;
+
+    out.offsetText = offsetText;
+    out.offset = offset;
+    out.tag = tag;
+    out.name = trimView(field.substr(0, colonPos));
+    out.type = trimView(field.substr(colonPos + 1));
+    return true;
+}
@@ -0,0 +1,120 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Portable parsing of Uninspect dump text. Nothing in SdkCore depends on
+// windows.h, so the same code drives the plugin and the command line tool.
+//
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "Instrument.h"
+
+// Field tags as they appear after the offset: "[10]", "[00][S]" or "[00][C]"
+enum class FieldTag : uint8_t {
+    Instance = 0,
+    Static = 1,
+    Const = 2,
+};
+
+constexpr size_t FIELD_TAG_COUNT = 3;
+
+// A "[Class] Name : Base, IInterface" header line
+struct DumpClassHeader {
+    std::string_view line;   // header text starting at "[Class]", trimmed
+    std::string_view name;   // "Name"
+    std::string_view bases;  // "Base, IInterface" (may be empty)
+};
+
+// A "[offset][tag] fieldName : fieldType" line
+struct DumpField {
+    std::string_view offsetText; // hex digits exactly as written in the dump
+    uint64_t offset = 0;
+    FieldTag tag = FieldTag::Instance;
+    std::string_view name;
+    std::string_view type;
+};
+
+// Helper function to trim ASCII whitespace (including the '\r' of CRLF dumps)
+inline std::string_view trimView(std::string_view s) {
+    size_t b = 0, e = s.size();
+    while (b < e && (s[b] == ' ' || s[b] == '\t' || s[b] == '\r' || s[b] == '\n' || s[b] == '\v' || s[b] == '\f')) b++;
+    while (e > b && (s[e - 1] == ' ' || s[e - 1] == '\t' || s[e - 1] == '\r' || s[e - 1] == '\n' || s[e - 1] == '\v' || s[e - 1] == '\f')) e--;
+    return s.substr(b, e - b);
+}
+
+// Returns the single-character label used for a tag in output and filters ("I", "S", "C")
+inline char fieldTagLetter(FieldTag tag) {
+    return tag == FieldTag::Const ? 'C' : tag == FieldTag::Static ? 'S' : 'I';
+}
+
+// Parses a class header. Returns false if the line has no "[Class]" marker.
+bool parseClassHeader(std::string_view line, DumpClassHeader& out);
+
+// Parses a field line. Returns false for anything that is not a valid field,
+// including an offset of more than 16 hex digits.
+bool parseFieldLine(std::string_view line, DumpField& out);
+
+//
+// Walks every line of a dump and reports class headers and fields to the visitor:
+//     void onClass(const DumpClassHeader& header);
+//     void onField(const DumpField& field);
+// Fields before the first class header are reported as well; visitors that care
+// track whether they are inside a class themselves. Lines may end in "\n" or
+// "\r\n"; run UTF-16 dumps through normalizeDumpText() (TextEncoding.h) first.
+//
+template <typename Visitor>
+void scanDump(std::string_view text, Visitor& visitor) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    DumpClassHeader header;
+    DumpField field;
+#if defined(SDKCORE_INSTRUMENT)
+    uint64_t blankLines = 0, unparsedLines = 0;
+#endif
+
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        const char* lineEnd = nl ? nl : end;
+        if (lineEnd > p && lineEnd[-1] == '\r') lineEnd--;
+        std::string_view line(p, static_cast<size_t>(lineEnd - p));
+        p = nl ? nl + 1 : end;
+
+        if (parseClassHeader(line, header)) {
+            visitor.onClass(header);
+        }
+        else if (parseFieldLine(line, field)) {
+            visitor.onField(field);
+        }
+#if defined(SDKCORE_INSTRUMENT)
+        else if (trimView(line).empty()) {
+            blankLines++;
+        }
+        else {
+            unparsedLines++;
+        }
+#endif
+    }
+
+#if defined(SDKCORE_INSTRUMENT)
+    SDK_INSTRUMENT_COUNT(BytesIn, text.size());
+    if (blankLines) SDK_INSTRUMENT_COUNT(BlankLines, blankLines);
+    if (unparsedLines) SDK_INSTRUMENT_COUNT(UnparsedLines, unparsedLines);
+#endif
+}
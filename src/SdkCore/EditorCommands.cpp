@@ -0,0 +1,674 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "EditorCommands.h"
+#include "Instrument.h"
+#include "SdkExport.h"
+#include "SdkMerge.h"
+#include "SelectionFormatter.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+
+namespace {
+
+// Helper function to get a path as UTF-8, for messages and SdkMerge
+std::string pathToUtf8(const std::filesystem::path& path) {
+    std::u8string text = path.u8string();
+    return std::string(text.begin(), text.end());
+}
+
+// Helper function to create an output file, through the wide name on Windows
+FILE* createOutputFile(const std::filesystem::path& path, bool binary) {
+#ifdef _WIN32
+    FILE* file = nullptr;
+    return _wfopen_s(&file, path.c_str(), binary ? L"wb" : L"w") == 0 ? file : nullptr;
+#else
+    return fopen(path.c_str(), binary ? "wb" : "w");
+#endif
+}
+
+// The document is copied out in pieces of this size where it can't be used in place,
+// big enough that the calls cost nothing and small enough not to matter next to it
+constexpr size_t DOCUMENT_CHUNK_SIZE = 1 << 20;
+
+// Helper function to get the whole document, which must not be empty: in place where
+// the host allows it, otherwise copied into `storage`
+bool wholeDocument(EditorHost& host, std::string_view& text, std::string& storage) {
+    SDK_INSTRUMENT_STAGE(Read);
+    if (!host.documentView(text)) {
+        storage.clear();
+        storage.reserve(host.documentLength());
+        if (!host.readDocument(DOCUMENT_CHUNK_SIZE, [&](std::string_view chunk) { storage += chunk; })) {
+            return false; // Error already shown by the host
+        }
+        text = storage;
+    }
+    if (text.empty()) {
+        host.showError("File is empty.");
+        return false;
+    }
+    return true;
+}
+
+// Helper function to read and compile an export filter (by default "Filter") from the settings
+bool loadExportFilter(EditorHost& host, FieldFilter& filter, const char* key = "Filter") {
+    try {
+        filter = FieldFilter::compile(host.setting("Export", key));
+        return true;
+    }
+    catch (const std::exception& e) {
+        host.showError(std::string("Invalid export filter ") + key + " in SdkFormatter.ini:\n" + e.what());
+        return false;
+    }
+}
+
+// Helper function to read the output format from the [Template] section of the settings.
+// `haveTemplate` is left false if the section is empty.
+bool loadOutputTemplate(EditorHost& host, SdkTemplate& format, bool& haveTemplate) {
+    static const char* keys[] = { "file", "class", "field", "classEnd", "separator", "fileEnd", "extension" };
+
+    std::string text;
+    for (const char* key : keys) {
+        std::string value = host.setting("Template", key);
+        if (value.empty()) continue;
+        text += key;
+        text += '=';
+        text += value;
+        text += '\n';
+    }
+    haveTemplate = !text.empty();
+
+    try {
+        format = SdkTemplate::parse(text);
+        return true;
+    }
+    catch (const std::exception& e) {
+        host.showError(std::string("Invalid [Template] in SdkFormatter.ini:\n") + e.what());
+        return false;
+    }
+}
+
+// Helper function to format warning message with line numbers
+std::string formatWarningMessage(const std::string& className, size_t startLine, size_t endLine) {
+    std::ostringstream ss;
+    ss << "The class '" << className
+       << "' already exists in the SDK file (lines " << startLine << "-" << endLine
+       << ").\n\nDo you want to replace the existing definition?";
+    return ss.str();
+}
+
+// Function to format selected text into SDK format, or the [Template] format if one is
+// set; `format` and `haveTemplate` tell the caller which, for the file around the classes
+std::string formatSelectedText(EditorHost& host, std::string& className, int& processedLines, SdkTemplate& format, bool& haveTemplate) {
+    processedLines = 0;
+    std::string selectedText = host.selection();
+    if (selectedText.empty()) {
+        host.showError("Please select some text first.");
+        return "";
+    }
+
+    if (!loadOutputTemplate(host, format, haveTemplate)) {
+        return ""; // Error already shown in loadOutputTemplate
+    }
+    if (haveTemplate) {
+        return formatSelection(selectedText, TemplateEmitter(format), className, processedLines);
+    }
+    return formatSelection(selectedText, CSharpEmitter(), className, processedLines);
+}
+
+//
+// Helper function to write every class of `text` to a file of its own in a folder
+// the user picks, "<Class>_Offsets.cs" or the [Template] format's extension, in
+// namespace directories with ShardByNamespace=1. Returns false if cancelled.
+//
+bool exportClassesAsShards(EditorHost& host, std::string_view text, const FieldFilter* filter, SdkExportStats& stats, std::filesystem::path& folder) {
+    SdkTemplate format;
+    bool haveTemplate = false;
+    if (!loadOutputTemplate(host, format, haveTemplate)) {
+        return false; // Error already shown in loadOutputTemplate
+    }
+    // The picker starts in the current file's folder
+    host.currentDirectory(folder);
+    if (!host.askFolder("Folder for the class files", folder)) return false;
+
+    SdkExportOptions options;
+    options.filter = filter;
+    if (haveTemplate) {
+        options.language = SdkLanguage::Template;
+        options.format = &format;
+    }
+    SdkShardOptions shard;
+    shard.byNamespace = host.setting("Export", "ShardByNamespace") == "1";
+
+    LazyDump dump;
+    dump.load(text);
+    std::vector<size_t> classes(dump.size());
+    for (size_t i = 0; i < classes.size(); i++) classes[i] = i;
+    stats = exportDumpAsShards(dump, std::move(classes), folder, options, shard);
+    return true;
+}
+
+// What a background "Export Entire File to SDK" works with; the job and its
+// completion share it, so it lives as long as either needs it
+struct EntireFileExport {
+    std::vector<SdkLanguage> languages;
+    std::vector<FieldFilter> filters;
+    SdkTemplate format;
+    std::filesystem::path directory;
+    std::vector<std::string> names;
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::filesystem::path> tempPaths; // written first, renamed over `paths` once the export has finished
+    std::vector<SdkExportSink> sinks;  // their options point into the members above
+};
+
+// Helper function to close the output files of an export that are still open;
+// false if any of them couldn't be written in full
+bool closeOutputs(std::vector<SdkExportSink>& sinks) {
+    bool ok = true;
+    for (SdkExportSink& sink : sinks) {
+        if (!sink.out) continue;
+        ok = !ferror(sink.out) && ok;
+        ok = fclose(sink.out) == 0 && ok;
+        sink.out = nullptr;
+    }
+    return ok;
+}
+
+} // namespace
+
+void exportToMasterSDK(EditorHost& host)
+{
+    try {
+        std::string className;
+        int processedLines = 0;
+        SdkTemplate format;
+        bool haveTemplate = false;
+        std::string formattedText = formatSelectedText(host, className, processedLines, format, haveTemplate);
+
+        if (formattedText.empty()) return;
+
+        // custom_SDK.cs is merged class by class, which only works in Lone's C# format
+        if (haveTemplate) {
+            host.showError("Export Selection to Master SDK keeps custom_SDK.cs in Lone's C# format and can't use the [Template] format.\n"
+                           "Use Export as Individual File, or clear the [Template] section of SdkFormatter.ini.");
+            return;
+        }
+
+        // Get current file's directory path
+        std::filesystem::path currentPath;
+        if (!host.currentDirectory(currentPath)) {
+            host.showError("Failed to get current directory.");
+            return;
+        }
+
+        // Construct path to custom_SDK.cs
+        std::filesystem::path sdkFile = currentPath / "custom_SDK.cs";
+        std::string sdkPath = pathToUtf8(sdkFile);
+
+        // Check if class already exists
+        size_t startLine = 0, endLine = 0;
+        if (checkClassExists(className, sdkPath, startLine, endLine)) {
+            if (!host.askYesNo("SDK Formatter - Class Already Exists", formatWarningMessage(className, startLine, endLine))) {
+                return;
+            }
+            // Remove existing class definition
+            removeExistingClass(className, sdkPath);
+        }
+
+        // Check if file exists and validate its structure
+        bool fileExists = std::filesystem::exists(sdkFile);
+        if (fileExists && !hasProperNamespaceClosure(sdkPath)) {
+            host.showError("The SDK file appears to be corrupted or improperly formatted.\nPlease check the file structure.");
+            return;
+        }
+
+        // Open file in append mode if it exists, create new otherwise
+        std::ofstream file;
+        if (fileExists) {
+            file.open(sdkFile, std::ios::app);
+        } else {
+            file.open(sdkFile);
+            file << "namespace SDK\n{\n";
+        }
+
+        if (!file.is_open()) {
+            host.showError("Failed to open or create SDK file. Please check file permissions.");
+            return;
+        }
+
+        // Add the new class
+        file << formattedText;
+        file.close();
+
+        if (!file.good()) {
+            host.showError("An error occurred while writing to the SDK file.");
+            return;
+        }
+
+        // Open the SDK file in the editor, as C# for proper syntax highlighting
+        if (!host.openFile(sdkFile, EditorLanguage::CSharp)) {
+            host.showError("Failed to open the SDK file after writing.");
+            return;
+        }
+    }
+    catch (const std::filesystem::filesystem_error& e) {
+        host.showError(std::string("Filesystem error: ") + e.what());
+    }
+    catch (const std::exception& e) {
+        host.showError(std::string("Error: ") + e.what());
+    }
+    catch (...) {
+        host.showError("An unexpected error occurred while processing the text.");
+    }
+}
+
+void exportAsIndividualFile(EditorHost& host)
+{
+    try {
+        // Several classes get a file each, named after the class
+        std::string selectedText = host.selection();
+        ClassIndex selectedClasses;
+        selectedClasses.build(selectedText);
+        if (selectedClasses.size() > 1) {
+            SdkExportStats stats;
+            std::filesystem::path folder;
+            if (!exportClassesAsShards(host, selectedText, nullptr, stats, folder)) return;
+            std::ostringstream msg;
+            msg << "Exported " << stats.classCount << " classes (" << stats.fieldCount << " fields) to " << pathToUtf8(folder);
+            if (stats.duplicateClasses) msg << "\n" << stats.duplicateClasses << " duplicate classes skipped";
+            host.showMessage(msg.str());
+            return;
+        }
+
+        std::string className;
+        int processedLines = 0;
+        SdkTemplate format;
+        bool haveTemplate = false;
+        std::string formattedText = formatSelectedText(host, className, processedLines, format, haveTemplate);
+
+        if (formattedText.empty()) return;
+
+        // Suggest a file named after the class in the current file's directory,
+        // with the [Template] format's extension if one is set
+        std::string extension = haveTemplate ? format.extension : ".cs";
+        std::filesystem::path fileName;
+        host.currentDirectory(fileName);
+        fileName /= className + "_Offsets" + extension;
+
+        std::string_view defaultExtension = extension;
+        if (!defaultExtension.empty() && defaultExtension.front() == '.') defaultExtension.remove_prefix(1);
+        std::string pattern = "*" + extension;
+        std::string description = (haveTemplate ? "Template Files (" : "C# Files (") + pattern + ")";
+        const std::vector<EditorFileType> types = { { description.c_str(), pattern.c_str() }, { "All Files (*.*)", "*.*" } };
+        size_t type = 0;
+        if (host.askSavePath(types, defaultExtension, fileName, type)) {
+            // Put the file's beginning and end around the class, as the whole-file exports do
+            std::string finalText;
+            auto wrap = [&](auto emitter) {
+                emitter.beginFile(finalText);
+                finalText += formattedText;
+                emitter.endFile(finalText);
+            };
+            if (haveTemplate) wrap(TemplateEmitter(format));
+            else wrap(CSharpEmitter());
+
+            // Open the file
+            FILE* fp = createOutputFile(fileName, false);
+            if (fp != nullptr) {
+                fwrite(finalText.c_str(), 1, finalText.length(), fp);
+                fclose(fp);
+
+                // Open the saved file in the editor, as C# for proper syntax highlighting unless it is a template's
+                host.openFile(fileName, haveTemplate ? EditorLanguage::Text : EditorLanguage::CSharp);
+            }
+            else {
+                host.showError("Failed to write to the selected file.");
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        host.showError(std::string("Error: ") + e.what());
+    }
+    catch (...) {
+        host.showError("An unexpected error occurred while processing the text.");
+    }
+}
+
+void editExportFilter(EditorHost& host) {
+    try {
+        std::filesystem::path settingsPath = host.settingsPath();
+        if (!std::filesystem::exists(settingsPath)) {
+            std::ofstream file(settingsPath);
+            file << "; SDK Formatter settings\n"
+                    "[Export]\n"
+                    "; Fields and classes kept by \"Export Entire File to SDK\", for example:\n"
+                    ";   Filter=tag != C && !type ~ \"^System\\.Action\" && class ~ \"^EFT\\.\"\n"
+                    "; Operands: class, base, tag (I/S/C), name, type, offset. Operators: == != ~ !~ < <= > >= && || !\n"
+                    "Filter=\n"
+                    "; Files written by \"Export Entire File to SDK\" in one pass: any of cs, cpp, rust, template, db, json\n"
+                    ";   Outputs=cs,cpp\n"
+                    "; Filter.cs=, Filter.cpp=, Filter.rust=, Filter.template=, Filter.db= and Filter.json= override Filter for one output\n"
+                    "Outputs=cs\n"
+                    "; 1 puts the files of \"Export Entire File as Individual Files\" (and of selections with several\n"
+                    "; classes) in one folder per namespace, e.g. EFT\\InventoryLogic\\Item_Offsets.cs\n"
+                    "ShardByNamespace=0\n"
+                    "\n"
+                    "[Template]\n"
+                    "; Custom format used by the selection exports and the \"template\" output. Keys left out keep\n"
+                    "; Lone's format. Placeholders: {name} {type} {tag} {offset} {offset:hex} {offset:dec} in field,\n"
+                    "; {class} {fullname} {base} {header} anywhere. \\n \\t for newline and tab, {{ }} for braces,\n"
+                    "; \"quotes\" to keep leading spaces. Keys: file, class, field, classEnd, separator, fileEnd, extension\n"
+                    ";   field=\\t\\tpublic const ulong {name} = 0x{offset:hex};\\n\n";
+            if (!file.good()) {
+                host.showError("Failed to create SdkFormatter.ini.");
+                return;
+            }
+        }
+        host.openFile(settingsPath, EditorLanguage::Auto);
+    }
+    catch (...) {
+        host.showError("Unexpected error while opening the settings file.");
+    }
+}
+
+void exportEntireFileToSDK(EditorHost& host) {
+    try {
+        resetInstrument();
+
+        uint64_t documentLength = host.documentLength();
+        if (documentLength == 0) {
+            host.showError("File is empty.");
+            return;
+        }
+
+        // Work out the outputs ("Outputs=cs,cpp,rust") and their filters before touching any file
+        auto job = std::make_shared<EntireFileExport>();
+        std::vector<SdkLanguage>& languages = job->languages;
+        std::string outputList = host.setting("Export", "Outputs");
+        std::stringstream outputStream(outputList.empty() ? "cs" : outputList);
+        std::string outputName;
+        while (std::getline(outputStream, outputName, ',')) {
+            std::string_view name = trimView(outputName);
+            if (name.empty()) continue;
+            SdkLanguage language;
+            if (!parseSdkLanguage(name, language)) {
+                host.showError("Invalid Outputs in SdkFormatter.ini: use cs, cpp, rust, template, db and/or json.");
+                return;
+            }
+            if (std::find(languages.begin(), languages.end(), language) == languages.end()) languages.push_back(language);
+        }
+        if (languages.empty()) languages.push_back(SdkLanguage::CSharp);
+
+        bool haveTemplate = false;
+        if (!loadOutputTemplate(host, job->format, haveTemplate)) {
+            return; // Error already shown in loadOutputTemplate
+        }
+
+        FieldFilter defaultFilter;
+        if (!loadExportFilter(host, defaultFilter)) {
+            return; // Error already shown in loadExportFilter
+        }
+        job->filters.resize(languages.size());
+        for (size_t i = 0; i < languages.size(); i++) {
+            const char* key = languages[i] == SdkLanguage::Cpp ? "Filter.cpp"
+                : languages[i] == SdkLanguage::Rust ? "Filter.rust"
+                : languages[i] == SdkLanguage::Template ? "Filter.template"
+                : languages[i] == SdkLanguage::OffsetsDb ? "Filter.db"
+                : languages[i] == SdkLanguage::Ndjson ? "Filter.json"
+                : "Filter.cs";
+            if (!loadExportFilter(host, job->filters[i], key)) {
+                return; // Error already shown in loadExportFilter
+            }
+            if (job->filters[i].empty()) job->filters[i] = defaultFilter;
+        }
+
+        // Outputs go next to the current file as custom_SDK.cs, custom_SDK.hpp, custom_SDK.rs,
+        // custom_SDK.sdkdb, custom_SDK.ndjson and custom_SDK + the template's extension
+        host.currentDirectory(job->directory);
+        for (SdkLanguage language : languages) {
+            std::string name = "custom_SDK";
+            name += language == SdkLanguage::Template ? job->format.extension.c_str() : sdkFileExtension(language);
+            job->names.push_back(name);
+            job->paths.push_back(job->directory / name);
+            job->tempPaths.push_back(job->directory / (name + ".tmp"));
+        }
+
+        job->sinks.resize(languages.size());
+        for (size_t i = 0; i < job->sinks.size(); i++) {
+            job->sinks[i].options.language = languages[i];
+            job->sinks[i].options.filter = &job->filters[i];
+            job->sinks[i].options.format = &job->format;
+        }
+
+        // The conversion runs as a job, so the editor stays usable and the user can cancel it.
+        // It reads the document a piece at a time through the host, never holding all of it.
+        auto work = [&host, job, documentLength](ExportProgressTracker& progress) {
+            // Half an SDK is worse than the previous one, so the outputs are written to
+            // temporary files next to them that only replace them once all is written
+            auto discard = [&job] {
+                closeOutputs(job->sinks);
+                std::error_code error;
+                for (const std::filesystem::path& path : job->tempPaths) std::filesystem::remove(path, error);
+            };
+
+            progress.setTotalBytes(documentLength);
+            for (size_t i = 0; i < job->sinks.size(); i++) {
+                job->sinks[i].out = createOutputFile(job->tempPaths[i], isBinarySdkLanguage(job->languages[i]));
+                if (!job->sinks[i].out) {
+                    discard();
+                    throw std::runtime_error("Failed to open " + pathToUtf8(job->tempPaths[i]) + " for writing.");
+                }
+            }
+
+            // Convert the dump once for every output
+            try {
+                exportDumpAsSdk([&](const std::function<void(std::string_view)>& onChunk) {
+                    if (!host.readDocument(DOCUMENT_CHUNK_SIZE, onChunk)) throw std::runtime_error("Failed to read the document.");
+                }, job->sinks, &progress);
+            }
+            catch (...) {
+                discard();
+                throw;
+            }
+            if (!closeOutputs(job->sinks)) {
+                discard();
+                throw std::runtime_error("Failed to write the SDK files in " + pathToUtf8(job->directory) + "; the previous ones were kept.");
+            }
+            try {
+                for (size_t i = 0; i < job->paths.size(); i++) std::filesystem::rename(job->tempPaths[i], job->paths[i]);
+            }
+            catch (...) {
+                discard();
+                throw;
+            }
+        };
+
+        auto done = [&host, job](const ExportJobResult& result) {
+            try {
+                if (result.outcome == ExportJobOutcome::Cancelled) {
+                    host.showMessage("Export cancelled after " + std::to_string(result.progress.classesDone)
+                                     + " classes; the previous SDK files were left as they were.");
+                    return;
+                }
+                if (result.outcome == ExportJobOutcome::Failed) {
+                    host.showError(result.error);
+                    return;
+                }
+
+                // Show success message
+                const SdkExportStats& stats = job->sinks[0].stats;
+                std::ostringstream msg;
+                msg << "Successfully exported " << stats.classCount << " classes to " << job->names[0] << "\n"
+                    << stats.fieldCount << " fields (" << stats.tagCounts[static_cast<size_t>(FieldTag::Instance)] << " instance, "
+                    << stats.tagCounts[static_cast<size_t>(FieldTag::Static)] << " static, "
+                    << stats.tagCounts[static_cast<size_t>(FieldTag::Const)] << " const)\n"
+                    << stats.filteredClasses << " classes and " << stats.filteredFields << " fields filtered out";
+                for (size_t i = 1; i < job->sinks.size(); i++) {
+                    msg << "\n\nAlso wrote " << job->names[i] << ": "
+                        << job->sinks[i].stats.classCount << " classes, " << job->sinks[i].stats.fieldCount << " fields";
+                }
+#if defined(SDKCORE_INSTRUMENT)
+                // Instrumented builds add the stage report, and its trace next to the outputs
+                msg << "\n\n" << formatInstrumentText(collectInstrumentReport());
+                std::ofstream trace(job->directory / "custom_SDK.trace.json", std::ios::binary);
+                trace << formatInstrumentTrace();
+#endif
+                host.showMessage(msg.str());
+
+                // Open the text files in the editor
+                for (size_t i = job->sinks.size(); i-- > 0;) {
+                    SdkLanguage language = job->languages[i];
+                    if (isBinarySdkLanguage(language)) continue;
+                    host.openFile(job->paths[i], language == SdkLanguage::Cpp ? EditorLanguage::Cpp
+                        : language == SdkLanguage::Rust ? EditorLanguage::Rust
+                        : language == SdkLanguage::Template ? EditorLanguage::Text
+                        : EditorLanguage::CSharp);
+                }
+            }
+            catch (const std::exception& e) {
+                host.showError(e.what());
+            }
+            catch (...) {
+                host.showError("Unexpected error while exporting file.");
+            }
+        };
+
+        if (!host.runJob(std::move(work), std::move(done))) {
+            host.showError("An export is already running. Wait for it to finish or cancel it first.");
+        }
+    }
+    catch (const std::exception& e) {
+        host.showError(e.what());
+    }
+    catch (...) {
+        host.showError("Unexpected error while exporting file.");
+    }
+}
+
+void exportEntireFileAsShards(EditorHost& host) {
+    try {
+        std::string_view fileContent;
+        std::string copy;
+        if (!wholeDocument(host, fileContent, copy)) {
+            return; // Error already shown in wholeDocument
+        }
+
+        FieldFilter filter;
+        if (!loadExportFilter(host, filter)) {
+            return; // Error already shown in loadExportFilter
+        }
+
+        SdkExportStats stats;
+        std::filesystem::path folder;
+        if (!exportClassesAsShards(host, fileContent, &filter, stats, folder)) return;
+
+        std::ostringstream msg;
+        msg << "Exported " << stats.classCount << " classes (" << stats.fieldCount << " fields) to " << pathToUtf8(folder) << "\n"
+            << stats.duplicateClasses << " duplicate classes skipped, "
+            << stats.filteredClasses << " classes and " << stats.filteredFields << " fields filtered out";
+        host.showMessage(msg.str());
+    }
+    catch (const std::exception& e) {
+        host.showError(std::string("Error: ") + e.what());
+    }
+    catch (...) {
+        host.showError("Unexpected error while exporting the classes.");
+    }
+}
+
+void exportMatchingClasses(EditorHost& host) {
+    try {
+        std::string pattern(trimView(host.selection()));
+        if (pattern.empty()) {
+            host.showError("Please select a class name or pattern first, e.g. EFT.InventoryLogic.*");
+            return;
+        }
+        if (pattern.find_first_of("*?") == std::string::npos) {
+            pattern += '*';
+        }
+
+        std::string_view fileContent;
+        std::string copy;
+        if (!wholeDocument(host, fileContent, copy)) {
+            return; // Error already shown in wholeDocument
+        }
+
+        // Only the matching class blocks get parsed
+        ClassIndex index;
+        index.build(fileContent);
+        std::vector<ClassSpan> spans = index.matchGlob(pattern);
+        if (spans.empty()) {
+            host.showError("No class in this file matches the selected pattern.");
+            return;
+        }
+
+        FieldFilter filter;
+        if (!loadExportFilter(host, filter)) {
+            return; // Error already shown in loadExportFilter
+        }
+
+        // Suggest a file named after the pattern in the current file's directory
+        std::string baseName = makeSdkStructName(pattern.substr(0, pattern.find_first_of("*?")));
+        while (!baseName.empty() && baseName.back() == '_') baseName.pop_back();
+        std::filesystem::path fileName;
+        host.currentDirectory(fileName);
+        fileName /= baseName + "_Offsets.cs";
+
+        static const std::vector<EditorFileType> types = {
+            { "C# Files (*.cs)", "*.cs" }, { "C++ Header (*.hpp)", "*.hpp" }, { "Rust Files (*.rs)", "*.rs" }, { "All Files (*.*)", "*.*" } };
+        size_t type = 0;
+        if (!host.askSavePath(types, "cs", fileName, type)) return;
+
+        // The chosen file type picks the output language
+        SdkExportOptions options;
+        options.filter = &filter;
+        EditorLanguage language = EditorLanguage::CSharp;
+        if (type == 1) {
+            options.language = SdkLanguage::Cpp;
+            language = EditorLanguage::Cpp;
+        }
+        else if (type == 2) {
+            options.language = SdkLanguage::Rust;
+            language = EditorLanguage::Rust;
+        }
+
+        FILE* fp = createOutputFile(fileName, false);
+        if (!fp) {
+            host.showError("Failed to write to the selected file.");
+            return;
+        }
+
+        SdkExportStats stats = exportDumpAsSdk(fileContent, std::move(spans), fp, options);
+        fclose(fp);
+
+        std::ostringstream msg;
+        msg << "Exported " << stats.classCount << " classes (" << stats.fieldCount << " fields) matching the selection";
+        host.showMessage(msg.str());
+
+        host.openFile(fileName, language);
+    }
+    catch (const std::exception& e) {
+        host.showError(std::string("Error: ") + e.what());
+    }
+    catch (...) {
+        host.showError("Unexpected error while exporting matching classes.");
+    }
+}
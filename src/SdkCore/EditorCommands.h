@@ -0,0 +1,49 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// The plugin's menu commands, written against an EditorHost so they run the
+// same in Notepad++ and headless. Each one reports its errors through the host
+// and never throws.
+//
+#include "EditorHost.h"
+
+// "Export Selection to Master SDK": appends the selected classes to custom_SDK.cs
+// next to the current file, replacing an earlier definition if the user agrees
+void exportToMasterSDK(EditorHost& host);
+
+// "Export Selection as Individual File": one class to a file the user picks, or
+// several classes to a file each in a folder the user picks
+void exportAsIndividualFile(EditorHost& host);
+
+// "Export Entire File to SDK": the whole document to custom_SDK.cs and the other
+// Outputs= of the settings, through the export filters. The conversion runs as a
+// job of the host (EditorHost::runJob), which must outlive it, and reports its
+// outcome when it ends.
+void exportEntireFileToSDK(EditorHost& host);
+
+// "Export Entire File as Individual Files": every class to a file of its own
+void exportEntireFileAsShards(EditorHost& host);
+
+// "Export Classes Matching Selection": the classes whose name matches the
+// selected glob (or prefix) to one file
+void exportMatchingClasses(EditorHost& host);
+
+// "Edit Export Filter...": opens the settings file, creating it if needed
+void editExportFilter(EditorHost& host);
@@ -0,0 +1,97 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// What the plugin's commands need from the editor: the document and the
+// selection, the current file's folder, the settings, opening files and asking
+// the user. The plugin implements it over Notepad++ and Scintilla messages;
+// MemoryEditorHost stands in for the editor anywhere else, so the commands in
+// EditorCommands.h also run headless (benchmarks, soak tests) on any platform.
+// Text and messages are UTF-8.
+//
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ExportJob.h"
+
+// Syntax highlighting of a file opened in the editor; Auto leaves it to the editor
+enum class EditorLanguage { Auto, Text, CSharp, Cpp, Rust };
+
+// One entry of a save dialog's file type list, e.g. { "C# Files (*.cs)", "*.cs" }
+struct EditorFileType {
+    const char* description;
+    const char* pattern;
+};
+
+class EditorHost {
+public:
+    virtual ~EditorHost() = default;
+
+    // The selected text, "" without a selection
+    virtual std::string selection() = 0;
+
+    // Size of the document in bytes
+    virtual size_t documentLength() = 0;
+
+    // The whole document in place, without copying it, where the editor allows that;
+    // false otherwise. The view is only valid until the document changes.
+    virtual bool documentView(std::string_view& text) = 0;
+
+    // Copies the document out in consecutive pieces of at most `chunkSize` bytes, each
+    // valid only during its onChunk() call, so reading it takes one piece of memory
+    // whatever its size. Returns false, after telling the user why, if it can't be read.
+    // From a job's work (see runJob()) it reads the document that was current when the
+    // job started, whatever the user switches to, and shows nothing: problems, such as
+    // an edit to that document meanwhile, are thrown as std::runtime_error.
+    virtual bool readDocument(size_t chunkSize, const std::function<void(std::string_view chunk)>& onChunk) = 0;
+
+    // Runs a long export away from the editor's thread where the host can, showing
+    // its progress and letting the user cancel it (see ExportJob). `work` may only
+    // use readDocument() of the host; `done` gets the outcome back on the editor's
+    // thread. Returns false, running nothing, while another job is running.
+    virtual bool runJob(ExportJob::Work work, ExportJob::Done done) = 0;
+
+    // The folder of the current document; false if there isn't one
+    virtual bool currentDirectory(std::filesystem::path& dir) = 0;
+
+    // A value of the plugin's settings (SdkFormatter.ini), "" if it isn't set
+    virtual std::string setting(std::string_view section, std::string_view key) = 0;
+    virtual std::filesystem::path settingsPath() = 0;
+
+    // Opens a file in the editor; false if it couldn't
+    virtual bool openFile(const std::filesystem::path& path, EditorLanguage language) = 0;
+
+    virtual void showError(std::string_view message) = 0;
+    virtual void showMessage(std::string_view message) = 0;
+
+    // A yes/no question; true for yes
+    virtual bool askYesNo(std::string_view title, std::string_view question) = 0;
+
+    // Save dialog. `path` comes in as the suggested file (folder and name) and `type`
+    // as the index into `types` to start with; both return the user's choice.
+    // Returns false if cancelled.
+    virtual bool askSavePath(const std::vector<EditorFileType>& types, std::string_view defaultExtension,
+        std::filesystem::path& path, size_t& type) = 0;
+
+    // Folder picker starting in `folder`; false if cancelled
+    virtual bool askFolder(std::string_view title, std::filesystem::path& folder) = 0;
+};
@@ -0,0 +1,391 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Output backends for the SDK exports. Each language is a small class deriving
+// from SdkEmitter<Self>; exporters are templates over the emitter type, so the
+// per-field formatting is resolved at compile time. Everything is appended to a
+// caller-owned std::string that is meant to be cleared and reused.
+//
+// Call order: beginFile, then per class beginClass / field... / endClass, then endFile.
+//
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include "ColumnStore.h"
+#include "DumpParser.h"
+#include "Identifier.h"
+#include "JsonEscape.h"
+#include "OffsetsDbWriter.h"
+#include "OutputTemplate.h"
+
+enum class SdkLanguage : uint8_t {
+    CSharp = 0, // Lone's SDK.cs format
+    Cpp = 1,    // constexpr header
+    Rust = 2,   // pub const module
+    Template = 3, // user supplied SdkTemplate
+    OffsetsDb = 4, // binary database, see OffsetsDb.h
+    Ndjson = 5,   // one JSON object per class and line
+};
+
+// Parses "cs", "cpp", "rust", "template", "db" or "json" (also "c#", "c++", "rs", "sdkdb", "ndjson")
+inline bool parseSdkLanguage(std::string_view name, SdkLanguage& out) {
+    if (name == "cs" || name == "c#" || name == "csharp") out = SdkLanguage::CSharp;
+    else if (name == "cpp" || name == "c++" || name == "hpp") out = SdkLanguage::Cpp;
+    else if (name == "rust" || name == "rs") out = SdkLanguage::Rust;
+    else if (name == "template") out = SdkLanguage::Template;
+    else if (name == "db" || name == "sdkdb") out = SdkLanguage::OffsetsDb;
+    else if (name == "json" || name == "ndjson") out = SdkLanguage::Ndjson;
+    else return false;
+    return true;
+}
+
+// File extension conventionally used for a language, including the dot (templates name their own)
+inline const char* sdkFileExtension(SdkLanguage language) {
+    switch (language) {
+    case SdkLanguage::Cpp: return ".hpp";
+    case SdkLanguage::Rust: return ".rs";
+    case SdkLanguage::Template: return ".txt";
+    case SdkLanguage::OffsetsDb: return ".sdkdb";
+    case SdkLanguage::Ndjson: return ".ndjson";
+    default: return ".cs";
+    }
+}
+
+// True for machine-readable outputs: written in binary mode (no CRLF translation) and not opened in the editor
+inline bool isBinarySdkLanguage(SdkLanguage language) {
+    return language == SdkLanguage::OffsetsDb || language == SdkLanguage::Ndjson;
+}
+
+template <typename Derived>
+class SdkEmitter {
+public:
+    void beginFile(std::string& out) { self().writeFileHeader(out); }
+    void endFile(std::string& out) { self().writeFileFooter(out); }
+
+    // The header's "[Class] ..." line is copied into a comment
+    void beginClass(std::string& out, const DumpClassHeader& header, std::string_view structName) {
+        _fieldNames.clear();
+        self().writeClassHeader(out, header, structName);
+    }
+
+    void field(std::string& out, const DumpField& field) { self().writeField(out, field); }
+
+    // The last class of a file isn't followed by a blank line
+    void endClass(std::string& out, bool last) {
+        self().writeClassFooter(out);
+        if (!last) out += '\n';
+    }
+
+protected:
+    // Default field line: <indent><prefix><name><assign>0x<offset>; // <type>
+    void writeField(std::string& out, const DumpField& field) {
+        out += Derived::FIELD_PREFIX;
+        self().writeIdentifier(out, field.name);
+        out += Derived::FIELD_ASSIGN;
+        out += field.offsetText;
+        out += "; // ";
+        out += field.type;
+        out += '\n';
+    }
+
+    // Field names are made into identifiers (see Identifier.h); two that come out
+    // the same within a class get a numbered suffix
+    void writeIdentifier(std::string& out, std::string_view name) {
+        size_t start = out.size();
+        appendIdentifier(out, name);
+        claimIdentifier(out, start);
+    }
+
+    void claimIdentifier(std::string& out, size_t start) { _fieldNames.claim(out, start); }
+
+    // Helper function to check a name against a sorted keyword table
+    template <size_t N>
+    static bool isKeyword(const std::string_view (&keywords)[N], std::string_view name) {
+        return std::binary_search(std::begin(keywords), std::end(keywords), name);
+    }
+
+private:
+    Derived& self() { return static_cast<Derived&>(*this); }
+
+    IdentifierScope _fieldNames;
+};
+
+// namespace SDK { public readonly partial struct X { public const uint f = 0x10; // T } }
+class CSharpEmitter : public SdkEmitter<CSharpEmitter> {
+    friend class SdkEmitter<CSharpEmitter>;
+
+public:
+    static constexpr std::string_view FIELD_PREFIX = "        public const uint ";
+    static constexpr std::string_view FIELD_ASSIGN = " = 0x";
+
+private:
+    void writeFileHeader(std::string& out) { out += "namespace SDK\n{\n"; }
+    void writeFileFooter(std::string& out) { out += "}\n"; }
+
+    void writeClassHeader(std::string& out, const DumpClassHeader& header, std::string_view structName) {
+        out += "    // ";
+        out += header.line;
+        out += "\n    public readonly partial struct ";
+        out += structName;
+        out += "\n    {\n";
+    }
+
+    void writeClassFooter(std::string& out) { out += "    }\n"; }
+};
+
+// namespace SDK { namespace X { constexpr uint32_t f = 0x10; // T } }
+class CppEmitter : public SdkEmitter<CppEmitter> {
+    friend class SdkEmitter<CppEmitter>;
+
+public:
+    static constexpr std::string_view FIELD_PREFIX = "        constexpr uint32_t ";
+    static constexpr std::string_view FIELD_ASSIGN = " = 0x";
+
+private:
+    void writeFileHeader(std::string& out) { out += "#pragma once\n#include <cstdint>\n\nnamespace SDK\n{\n"; }
+    void writeFileFooter(std::string& out) { out += "}\n"; }
+
+    void writeClassHeader(std::string& out, const DumpClassHeader& header, std::string_view structName) {
+        out += "    // ";
+        out += header.line;
+        out += "\n    namespace ";
+        out += structName;
+        out += "\n    {\n";
+    }
+
+    void writeClassFooter(std::string& out) { out += "    }\n"; }
+
+    // C++ keywords that are valid C# field names get a trailing underscore
+    void writeIdentifier(std::string& out, std::string_view name) {
+        static constexpr std::string_view keywords[] = {
+            "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "char16_t", "char32_t",
+            "char8_t", "co_await", "co_return", "co_yield", "compl", "concept", "const_cast", "consteval",
+            "constexpr", "constinit", "decltype", "delete", "dynamic_cast", "export", "friend", "inline",
+            "mutable", "noexcept", "not", "not_eq", "nullptr", "or", "or_eq", "register", "reinterpret_cast",
+            "requires", "signed", "static_assert", "static_cast", "template", "thread_local", "typedef",
+            "typeid", "typename", "union", "unsigned", "wchar_t", "xor", "xor_eq",
+        };
+        size_t start = out.size();
+        appendIdentifier(out, name);
+        if (isKeyword(keywords, std::string_view(out).substr(start))) out += '_';
+        claimIdentifier(out, start);
+    }
+};
+
+// pub mod X { pub const f: u32 = 0x10; // T }
+class RustEmitter : public SdkEmitter<RustEmitter> {
+    friend class SdkEmitter<RustEmitter>;
+
+public:
+    static constexpr std::string_view FIELD_PREFIX = "    pub const ";
+    static constexpr std::string_view FIELD_ASSIGN = ": u32 = 0x";
+
+private:
+    void writeFileHeader(std::string& out) { out += "#![allow(non_snake_case, non_upper_case_globals, dead_code)]\n\n"; }
+    void writeFileFooter(std::string&) {}
+
+    void writeClassHeader(std::string& out, const DumpClassHeader& header, std::string_view structName) {
+        out += "// ";
+        out += header.line;
+        out += "\npub mod ";
+        out += structName;
+        out += " {\n";
+    }
+
+    void writeClassFooter(std::string& out) { out += "}\n"; }
+
+    // Rust keywords are written as raw identifiers; the few that can't be raw get an underscore
+    void writeIdentifier(std::string& out, std::string_view name) {
+        static constexpr std::string_view keywords[] = {
+            "abstract", "as", "async", "await", "become", "box", "do", "dyn", "enum", "extern", "final", "fn",
+            "gen", "impl", "in", "let", "loop", "macro", "match", "mod", "move", "mut", "priv", "pub", "ref", "trait",
+            "type", "typeof", "unsafe", "unsized", "use", "virtual", "where", "yield",
+        };
+        static constexpr std::string_view reserved[] = { "Self", "crate", "self", "super" };
+        size_t start = out.size();
+        appendIdentifier(out, name);
+        std::string_view identifier = std::string_view(out).substr(start);
+        if (isKeyword(reserved, identifier)) {
+            out += '_';
+        }
+        else if (isKeyword(keywords, identifier)) {
+            out.insert(start, "r#");
+            start += 2;
+        }
+        claimIdentifier(out, start);
+    }
+};
+
+// Renders a user supplied SdkTemplate, which must outlive the emitter
+class TemplateEmitter : public SdkEmitter<TemplateEmitter> {
+    friend class SdkEmitter<TemplateEmitter>;
+
+public:
+    explicit TemplateEmitter(const SdkTemplate& format) : _format(&format) {}
+
+    // Shadows SdkEmitter::endClass(): the separator comes from the template
+    void endClass(std::string& out, bool last) {
+        _format->classEnd.render(out, classContext());
+        if (!last) _format->separator.render(out, classContext());
+    }
+
+private:
+    void writeFileHeader(std::string& out) { _format->fileBegin.render(out, {}); }
+    void writeFileFooter(std::string& out) { _format->fileEnd.render(out, {}); }
+
+    // The class is copied for the field and end templates that follow, since
+    // callers may reuse the header's text before the class ends
+    void writeClassHeader(std::string& out, const DumpClassHeader& header, std::string_view structName) {
+        _headerText.assign(header.line).append(header.name).append(header.bases);
+        _header.line = std::string_view(_headerText).substr(0, header.line.size());
+        _header.name = std::string_view(_headerText).substr(header.line.size(), header.name.size());
+        _header.bases = std::string_view(_headerText).substr(header.line.size() + header.name.size());
+        _structName.assign(structName);
+        _format->classBegin.render(out, classContext());
+    }
+
+    void writeField(std::string& out, const DumpField& field) {
+        TemplateContext context = classContext();
+        context.field = &field;
+        _format->field.render(out, context);
+    }
+
+    TemplateContext classContext() const {
+        TemplateContext context;
+        context.header = &_header;
+        context.structName = _structName;
+        return context;
+    }
+
+    const SdkTemplate* _format;
+    std::string _headerText;
+    DumpClassHeader _header;
+    std::string _structName;
+};
+
+//
+// Collects the classes instead of formatting them and writes the whole binary
+// database from endFile(). Classes left without fields are not stored, since
+// lookups are per field.
+//
+class OffsetsDbEmitter : public SdkEmitter<OffsetsDbEmitter> {
+    friend class SdkEmitter<OffsetsDbEmitter>;
+
+public:
+    // Shadows SdkEmitter::endClass(): there is no separator to write
+    void endClass(std::string&, bool) {
+        if (_columns.fieldCount() == _classMark) _columns.dropLastClass(_classMark);
+    }
+
+private:
+    void writeFileHeader(std::string&) {}
+    void writeFileFooter(std::string& out) { out += buildOffsetsDb(_columns); }
+
+    void writeClassHeader(std::string&, const DumpClassHeader& header, std::string_view) {
+        _classMark = _columns.fieldCount();
+        _currentClass = _columns.beginClass(header.name);
+    }
+
+    void writeField(std::string&, const DumpField& field) { _columns.addField(_currentClass, field); }
+
+    ColumnStore _columns;
+    size_t _classMark = 0;
+    uint32_t _currentClass = 0;
+};
+
+//
+// {"name":"EFT.Player","base":"...","interfaces":[...],"fields":[{"offset":1488,"tag":"I","name":"...","type":"..."}]}
+// Each class is a complete line, so consumers can stream the file. Names are kept
+// exactly as in the dump; offsets are decimal numbers.
+//
+class NdjsonEmitter : public SdkEmitter<NdjsonEmitter> {
+    friend class SdkEmitter<NdjsonEmitter>;
+
+public:
+    // Shadows SdkEmitter::endClass(): every class already ends its own line
+    void endClass(std::string& out, bool) { out += "]}\n"; }
+
+private:
+    void writeFileHeader(std::string&) {}
+    void writeFileFooter(std::string&) {}
+
+    // The first entry of the base list is the base class, the rest are interfaces.
+    // Commas inside generic arguments don't split entries.
+    void writeClassHeader(std::string& out, const DumpClassHeader& header, std::string_view) {
+        out += "{\"name\":";
+        appendJsonString(out, header.name);
+        out += ",\"base\":";
+        size_t count = 0;
+        int depth = 0;
+        size_t start = 0;
+        for (size_t i = 0; i <= header.bases.size(); i++) {
+            char c = i < header.bases.size() ? header.bases[i] : ',';
+            if (c == '<') depth++;
+            else if (c == '>') depth--;
+            else if (c == ',' && depth <= 0) {
+                std::string_view entry = trimView(header.bases.substr(start, i - start));
+                start = i + 1;
+                if (entry.empty()) continue;
+                if (count == 1) out += ",\"interfaces\":[";
+                else if (count > 1) out += ',';
+                appendJsonString(out, entry);
+                count++;
+            }
+        }
+        if (count == 0) out += "null";
+        out += count > 1 ? "]" : ",\"interfaces\":[]";
+        out += ",\"fields\":[";
+        _firstField = true;
+    }
+
+    void writeField(std::string& out, const DumpField& field) {
+        char offset[24];
+        auto result = std::to_chars(offset, offset + sizeof(offset), field.offset);
+        out += _firstField ? "{\"offset\":" : ",{\"offset\":";
+        out.append(offset, result.ptr);
+        out += ",\"tag\":\"";
+        out += fieldTagLetter(field.tag);
+        out += "\",\"name\":";
+        appendJsonString(out, field.name);
+        out += ",\"type\":";
+        appendJsonString(out, field.type);
+        out += '}';
+        _firstField = false;
+    }
+
+    bool _firstField = true;
+};
+
+// Calls fn(emitter) with the backend for `language`; fn is instantiated once per backend.
+// `format` is required for SdkLanguage::Template.
+template <typename Fn>
+decltype(auto) withSdkEmitter(SdkLanguage language, const SdkTemplate* format, Fn&& fn) {
+    switch (language) {
+    case SdkLanguage::Cpp: return fn(CppEmitter{});
+    case SdkLanguage::Rust: return fn(RustEmitter{});
+    case SdkLanguage::Template: return fn(TemplateEmitter(*format));
+    case SdkLanguage::OffsetsDb: return fn(OffsetsDbEmitter{});
+    case SdkLanguage::Ndjson: return fn(NdjsonEmitter{});
+    default: return fn(CSharpEmitter{});
+    }
+}
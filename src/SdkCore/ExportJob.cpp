@@ -0,0 +1,120 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "ExportJob.h"
+#include <cstdio>
+
+std::string formatExportProgress(const ExportProgress& progress) {
+    char text[160];
+    int length = 0;
+    if (progress.bytesTotal > 0) {
+        double done = static_cast<double>(progress.bytesDone) / (1024.0 * 1024.0);
+        double total = static_cast<double>(progress.bytesTotal) / (1024.0 * 1024.0);
+        length = snprintf(text, sizeof(text), "%.1f of %.1f MB (%.0f%%), ", done, total, 100.0 * done / total);
+    }
+    length += snprintf(text + length, sizeof(text) - length, "%llu classes", static_cast<unsigned long long>(progress.classesDone));
+    if (progress.etaSeconds >= 0) snprintf(text + length, sizeof(text) - length, ", %.0f s left", progress.etaSeconds);
+    else snprintf(text + length, sizeof(text) - length, ", %.0f s", progress.elapsedSeconds);
+    return text;
+}
+
+ExportProgressTracker::ExportProgressTracker(const CancellationToken& token, Callback onProgress, std::chrono::milliseconds interval)
+    : _token(token), _onProgress(std::move(onProgress)), _start(std::chrono::steady_clock::now()),
+      _intervalNs(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count()), _nextReportNs(_intervalNs) {}
+
+void ExportProgressTracker::setInput(std::string_view text) {
+    _inputBegin = text.data();
+    _inputEnd = text.data() + text.size();
+    setTotalBytes(text.size());
+}
+
+bool ExportProgressTracker::advance(uint64_t bytes, uint64_t classes) {
+    if (bytes) _bytesDone.fetch_add(bytes, std::memory_order_relaxed);
+    if (classes) _classesDone.fetch_add(classes, std::memory_order_relaxed);
+    maybeReport();
+    return !cancelled();
+}
+
+bool ExportProgressTracker::advanceTo(const char* name) {
+    // Only the single thread of a streaming export gets here, so the store can't go backwards
+    if (name >= _inputBegin && name < _inputEnd) _bytesDone.store(static_cast<uint64_t>(name - _inputBegin), std::memory_order_relaxed);
+    return advance(0, 1);
+}
+
+ExportProgress ExportProgressTracker::progress() const {
+    ExportProgress progress;
+    progress.bytesDone = _bytesDone.load(std::memory_order_relaxed);
+    progress.bytesTotal = _bytesTotal.load(std::memory_order_relaxed);
+    progress.classesDone = _classesDone.load(std::memory_order_relaxed);
+    progress.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+    if (progress.bytesTotal > 0 && progress.bytesDone > 0 && progress.bytesDone <= progress.bytesTotal) {
+        double rate = static_cast<double>(progress.bytesDone) / progress.elapsedSeconds;
+        progress.etaSeconds = static_cast<double>(progress.bytesTotal - progress.bytesDone) / rate;
+    }
+    return progress;
+}
+
+void ExportProgressTracker::maybeReport() {
+    if (!_onProgress) return;
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+    int64_t due = _nextReportNs.load(std::memory_order_relaxed);
+    if (now < due) return;
+    // Whichever thread moves the deadline on makes the report
+    if (!_nextReportNs.compare_exchange_strong(due, now + _intervalNs, std::memory_order_relaxed)) return;
+    std::unique_lock<std::mutex> lock(_reporting, std::try_to_lock);
+    if (lock.owns_lock()) _onProgress(progress());
+}
+
+ExportJob::~ExportJob() {
+    cancel();
+    wait();
+}
+
+bool ExportJob::start(Work work, ExportProgressTracker::Callback onProgress, Done done) {
+    if (running()) return false;
+    // The previous job's thread has only its return left
+    wait();
+    _token.reset();
+    _running.store(true, std::memory_order_release);
+    _thread = std::thread([this, work = std::move(work), onProgress = std::move(onProgress), done = std::move(done)]() mutable {
+        ExportProgressTracker tracker(_token, std::move(onProgress));
+        ExportJobResult result;
+        try {
+            work(tracker);
+        }
+        catch (const ExportCancelled&) {
+            result.outcome = ExportJobOutcome::Cancelled;
+        }
+        catch (const std::exception& e) {
+            result.outcome = ExportJobOutcome::Failed;
+            result.error = e.what();
+        }
+        catch (...) {
+            result.outcome = ExportJobOutcome::Failed;
+            result.error = "unexpected error";
+        }
+        result.progress = tracker.progress();
+        _running.store(false, std::memory_order_release);
+        if (done) done(result);
+    });
+    return true;
+}
+
+void ExportJob::wait() {
+    if (_thread.joinable()) _thread.join();
+}
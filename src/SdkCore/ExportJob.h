@@ -0,0 +1,156 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Exports as background jobs: the work runs on a thread of its own, tells an
+// ExportProgressTracker how far it got, and stops between two classes once its
+// job is cancelled. The plugin and SdkFormatterCli both run their whole-dump
+// exports this way.
+//
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// Thrown by an export that found its job cancelled
+class ExportCancelled : public std::runtime_error {
+public:
+    ExportCancelled() : std::runtime_error("export cancelled") {}
+};
+
+// Asks a job to stop. cancel() only stores a lock-free flag, so a signal handler may call it.
+class CancellationToken {
+public:
+    void cancel() noexcept { _cancelled.store(true, std::memory_order_relaxed); }
+    bool cancelled() const noexcept { return _cancelled.load(std::memory_order_relaxed); }
+    void reset() noexcept { _cancelled.store(false, std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> _cancelled = false;
+    static_assert(std::atomic<bool>::is_always_lock_free, "cancel() must be safe in a signal handler");
+};
+
+struct ExportProgress {
+    uint64_t bytesDone = 0;
+    uint64_t bytesTotal = 0;  // 0 when it isn't known, e.g. for a compressed dump
+    uint64_t classesDone = 0;
+    double elapsedSeconds = 0;
+    double etaSeconds = -1;   // from the rate so far, < 0 until there is one
+};
+
+// "12.3 of 64.0 MB (19%), 4321 classes, 3 s left", or only the classes and time when the size isn't known
+std::string formatExportProgress(const ExportProgress& progress);
+
+//
+// How far one export got. The export calls advance() or advanceTo() after every
+// class, from any of its threads; each returns false once the token is cancelled,
+// and the export then throws ExportCancelled from the thread that drives it. At
+// most every `interval` one of those calls passes the totals to `onProgress`,
+// on the export's own thread.
+//
+class ExportProgressTracker {
+public:
+    using Callback = std::function<void(const ExportProgress& progress)>;
+
+    explicit ExportProgressTracker(const CancellationToken& token, Callback onProgress = {},
+                                   std::chrono::milliseconds interval = std::chrono::milliseconds(250));
+
+    // The dump text when it is exported in place: classes then count as far as
+    // where their name is in it. Also sets the total.
+    void setInput(std::string_view text);
+    void setTotalBytes(uint64_t bytes) { _bytesTotal.store(bytes, std::memory_order_relaxed); }
+
+    // `bytes` more of the input and `classes` more classes are done
+    bool advance(uint64_t bytes, uint64_t classes = 1);
+
+    // One more class is done, the one whose name is at `name`; a name outside the
+    // text given to setInput() only counts the class
+    bool advanceTo(const char* name);
+
+    bool cancelled() const { return _token.cancelled(); }
+    void throwIfCancelled() const {
+        if (cancelled()) throw ExportCancelled();
+    }
+
+    ExportProgress progress() const;
+
+private:
+    void maybeReport();
+
+    const CancellationToken& _token;
+    Callback _onProgress;
+    std::chrono::steady_clock::time_point _start;
+    int64_t _intervalNs;
+    std::atomic<int64_t> _nextReportNs;
+    std::mutex _reporting;  // one report at a time; a call that finds one running skips its turn
+    const char* _inputBegin = nullptr;
+    const char* _inputEnd = nullptr;
+    std::atomic<uint64_t> _bytesTotal = 0;
+    std::atomic<uint64_t> _bytesDone = 0;
+    std::atomic<uint64_t> _classesDone = 0;
+};
+
+enum class ExportJobOutcome { Completed, Cancelled, Failed };
+
+struct ExportJobResult {
+    ExportJobOutcome outcome = ExportJobOutcome::Completed;
+    std::string error;        // what the work threw, for Failed
+    ExportProgress progress;  // how far it got
+};
+
+//
+// Runs one export at a time on a thread of its own. `work` gets the job's tracker
+// and either returns, throws ExportCancelled or throws anything else, which makes
+// the outcome. `done` is then called on the job's thread, once running() has
+// turned false; a UI hands the result on to its own thread from there. start()
+// must not be called from `done` itself.
+//
+class ExportJob {
+public:
+    using Work = std::function<void(ExportProgressTracker& progress)>;
+    using Done = std::function<void(const ExportJobResult& result)>;
+
+    ExportJob() = default;
+    ~ExportJob();
+    ExportJob(const ExportJob&) = delete;
+    ExportJob& operator=(const ExportJob&) = delete;
+
+    // False, starting nothing, while another job is running
+    bool start(Work work, ExportProgressTracker::Callback onProgress, Done done);
+
+    void cancel() { _token.cancel(); }
+    bool running() const { return _running.load(std::memory_order_acquire); }
+
+    // Waits for the job's thread, `done` included
+    void wait();
+
+    // The running job's token, e.g. for a signal handler to cancel
+    CancellationToken& token() { return _token; }
+
+private:
+    CancellationToken _token;
+    std::atomic<bool> _running = false;
+    std::thread _thread;
+};
@@ -0,0 +1,382 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "FieldFilter.h"
+#include <charconv>
+#include <stdexcept>
+
+// Three-valued results used when only the class header is known
+static constexpr uint8_t FALSE3 = 0;
+static constexpr uint8_t TRUE3 = 1;
+static constexpr uint8_t UNKNOWN3 = 2;
+
+//
+// Tokenizer and recursive descent parser that emits FieldFilter bytecode
+//
+class FieldFilterCompiler {
+public:
+    FieldFilterCompiler(std::string_view text, FieldFilter& filter) : _text(text), _filter(filter) {}
+
+    void compile() {
+        next();
+        if (_token.kind == TokenKind::End) return; // an empty filter accepts everything
+        parseOr();
+        if (_token.kind != TokenKind::End) fail("unexpected '" + std::string(_token.text) + "'");
+    }
+
+private:
+    enum class TokenKind { End, Word, String, AndAnd, OrOr, Not, LParen, RParen, Equal, NotEqual, Match, NoMatch, Less, LessEqual, Greater, GreaterEqual };
+
+    struct Token {
+        TokenKind kind = TokenKind::End;
+        std::string_view text;
+        std::string value; // unescaped contents of a quoted string
+        size_t column = 0;
+    };
+
+    using Instruction = FieldFilter::Instruction;
+    using OpCode = FieldFilter::OpCode;
+    using Operand = FieldFilter::Operand;
+    using Compare = FieldFilter::Compare;
+
+    [[noreturn]] void fail(const std::string& what) const {
+        throw std::runtime_error("filter: " + what + " at column " + std::to_string(_token.column + 1));
+    }
+
+    static bool isWordChar(char c) {
+        return c != ' ' && c != '\t' && c != '\r' && c != '\n' && c != '(' && c != ')' && c != '!' && c != '&' && c != '|' && c != '=' && c != '<' && c != '>' && c != '~' && c != '"';
+    }
+
+    void next() {
+        while (_pos < _text.size() && (_text[_pos] == ' ' || _text[_pos] == '\t' || _text[_pos] == '\r' || _text[_pos] == '\n')) _pos++;
+        _token.column = _pos;
+        _token.value.clear();
+        if (_pos >= _text.size()) {
+            _token.kind = TokenKind::End;
+            _token.text = std::string_view();
+            return;
+        }
+
+        auto two = [&](char a, char b) { return _text[_pos] == a && _pos + 1 < _text.size() && _text[_pos + 1] == b; };
+        auto take = [&](TokenKind kind, size_t len) {
+            _token.kind = kind;
+            _token.text = _text.substr(_pos, len);
+            _pos += len;
+        };
+
+        if (two('&', '&')) return take(TokenKind::AndAnd, 2);
+        if (two('|', '|')) return take(TokenKind::OrOr, 2);
+        if (two('=', '=')) return take(TokenKind::Equal, 2);
+        if (two('!', '=')) return take(TokenKind::NotEqual, 2);
+        if (two('!', '~')) return take(TokenKind::NoMatch, 2);
+        if (two('<', '=')) return take(TokenKind::LessEqual, 2);
+        if (two('>', '=')) return take(TokenKind::GreaterEqual, 2);
+
+        switch (_text[_pos]) {
+        case '!': return take(TokenKind::Not, 1);
+        case '(': return take(TokenKind::LParen, 1);
+        case ')': return take(TokenKind::RParen, 1);
+        case '~': return take(TokenKind::Match, 1);
+        case '<': return take(TokenKind::Less, 1);
+        case '>': return take(TokenKind::Greater, 1);
+        case '"': {
+            // Only \" is an escape; backslashes are otherwise kept for the regex
+            size_t start = _pos++;
+            while (_pos < _text.size() && _text[_pos] != '"') {
+                if (_text[_pos] == '\\' && _pos + 1 < _text.size() && _text[_pos + 1] == '"') _pos++;
+                _token.value += _text[_pos++];
+            }
+            if (_pos >= _text.size()) fail("unterminated string");
+            _pos++;
+            _token.kind = TokenKind::String;
+            _token.text = _text.substr(start, _pos - start);
+            return;
+        }
+        default:
+            break;
+        }
+
+        if (!isWordChar(_text[_pos])) fail("unexpected character '" + std::string(1, _text[_pos]) + "'");
+        size_t start = _pos;
+        while (_pos < _text.size() && isWordChar(_text[_pos])) _pos++;
+        _token.kind = TokenKind::Word;
+        _token.text = _text.substr(start, _pos - start);
+        _token.value = std::string(_token.text);
+    }
+
+    size_t emit(OpCode op, size_t arg = 0) {
+        if (_filter._code.size() >= 0xFFFF) fail("expression is too long");
+        // Track the evaluation stack depth so the evaluators can use a fixed array
+        if (op == OpCode::Test && ++_depth > FieldFilter::MAX_STACK) fail("expression is nested too deeply");
+        if (op == OpCode::And || op == OpCode::Or) _depth--;
+        _filter._code.push_back({ op, static_cast<uint16_t>(arg) });
+        return _filter._code.size() - 1;
+    }
+
+    void patchJump(size_t at) {
+        _filter._code[at].arg = static_cast<uint16_t>(_filter._code.size());
+    }
+
+    void parseOr() {
+        parseAnd();
+        while (_token.kind == TokenKind::OrOr) {
+            next();
+            size_t jump = emit(OpCode::JumpIfTrue);
+            parseAnd();
+            emit(OpCode::Or);
+            patchJump(jump);
+        }
+    }
+
+    void parseAnd() {
+        parseUnary();
+        while (_token.kind == TokenKind::AndAnd) {
+            next();
+            size_t jump = emit(OpCode::JumpIfFalse);
+            parseUnary();
+            emit(OpCode::And);
+            patchJump(jump);
+        }
+    }
+
+    void parseUnary() {
+        if (_token.kind == TokenKind::Not) {
+            next();
+            parseUnary();
+            emit(OpCode::Not);
+            return;
+        }
+        if (_token.kind == TokenKind::LParen) {
+            next();
+            parseOr();
+            if (_token.kind != TokenKind::RParen) fail("expected ')'");
+            next();
+            return;
+        }
+        parseComparison();
+    }
+
+    void parseComparison() {
+        if (_token.kind != TokenKind::Word) fail("expected class, base, tag, name, type or offset");
+
+        FieldFilter::Predicate p;
+        std::string_view word = _token.text;
+        if (word == "class") p.operand = Operand::Class;
+        else if (word == "base") p.operand = Operand::Base;
+        else if (word == "tag") p.operand = Operand::Tag;
+        else if (word == "name") p.operand = Operand::Name;
+        else if (word == "type") p.operand = Operand::Type;
+        else if (word == "offset") p.operand = Operand::Offset;
+        else fail("unknown operand '" + std::string(word) + "'");
+        next();
+
+        switch (_token.kind) {
+        case TokenKind::Equal: p.compare = Compare::Equal; break;
+        case TokenKind::NotEqual: p.compare = Compare::NotEqual; break;
+        case TokenKind::Match: p.compare = Compare::Match; break;
+        case TokenKind::NoMatch: p.compare = Compare::NoMatch; break;
+        case TokenKind::Less: p.compare = Compare::Less; break;
+        case TokenKind::LessEqual: p.compare = Compare::LessEqual; break;
+        case TokenKind::Greater: p.compare = Compare::Greater; break;
+        case TokenKind::GreaterEqual: p.compare = Compare::GreaterEqual; break;
+        default: fail("expected a comparison operator");
+        }
+
+        bool ordered = p.compare >= Compare::Less;
+        bool regex = p.compare == Compare::Match || p.compare == Compare::NoMatch;
+        if (p.operand == Operand::Offset && regex) fail("offset can't be matched with ~");
+        if (p.operand != Operand::Offset && ordered) fail("only offset can be compared with < or >");
+        if (p.operand == Operand::Tag && regex) fail("tag can only be compared with == or !=");
+        next();
+
+        if (_token.kind != TokenKind::Word && _token.kind != TokenKind::String) fail("expected a value");
+        const std::string& value = _token.value;
+
+        if (p.operand == Operand::Tag) {
+            if (value == "I" || value == "instance") p.tag = FieldTag::Instance;
+            else if (value == "S" || value == "static") p.tag = FieldTag::Static;
+            else if (value == "C" || value == "const") p.tag = FieldTag::Const;
+            else fail("tag must be I, S or C");
+        }
+        else if (p.operand == Operand::Offset) {
+            bool hex = value.size() > 2 && value[0] == '0' && (value[1] == 'x' || value[1] == 'X');
+            const char* first = value.data() + (hex ? 2 : 0);
+            const char* last = value.data() + value.size();
+            auto result = std::from_chars(first, last, p.number, hex ? 16 : 10);
+            if (result.ec != std::errc() || result.ptr != last) fail("invalid offset '" + value + "'");
+        }
+        else if (regex) {
+            try {
+                _filter._regexes.emplace_back(value);
+            }
+            catch (const std::exception& e) {
+                fail(e.what());
+            }
+            p.regex = static_cast<int>(_filter._regexes.size() - 1);
+        }
+        else {
+            p.text = value;
+        }
+        next();
+
+        if (_filter._predicates.size() >= FieldFilter::MAX_PREDICATES) fail("too many comparisons");
+        _filter._predicates.push_back(std::move(p));
+        emit(OpCode::Test, _filter._predicates.size() - 1);
+    }
+
+    std::string_view _text;
+    size_t _pos = 0;
+    size_t _depth = 0;
+    Token _token;
+    FieldFilter& _filter;
+};
+
+FieldFilter FieldFilter::compile(std::string_view expression) {
+    FieldFilter filter;
+    filter._expression = std::string(expression);
+    FieldFilterCompiler(filter._expression, filter).compile();
+    return filter;
+}
+
+// Helper function to compare a string operand
+static inline bool compareText(std::string_view value, const std::string& text, bool equal) {
+    return (value == text) == equal;
+}
+
+bool FieldFilter::testClassPredicate(const Predicate& p, const DumpClassHeader& header) const {
+    std::string_view value = p.operand == Operand::Class ? header.name : header.bases;
+    switch (p.compare) {
+    case Compare::Equal: return compareText(value, p.text, true);
+    case Compare::NotEqual: return compareText(value, p.text, false);
+    case Compare::Match: return _regexes[static_cast<size_t>(p.regex)].search(value);
+    case Compare::NoMatch: return !_regexes[static_cast<size_t>(p.regex)].search(value);
+    default: return false;
+    }
+}
+
+bool FieldFilter::testFieldPredicate(const Predicate& p, const DumpField& field) const {
+    if (p.operand == Operand::Tag) {
+        return (field.tag == p.tag) == (p.compare == Compare::Equal);
+    }
+    if (p.operand == Operand::Offset) {
+        switch (p.compare) {
+        case Compare::Equal: return field.offset == p.number;
+        case Compare::NotEqual: return field.offset != p.number;
+        case Compare::Less: return field.offset < p.number;
+        case Compare::LessEqual: return field.offset <= p.number;
+        case Compare::Greater: return field.offset > p.number;
+        case Compare::GreaterEqual: return field.offset >= p.number;
+        default: return false;
+        }
+    }
+
+    std::string_view value = p.operand == Operand::Name ? field.name : field.type;
+    switch (p.compare) {
+    case Compare::Equal: return compareText(value, p.text, true);
+    case Compare::NotEqual: return compareText(value, p.text, false);
+    case Compare::Match: return _regexes[static_cast<size_t>(p.regex)].search(value);
+    case Compare::NoMatch: return !_regexes[static_cast<size_t>(p.regex)].search(value);
+    default: return false;
+    }
+}
+
+FieldFilter::ClassVerdict FieldFilter::beginClass(const DumpClassHeader& header, ClassContext& context) const {
+    context.classResults = 0;
+    if (_code.empty()) {
+        context.verdict = ClassVerdict::Accept;
+        return context.verdict;
+    }
+
+    // Evaluate with Kleene logic: field predicates are unknown at this point
+    uint8_t stack[MAX_STACK];
+    size_t top = 0;
+    for (size_t pc = 0; pc < _code.size(); pc++) {
+        const Instruction& ins = _code[pc];
+        switch (ins.op) {
+        case OpCode::Test: {
+            const Predicate& p = _predicates[ins.arg];
+            if (p.operand == Operand::Class || p.operand == Operand::Base) {
+                bool result = testClassPredicate(p, header);
+                if (result) context.classResults |= uint64_t(1) << ins.arg;
+                stack[top++] = result ? TRUE3 : FALSE3;
+            }
+            else {
+                stack[top++] = UNKNOWN3;
+            }
+            break;
+        }
+        case OpCode::Not:
+            if (stack[top - 1] != UNKNOWN3) stack[top - 1] = stack[top - 1] == TRUE3 ? FALSE3 : TRUE3;
+            break;
+        case OpCode::And: {
+            uint8_t b = stack[--top], a = stack[top - 1];
+            stack[top - 1] = (a == FALSE3 || b == FALSE3) ? FALSE3 : (a == TRUE3 && b == TRUE3) ? TRUE3 : UNKNOWN3;
+            break;
+        }
+        case OpCode::Or: {
+            uint8_t b = stack[--top], a = stack[top - 1];
+            stack[top - 1] = (a == TRUE3 || b == TRUE3) ? TRUE3 : (a == FALSE3 && b == FALSE3) ? FALSE3 : UNKNOWN3;
+            break;
+        }
+        case OpCode::JumpIfFalse:
+            if (stack[top - 1] == FALSE3) pc = static_cast<size_t>(ins.arg) - 1;
+            break;
+        case OpCode::JumpIfTrue:
+            if (stack[top - 1] == TRUE3) pc = static_cast<size_t>(ins.arg) - 1;
+            break;
+        }
+    }
+
+    context.verdict = stack[0] == TRUE3 ? ClassVerdict::Accept : stack[0] == FALSE3 ? ClassVerdict::Reject : ClassVerdict::PerField;
+    return context.verdict;
+}
+
+bool FieldFilter::acceptField(const ClassContext& context, const DumpField& field) const {
+    if (context.verdict != ClassVerdict::PerField) return context.verdict == ClassVerdict::Accept;
+
+    bool stack[MAX_STACK];
+    size_t top = 0;
+    for (size_t pc = 0; pc < _code.size(); pc++) {
+        const Instruction& ins = _code[pc];
+        switch (ins.op) {
+        case OpCode::Test: {
+            const Predicate& p = _predicates[ins.arg];
+            if (p.operand == Operand::Class || p.operand == Operand::Base) stack[top++] = (context.classResults >> ins.arg) & 1;
+            else stack[top++] = testFieldPredicate(p, field);
+            break;
+        }
+        case OpCode::Not:
+            stack[top - 1] = !stack[top - 1];
+            break;
+        case OpCode::And:
+            top--;
+            stack[top - 1] = stack[top - 1] && stack[top];
+            break;
+        case OpCode::Or:
+            top--;
+            stack[top - 1] = stack[top - 1] || stack[top];
+            break;
+        case OpCode::JumpIfFalse:
+            if (!stack[top - 1]) pc = static_cast<size_t>(ins.arg) - 1;
+            break;
+        case OpCode::JumpIfTrue:
+            if (stack[top - 1]) pc = static_cast<size_t>(ins.arg) - 1;
+            break;
+        }
+    }
+    return stack[0];
+}
@@ -0,0 +1,106 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Field filter expressions for selective export, e.g.
+//
+//     tag != C && !type ~ "^System\.Action" && class ~ "^EFT\."
+//
+// Operands:   class, base (per class)   tag, name, type, offset (per field)
+// Operators:  == != on everything, ~ !~ (regex search) on strings,
+//             < <= > >= on offset. Combine with && || ! and parentheses.
+// Values:     bare words or "quoted strings"; tags are I, S or C; offsets are
+//             hex with a 0x prefix, decimal otherwise.
+//
+// An expression is compiled once into a flat bytecode program. Evaluation uses a
+// fixed-size stack and never allocates, so it can run inside the parse loop.
+//
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "DfaRegex.h"
+#include "DumpParser.h"
+
+class FieldFilter {
+public:
+    // What is known about a class once its header has been seen
+    enum class ClassVerdict : uint8_t {
+        Reject,   // no field of this class can pass
+        Accept,   // every field passes, no need to evaluate them
+        PerField, // depends on the fields
+    };
+
+    // Per-class evaluation state, filled by beginClass()
+    struct ClassContext {
+        uint64_t classResults = 0; // values of the class-level predicates
+        ClassVerdict verdict = ClassVerdict::Accept;
+    };
+
+    FieldFilter() = default;
+
+    // Throws std::runtime_error with the column of the problem on syntax errors
+    static FieldFilter compile(std::string_view expression);
+
+    bool empty() const { return _code.empty(); }
+    const std::string& expression() const { return _expression; }
+
+    ClassVerdict beginClass(const DumpClassHeader& header, ClassContext& context) const;
+    bool acceptField(const ClassContext& context, const DumpField& field) const;
+
+private:
+    enum class Operand : uint8_t { Class, Base, Tag, Name, Type, Offset };
+    enum class Compare : uint8_t { Equal, NotEqual, Match, NoMatch, Less, LessEqual, Greater, GreaterEqual };
+
+    struct Predicate {
+        Operand operand;
+        Compare compare;
+        FieldTag tag = FieldTag::Instance;
+        uint64_t number = 0;
+        std::string text;
+        int regex = -1;
+    };
+
+    enum class OpCode : uint8_t {
+        Test,          // push predicate `arg`
+        Not,
+        And,
+        Or,
+        JumpIfFalse,   // short-circuit for &&: if top is false skip to `arg`, keeping it
+        JumpIfTrue,    // short-circuit for ||
+    };
+
+    struct Instruction {
+        OpCode op;
+        uint16_t arg;
+    };
+
+    static constexpr size_t MAX_PREDICATES = 64;
+    static constexpr size_t MAX_STACK = 64;
+
+    friend class FieldFilterCompiler;
+
+    bool testFieldPredicate(const Predicate& p, const DumpField& field) const;
+    bool testClassPredicate(const Predicate& p, const DumpClassHeader& header) const;
+
+    std::string _expression;
+    std::vector<Predicate> _predicates;
+    std::vector<Instruction> _code;
+    std::vector<DfaRegex> _regexes;
+};
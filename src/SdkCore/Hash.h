@@ -0,0 +1,57 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Fast non-cryptographic 64-bit hash, 8 bytes per step. Used to fingerprint
+// dumps and class blocks; the values are persisted, so don't change the mixing.
+//
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+inline uint64_t hashMix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+inline uint64_t hashBytes(const void* data, size_t size, uint64_t seed = 0) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t h = seed ^ (static_cast<uint64_t>(size) * 0x9E3779B97F4A7C15ull);
+    while (size >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        h = (h ^ hashMix(word)) * 0x9E3779B97F4A7C15ull;
+        p += 8;
+        size -= 8;
+    }
+    if (size) {
+        uint64_t word = 0;
+        std::memcpy(&word, p, size);
+        h = (h ^ hashMix(word)) * 0x9E3779B97F4A7C15ull;
+    }
+    return hashMix(h);
+}
+
+inline uint64_t hashString(std::string_view s, uint64_t seed = 0) {
+    return hashBytes(s.data(), s.size(), seed);
+}
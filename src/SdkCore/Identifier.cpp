@@ -0,0 +1,264 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "Identifier.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include "Hash.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SDKCORE_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+enum CharClass : uint8_t {
+    Word,      // letter or '_'
+    Digit,
+    Backslash, // may start a \uXXXX escape
+    NonAscii,  // part of a UTF-8 sequence
+    Other,     // anything else becomes '_'
+};
+
+constexpr std::array<CharClass, 256> CHAR_CLASSES = [] {
+    std::array<CharClass, 256> table{};
+    for (size_t c = 0; c < 256; c++) {
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_') table[c] = Word;
+        else if (c >= '0' && c <= '9') table[c] = Digit;
+        else if (c == '\\') table[c] = Backslash;
+        else if (c >= 0x80) table[c] = NonAscii;
+        else table[c] = Other;
+    }
+    return table;
+}();
+
+inline CharClass classOf(char c) { return CHAR_CLASSES[static_cast<unsigned char>(c)]; }
+
+inline bool isHexDigit(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+// Helper function to check that name[from, from + count) are all hex digits
+bool hexDigitsAt(std::string_view name, size_t from, size_t count) {
+    if (name.size() - from < count) return false;
+    for (size_t i = 0; i < count; i++) {
+        if (!isHexDigit(name[from + i])) return false;
+    }
+    return true;
+}
+
+// Helper function to decode one UTF-8 sequence; returns its length, or 0 if it isn't valid
+size_t decodeUtf8(std::string_view text, size_t i, uint32_t& codePoint) {
+    unsigned char lead = static_cast<unsigned char>(text[i]);
+    size_t length = lead >= 0xF0 && lead <= 0xF4 ? 4 : lead >= 0xE0 ? (lead <= 0xEF ? 3 : 0) : lead >= 0xC2 ? 2 : 0;
+    if (length == 0 || text.size() - i < length) return 0;
+    uint32_t c = lead & (0x7F >> length);
+    for (size_t k = 1; k < length; k++) {
+        unsigned char next = static_cast<unsigned char>(text[i + k]);
+        if ((next & 0xC0) != 0x80) return 0;
+        c = (c << 6) | (next & 0x3F);
+    }
+    static constexpr uint32_t smallest[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (c < smallest[length] || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return 0;
+    codePoint = c;
+    return length;
+}
+
+// Helper function to write a code point the way the dumper escapes it: _uXXXX, or _UXXXXXXXX past the BMP
+void appendEscape(std::string& out, uint32_t codePoint) {
+    static constexpr char HEX[] = "0123456789ABCDEF";
+    int digits = codePoint > 0xFFFF ? 8 : 4;
+    out += '_';
+    out += digits == 8 ? 'U' : 'u';
+    for (int shift = (digits - 1) * 4; shift >= 0; shift -= 4) out += HEX[(codePoint >> shift) & 0xF];
+}
+
+// Helper function to reduce the compiler's "<Name>k__BackingField" to "Name"
+std::string_view backingFieldName(std::string_view name) {
+    static constexpr std::string_view SUFFIX = ">k__BackingField";
+    if (name.size() > SUFFIX.size() + 1 && name.front() == '<' && name.ends_with(SUFFIX)) {
+        return name.substr(1, name.size() - SUFFIX.size() - 1);
+    }
+    return name;
+}
+
+} // namespace
+
+bool isPlainIdentifier(std::string_view name) {
+    if (name.empty() || classOf(name[0]) != Word) return false;
+    size_t i = 1;
+#ifdef SDKCORE_HAVE_SSE2
+    // 16 bytes at a time: fold case, then letters, digits and '_' are three byte ranges
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    for (; i + 16 <= name.size(); i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(name.data() + i));
+        __m128i lower = _mm_or_si128(v, caseBit);
+        __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+        __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), underscore)) != 0xFFFF) return false;
+    }
+#endif
+    for (; i < name.size(); i++) {
+        CharClass c = classOf(name[i]);
+        if (c != Word && c != Digit) return false;
+    }
+    return true;
+}
+
+void appendIdentifier(std::string& out, std::string_view name) {
+    if (name.starts_with("-.")) name.remove_prefix(2);
+    name = backingFieldName(name);
+    if (isPlainIdentifier(name)) {
+        out += name;
+        return;
+    }
+
+    size_t start = out.size();
+    for (size_t i = 0; i < name.size();) {
+        char c = name[i];
+        switch (classOf(c)) {
+        case Word:
+        case Digit:
+            out += c;
+            i++;
+            break;
+        case Backslash:
+            // The dumper writes unprintable characters as \uXXXX
+            if (i + 1 < name.size() && name[i + 1] == 'u' && hexDigitsAt(name, i + 2, 4)) {
+                out += "_u";
+                out.append(name.substr(i + 2, 4));
+                i += 6;
+            }
+            else {
+                out += '_';
+                i++;
+            }
+            break;
+        case NonAscii: {
+            // Real characters (from a UTF-16 dump) are spelled like the escapes
+            uint32_t codePoint = 0;
+            size_t length = decodeUtf8(name, i, codePoint);
+            if (length) appendEscape(out, codePoint);
+            else out += '_';
+            i += length ? length : 1;
+            break;
+        }
+        default:
+            out += '_';
+            i++;
+            break;
+        }
+    }
+    if (out.size() == start) out += '_';
+    else if (classOf(out[start]) == Digit) out.insert(out.begin() + static_cast<std::ptrdiff_t>(start), '_');
+}
+
+std::string_view IdentifierTable::get(std::string_view name, bool* added) {
+    auto found = _identifiers.find(name);
+    if (found != _identifiers.end()) {
+        if (added) *added = false;
+        return found->second;
+    }
+    if (added) *added = true;
+
+    std::string identifier = makeIdentifier(name);
+    if (_taken.count(identifier)) {
+        size_t base = identifier.size();
+        for (size_t n = 2;; n++) {
+            identifier.resize(base);
+            identifier += '_';
+            identifier += std::to_string(n);
+            if (!_taken.count(identifier)) break;
+        }
+    }
+    std::string_view key = _storage.emplace_back(name);
+    std::string_view value = _storage.emplace_back(std::move(identifier));
+    _identifiers.emplace(key, value);
+    _taken.insert(value);
+    return value;
+}
+
+void IdentifierTable::clear() {
+    _identifiers.clear();
+    _taken.clear();
+    _storage.clear();
+}
+
+void IdentifierScope::clear() {
+    _text.clear();
+    _entries.clear();
+    if (++_generation == 0) {
+        // Wrapped around: stamps from 2^32 classes ago would look current
+        for (Slot& slot : _slots) slot.generation = 0;
+        _generation = 1;
+    }
+}
+
+bool IdentifierScope::contains(std::string_view identifier, uint64_t hash) const {
+    if (_slots.empty()) return false;
+    size_t mask = _slots.size() - 1;
+    for (size_t i = static_cast<size_t>(hash) & mask;; i = (i + 1) & mask) {
+        const Slot& slot = _slots[i];
+        if (slot.generation != _generation) return false;
+        const Entry& entry = _entries[slot.entry];
+        if (std::string_view(_text).substr(entry.offset, entry.length) == identifier) return true;
+    }
+}
+
+void IdentifierScope::insert(std::string_view identifier, uint64_t hash) {
+    if ((_entries.size() + 1) * 2 > _slots.size()) grow();
+    _entries.push_back({ static_cast<uint32_t>(_text.size()), static_cast<uint32_t>(identifier.size()) });
+    _text += identifier;
+    size_t mask = _slots.size() - 1;
+    size_t i = static_cast<size_t>(hash) & mask;
+    while (_slots[i].generation == _generation) i = (i + 1) & mask;
+    _slots[i] = { _generation, static_cast<uint32_t>(_entries.size() - 1) };
+}
+
+void IdentifierScope::grow() {
+    std::vector<Slot> slots(std::max<size_t>(64, _slots.size() * 2));
+    size_t mask = slots.size() - 1;
+    for (uint32_t e = 0; e < _entries.size(); e++) {
+        const Entry& entry = _entries[e];
+        size_t i = static_cast<size_t>(hashString(std::string_view(_text).substr(entry.offset, entry.length))) & mask;
+        while (slots[i].generation == _generation) i = (i + 1) & mask;
+        slots[i] = { _generation, e };
+    }
+    _slots = std::move(slots);
+}
+
+void IdentifierScope::claim(std::string& out, size_t start) {
+    std::string_view identifier = std::string_view(out).substr(start);
+    uint64_t hash = hashString(identifier);
+    if (contains(identifier, hash)) {
+        size_t base = out.size();
+        char digits[24];
+        for (size_t n = 2;; n++) {
+            out.resize(base);
+            out += '_';
+            out.append(digits, std::to_chars(digits, digits + sizeof(digits), n).ptr);
+            identifier = std::string_view(out).substr(start);
+            hash = hashString(identifier);
+            if (!contains(identifier, hash)) break;
+        }
+    }
+    insert(identifier, hash);
+}
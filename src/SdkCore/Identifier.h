@@ -0,0 +1,103 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Turning dump names into identifiers that compile in C#, C++ and Rust. Every
+// exporter and the plugin go through here, so the same class gets the same
+// struct name whichever way it is exported:
+//     EFT.InventoryLogic.Item           EFT_InventoryLogic_Item
+//     -.ClientLocalGameWorld            ClientLocalGameWorld     ("-." is the dumper's empty namespace)
+//     -.Player.\uE010                   Player__uE010            (\uXXXX escapes stay readable)
+//     <MovementContext>k__BackingField  MovementContext          (as in Lone's SDK.cs)
+//     Outer+Nested, <>c, 1st            Outer_Nested, __c, _1st
+// Characters are classified through a 256-entry table, never through the C locale.
+//
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// True if `name` is already a valid identifier and would be written unchanged
+bool isPlainIdentifier(std::string_view name);
+
+// Appends `name` made into an identifier (never empty, never starting with a digit)
+void appendIdentifier(std::string& out, std::string_view name);
+
+inline std::string makeIdentifier(std::string_view name) {
+    std::string out;
+    appendIdentifier(out, name);
+    return out;
+}
+
+//
+// Memoised identifiers for a set of names, e.g. every class of an export. The
+// same name always gets the same identifier; a different name that comes out
+// the same as an earlier one gets "_2", "_3", ... appended, in the order the
+// names are first seen. Returned views stay valid until clear().
+//
+class IdentifierTable {
+public:
+    // `added`, if given, is set to whether `name` hadn't been seen before
+    std::string_view get(std::string_view name, bool* added = nullptr);
+
+    size_t size() const { return _identifiers.size(); }
+    void clear();
+
+private:
+    std::deque<std::string> _storage; // interned names and identifiers, stable addresses
+    std::unordered_map<std::string_view, std::string_view> _identifiers;
+    std::unordered_set<std::string_view> _taken;
+};
+
+//
+// The identifiers used within one scope, such as the fields of a class. Unlike
+// IdentifierTable it doesn't remember names and doesn't allocate once warmed up;
+// clear() is O(1), so it can be reset for every class.
+//
+class IdentifierScope {
+public:
+    void clear();
+
+    // Records the identifier at out[start..], first appending "_2", "_3", ...
+    // if the scope already has it
+    void claim(std::string& out, size_t start);
+
+private:
+    bool contains(std::string_view identifier, uint64_t hash) const;
+    void insert(std::string_view identifier, uint64_t hash);
+    void grow();
+
+    struct Slot {
+        uint32_t generation = 0; // the slot is empty unless this is the current generation
+        uint32_t entry = 0;
+    };
+    struct Entry {
+        uint32_t offset; // into _text
+        uint32_t length;
+    };
+    std::string _text; // identifiers of the current generation, back to back
+    std::vector<Entry> _entries;
+    std::vector<Slot> _slots;
+    uint32_t _generation = 1;
+};
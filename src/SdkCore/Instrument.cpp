@@ -0,0 +1,233 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "Instrument.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct InstrumentEvent {
+    InstrumentStage stage;
+    uint64_t start;      // nanoseconds since the first recording
+    uint64_t duration;
+};
+
+// What one thread recorded
+struct ThreadBlock {
+    InstrumentStageTotals stages[INSTRUMENT_STAGE_COUNT];
+    uint64_t counters[INSTRUMENT_COUNTER_COUNT] = {};
+    std::vector<InstrumentEvent> events;
+    uint32_t id = 0;
+};
+
+// Events kept per thread for the trace; the totals keep counting past it
+constexpr size_t MAX_EVENTS = 1 << 16;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBlock>> blocks; // kept after their thread ends
+    std::atomic<uint64_t (*)()> allocations{ nullptr };
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+[[maybe_unused]] ThreadBlock& threadBlock() {
+    thread_local ThreadBlock* block = nullptr;
+    if (!block) {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.blocks.push_back(std::make_unique<ThreadBlock>());
+        block = r.blocks.back().get();
+        block->id = static_cast<uint32_t>(r.blocks.size());
+    }
+    return *block;
+}
+
+[[maybe_unused]] uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - registry().epoch).count());
+}
+
+[[maybe_unused]] uint64_t threadAllocations() {
+    uint64_t (*count)() = registry().allocations.load(std::memory_order_relaxed);
+    return count ? count() : 0;
+}
+
+// Helper function to append printf-style text
+template <typename... Args>
+void appendFormat(std::string& out, const char* format, Args... args) {
+    char buffer[256];
+    int length = snprintf(buffer, sizeof(buffer), format, args...);
+    if (length > 0) out.append(buffer, std::min(static_cast<size_t>(length), sizeof(buffer) - 1));
+}
+
+} // namespace
+
+const char* instrumentStageName(InstrumentStage stage) {
+    static const char* names[] = { "read", "decode", "index", "parse", "format", "convert", "write" };
+    static_assert(sizeof(names) / sizeof(names[0]) == INSTRUMENT_STAGE_COUNT, "a name per stage");
+    return stage < InstrumentStage::Count ? names[static_cast<size_t>(stage)] : "?";
+}
+
+const char* instrumentCounterName(InstrumentCounter counter) {
+    static const char* names[] = { "bytes_in", "bytes_out", "classes", "fields", "duplicate_classes", "filtered_classes",
+                                   "filtered_fields", "blank_lines", "unparsed_lines", "orphan_fields" };
+    static_assert(sizeof(names) / sizeof(names[0]) == INSTRUMENT_COUNTER_COUNT, "a name per counter");
+    return counter < InstrumentCounter::Count ? names[static_cast<size_t>(counter)] : "?";
+}
+
+#if defined(SDKCORE_INSTRUMENT)
+
+void instrumentCount(InstrumentCounter counter, uint64_t value) {
+    threadBlock().counters[static_cast<size_t>(counter)] += value;
+}
+
+InstrumentScope::InstrumentScope(InstrumentStage stage) : _stage(stage), _start(nowNs()), _allocations(threadAllocations()) {}
+
+InstrumentScope::~InstrumentScope() {
+    uint64_t end = nowNs();
+    ThreadBlock& block = threadBlock();
+    InstrumentStageTotals& totals = block.stages[static_cast<size_t>(_stage)];
+    totals.calls++;
+    totals.nanoseconds += end - _start;
+    totals.allocations += threadAllocations() - _allocations;
+    if (block.events.size() < MAX_EVENTS) block.events.push_back({ _stage, _start, end - _start });
+}
+
+#else
+
+void instrumentCount(InstrumentCounter, uint64_t) {}
+
+InstrumentScope::InstrumentScope(InstrumentStage stage) : _stage(stage), _start(0), _allocations(0) {}
+
+InstrumentScope::~InstrumentScope() = default;
+
+#endif
+
+void setInstrumentAllocationCounter(uint64_t (*threadAllocations)()) {
+    registry().allocations.store(threadAllocations, std::memory_order_relaxed);
+}
+
+InstrumentReport collectInstrumentReport() {
+    InstrumentReport report;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const auto& block : r.blocks) {
+        bool used = false;
+        for (size_t i = 0; i < INSTRUMENT_STAGE_COUNT; i++) {
+            report.stages[i].calls += block->stages[i].calls;
+            report.stages[i].nanoseconds += block->stages[i].nanoseconds;
+            report.stages[i].allocations += block->stages[i].allocations;
+            used |= block->stages[i].calls != 0;
+        }
+        for (size_t i = 0; i < INSTRUMENT_COUNTER_COUNT; i++) {
+            report.counters[i] += block->counters[i];
+            used |= block->counters[i] != 0;
+        }
+        report.threads += used;
+    }
+    return report;
+}
+
+void resetInstrument() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const auto& block : r.blocks) {
+        for (InstrumentStageTotals& totals : block->stages) totals = InstrumentStageTotals();
+        for (uint64_t& counter : block->counters) counter = 0;
+        block->events.clear();
+    }
+}
+
+std::string formatInstrumentText(const InstrumentReport& report) {
+    if (!INSTRUMENT_COMPILED_IN) return "instrumentation is not compiled in (define SDKCORE_INSTRUMENT)\n";
+    std::string out;
+    appendFormat(out, "%-10s %8s %12s %12s\n", "stage", "calls", "time ms", "allocations");
+    for (size_t i = 0; i < INSTRUMENT_STAGE_COUNT; i++) {
+        const InstrumentStageTotals& stage = report.stages[i];
+        if (stage.calls == 0) continue;
+        appendFormat(out, "%-10s %8llu %12.3f %12llu\n", instrumentStageName(static_cast<InstrumentStage>(i)),
+            static_cast<unsigned long long>(stage.calls), static_cast<double>(stage.nanoseconds) / 1e6,
+            static_cast<unsigned long long>(stage.allocations));
+    }
+    for (size_t i = 0; i < INSTRUMENT_COUNTER_COUNT; i++) {
+        appendFormat(out, "%-18s %15llu\n", instrumentCounterName(static_cast<InstrumentCounter>(i)), static_cast<unsigned long long>(report.counters[i]));
+    }
+    appendFormat(out, "%-18s %15zu\n", "threads", report.threads);
+    return out;
+}
+
+std::string formatInstrumentJson(const InstrumentReport& report) {
+    std::string out;
+    appendFormat(out, "{\"compiled_in\":%s,\"threads\":%zu,\"stages\":{", INSTRUMENT_COMPILED_IN ? "true" : "false", report.threads);
+    bool first = true;
+    for (size_t i = 0; i < INSTRUMENT_STAGE_COUNT; i++) {
+        const InstrumentStageTotals& stage = report.stages[i];
+        if (stage.calls == 0) continue;
+        appendFormat(out, "%s\"%s\":{\"calls\":%llu,\"ms\":%.3f,\"allocations\":%llu}", first ? "" : ",",
+            instrumentStageName(static_cast<InstrumentStage>(i)), static_cast<unsigned long long>(stage.calls),
+            static_cast<double>(stage.nanoseconds) / 1e6, static_cast<unsigned long long>(stage.allocations));
+        first = false;
+    }
+    out += "},\"counters\":{";
+    for (size_t i = 0; i < INSTRUMENT_COUNTER_COUNT; i++) {
+        appendFormat(out, "%s\"%s\":%llu", i ? "," : "", instrumentCounterName(static_cast<InstrumentCounter>(i)),
+            static_cast<unsigned long long>(report.counters[i]));
+    }
+    out += "}}\n";
+    return out;
+}
+
+std::string formatInstrumentTrace() {
+    InstrumentReport report = collectInstrumentReport();
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    uint64_t end = 0;
+    bool first = true;
+    {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& block : r.blocks) {
+            if (block->events.empty()) continue;
+            appendFormat(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}",
+                first ? "" : ",", block->id, block->id);
+            first = false;
+            for (const InstrumentEvent& event : block->events) {
+                appendFormat(out, ",{\"name\":\"%s\",\"cat\":\"sdkcore\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    instrumentStageName(event.stage), block->id, static_cast<double>(event.start) / 1e3, static_cast<double>(event.duration) / 1e3);
+                end = std::max(end, event.start + event.duration);
+            }
+        }
+    }
+    // The counters as one counter event at the end of the trace
+    appendFormat(out, "%s{\"name\":\"counters\",\"ph\":\"C\",\"pid\":1,\"tid\":0,\"ts\":%.3f,\"args\":{", first ? "" : ",", static_cast<double>(end) / 1e3);
+    for (size_t i = 0; i < INSTRUMENT_COUNTER_COUNT; i++) {
+        appendFormat(out, "%s\"%s\":%llu", i ? "," : "", instrumentCounterName(static_cast<InstrumentCounter>(i)),
+            static_cast<unsigned long long>(report.counters[i]));
+    }
+    out += "}}]}\n";
+    return out;
+}
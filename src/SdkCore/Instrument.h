@@ -0,0 +1,133 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Optional instrumentation of the conversion paths: time, calls and allocations
+// per stage, and counts of bytes, classes, fields, duplicates and skipped lines.
+// It is compiled in only when SDKCORE_INSTRUMENT is defined; otherwise the
+// SDK_INSTRUMENT_* macros expand to nothing and the reports below are empty.
+//
+// Every thread records into a block of its own, without locks or atomics, and
+// the blocks are summed when a report is made, so read the report after the
+// work is done. Stages are timed around whole passes (a scan, a worker's share
+// of a parallel phase, a written chunk), never around single lines or classes,
+// and counts are added once per pass from counters the code keeps anyway; that
+// keeps the cost well under 1%. The streaming exports parse and format in one
+// pass, recorded as Convert; the parallel export's phase one parses and
+// measures every class (Parse) and phase two formats it again (Format).
+//
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class InstrumentStage : uint8_t {
+    Read,      // getting the dump text: editor buffer, file mapping
+    Decode,    // decompression, UTF-16 conversion, UTF-8 validation
+    Index,     // finding the class blocks (LazyDump)
+    Parse,     // parsing class blocks
+    Format,    // formatting parsed classes
+    Convert,   // parsing and formatting in a single streaming pass
+    Write,     // writing output files
+    Count
+};
+
+enum class InstrumentCounter : uint8_t {
+    BytesIn,            // dump text scanned
+    BytesOut,           // output written
+    Classes,            // classes exported
+    Fields,             // fields exported
+    DuplicateClasses,   // classes dropped because the name was already exported
+    FilteredClasses,
+    FilteredFields,
+    BlankLines,         // skipped: empty lines
+    UnparsedLines,      // skipped: neither a class header nor a field
+    OrphanFields,       // skipped: fields outside an exported class
+    Count
+};
+
+constexpr size_t INSTRUMENT_STAGE_COUNT = static_cast<size_t>(InstrumentStage::Count);
+constexpr size_t INSTRUMENT_COUNTER_COUNT = static_cast<size_t>(InstrumentCounter::Count);
+
+#if defined(SDKCORE_INSTRUMENT)
+constexpr bool INSTRUMENT_COMPILED_IN = true;
+#else
+constexpr bool INSTRUMENT_COMPILED_IN = false;
+#endif
+
+const char* instrumentStageName(InstrumentStage stage);
+const char* instrumentCounterName(InstrumentCounter counter);
+
+// Adds `value` to a counter of the calling thread
+void instrumentCount(InstrumentCounter counter, uint64_t value);
+
+// Times a stage on the calling thread from construction to destruction
+class InstrumentScope {
+public:
+    explicit InstrumentScope(InstrumentStage stage);
+    ~InstrumentScope();
+    InstrumentScope(const InstrumentScope&) = delete;
+    InstrumentScope& operator=(const InstrumentScope&) = delete;
+
+private:
+    InstrumentStage _stage;
+    uint64_t _start;
+    uint64_t _allocations;
+};
+
+#if defined(SDKCORE_INSTRUMENT)
+#define SDK_INSTRUMENT_JOIN2(a, b) a##b
+#define SDK_INSTRUMENT_JOIN(a, b) SDK_INSTRUMENT_JOIN2(a, b)
+#define SDK_INSTRUMENT_STAGE(stage) InstrumentScope SDK_INSTRUMENT_JOIN(instrumentScope, __LINE__)(InstrumentStage::stage)
+#define SDK_INSTRUMENT_COUNT(counter, value) instrumentCount(InstrumentCounter::counter, static_cast<uint64_t>(value))
+#else
+#define SDK_INSTRUMENT_STAGE(stage) static_cast<void>(0)
+#define SDK_INSTRUMENT_COUNT(counter, value) static_cast<void>(0)
+#endif
+
+//
+// Where stage allocations come from: a function returning how many allocations
+// the calling thread has made so far. SdkCore doesn't replace operator new, so
+// without one (the default) allocations are reported as 0.
+//
+void setInstrumentAllocationCounter(uint64_t (*threadAllocations)());
+
+struct InstrumentStageTotals {
+    uint64_t calls = 0;
+    uint64_t nanoseconds = 0;   // summed over threads, so it can exceed wall time
+    uint64_t allocations = 0;
+};
+
+struct InstrumentReport {
+    InstrumentStageTotals stages[INSTRUMENT_STAGE_COUNT];
+    uint64_t counters[INSTRUMENT_COUNTER_COUNT] = {};
+    size_t threads = 0;         // threads that recorded anything
+};
+
+// Sums every thread's block
+InstrumentReport collectInstrumentReport();
+
+// Clears every thread's block; call it between runs, not while one is going
+void resetInstrument();
+
+// The report as an aligned table, as a JSON object, or every timed stage as
+// Chrome trace events for chrome://tracing or Perfetto (with the counters)
+std::string formatInstrumentText(const InstrumentReport& report);
+std::string formatInstrumentJson(const InstrumentReport& report);
+std::string formatInstrumentTrace();
@@ -0,0 +1,304 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "IoUringWriter.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+
+// Direct descriptors on openat and close (5.15) are what the chains need; the
+// CQE skip feature (5.17) is the first one that tells us they are there
+#if defined(IORING_FEAT_CQE_SKIP)
+#define SDKCORE_HAVE_IO_URING 1
+#endif
+
+#ifdef SDKCORE_HAVE_IO_URING
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace {
+
+int ioUringSetup(unsigned entries, io_uring_params* params) {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int ioUringEnter(int ring, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+int ioUringRegister(int ring, unsigned opcode, const void* arg, unsigned count) {
+    return static_cast<int>(::syscall(__NR_io_uring_register, ring, opcode, arg, count));
+}
+
+unsigned loadAcquire(unsigned* p) { return std::atomic_ref<unsigned>(*p).load(std::memory_order_acquire); }
+void storeRelease(unsigned* p, unsigned value) { std::atomic_ref<unsigned>(*p).store(value, std::memory_order_release); }
+
+// user_data of a chain's operations: slot * 4 + step. STEP_RELEASE is the close
+// that runRound() adds when the chain's own was cancelled.
+constexpr uint64_t STEP_OPEN = 0, STEP_WRITE = 1, STEP_CLOSE = 2, STEP_RELEASE = 3;
+
+} // namespace
+
+IoUringWriter::~IoUringWriter() {
+    if (_sqes) ::munmap(_sqes, _sqesSize);
+    if (_cqRing && _cqRing != _sqRing) ::munmap(_cqRing, _cqRingSize);
+    if (_sqRing) ::munmap(_sqRing, _sqRingSize);
+    // Closing the ring also closes any direct descriptor left in its table
+    if (_ring >= 0) ::close(_ring);
+}
+
+bool IoUringWriter::init(unsigned depth, size_t bufferSize) {
+    if (_ring >= 0) return true;
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int ring = ioUringSetup(depth * 3, &params);
+    if (ring < 0) return false;
+    _ring = ring;
+    if (!(params.features & IORING_FEAT_CQE_SKIP) || !(params.features & IORING_FEAT_NODROP)) return false;
+
+    // Every operation of the chain must be supported
+    std::vector<unsigned char> probeBytes(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(probeBytes.data());
+    if (ioUringRegister(ring, IORING_REGISTER_PROBE, probe, 256) < 0) return false;
+    for (int op : { IORING_OP_OPENAT, IORING_OP_WRITE, IORING_OP_WRITE_FIXED, IORING_OP_CLOSE }) {
+        if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) return false;
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize);
+    void* sqRing = ::mmap(nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED) return false;
+    _sqRing = sqRing;
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        _cqRing = _sqRing;
+    }
+    else {
+        void* cqRing = ::mmap(nullptr, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED) return false;
+        _cqRing = cqRing;
+    }
+    _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = ::mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) return false;
+    _sqes = sqes;
+
+    char* sq = static_cast<char*>(_sqRing);
+    char* cq = static_cast<char*>(_cqRing);
+    _sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    _sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    _sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    _cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = cq + params.cq_off.cqes;
+
+    // One direct descriptor slot per chain in flight, all empty to begin with
+    _depth = std::min(depth, params.sq_entries / 3);
+    std::vector<int> slots(_depth, -1);
+    if (ioUringRegister(ring, IORING_REGISTER_FILES, slots.data(), _depth) < 0) return false;
+    _chains.resize(_depth);
+
+    // The registered buffer counts against RLIMIT_MEMLOCK; without it, writes
+    // read straight from the caller's strings instead
+    _buffer.resize(bufferSize);
+    iovec buffer = { _buffer.data(), _buffer.size() };
+    _fixedBuffer = ioUringRegister(ring, IORING_REGISTER_BUFFERS, &buffer, 1) == 0;
+    return true;
+}
+
+bool IoUringWriter::available() {
+    static const bool result = [] {
+        IoUringWriter probe;
+        return probe.init(4, 4096);
+    }();
+    return result;
+}
+
+void IoUringWriter::write(const std::vector<ShardFile>& batch, std::vector<const ShardFile*>& failed) {
+    if (_ring < 0 || _depth == 0) {
+        for (const ShardFile& file : batch) failed.push_back(&file);
+        return;
+    }
+
+    for (const ShardFile& file : batch) {
+        // Files over 4 GB don't fit one write
+        if (file.data.size() > UINT32_MAX) {
+            failed.push_back(&file);
+            continue;
+        }
+
+        // Small files are copied into the registered buffer; ones that don't fit in
+        // what is left of it wait for the next round, and ones bigger than all of it
+        // are written from the string
+        bool copy = _fixedBuffer && file.data.size() <= _buffer.size();
+        if (_queued == _depth || (copy && _bufferUsed + file.data.size() > _buffer.size())) runRound(failed);
+
+        unsigned slot = _queued++;
+        Chain& chain = _chains[slot];
+        chain = { &file, 3, false, false };
+
+        const char* data = file.data.data();
+        if (copy) {
+            std::memcpy(_buffer.data() + _bufferUsed, data, file.data.size());
+            data = _buffer.data() + _bufferUsed;
+            _bufferUsed += file.data.size();
+        }
+
+        io_uring_sqe* sqes = static_cast<io_uring_sqe*>(_sqes);
+        unsigned tail = *_sqTail;
+        auto next = [&](uint64_t step) {
+            unsigned index = tail++ & *_sqMask;
+            io_uring_sqe* sqe = &sqes[index];
+            std::memset(sqe, 0, sizeof(*sqe));
+            sqe->user_data = uint64_t(slot) * 4 + step;
+            _sqArray[index] = index;
+            return sqe;
+        };
+
+        io_uring_sqe* open = next(STEP_OPEN);
+        open->opcode = IORING_OP_OPENAT;
+        open->flags = IOSQE_IO_LINK;
+        open->fd = AT_FDCWD;
+        open->addr = reinterpret_cast<uint64_t>(file.path.c_str());
+        open->len = 0644;
+        // A direct descriptor isn't in the process's table, and the kernel refuses
+        // O_CLOEXEC for one
+        open->open_flags = O_WRONLY | O_CREAT | O_TRUNC;
+        open->file_index = slot + 1;
+
+        io_uring_sqe* write = next(STEP_WRITE);
+        write->opcode = copy ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+        write->flags = IOSQE_IO_LINK | IOSQE_FIXED_FILE;
+        write->fd = static_cast<int>(slot);
+        write->addr = reinterpret_cast<uint64_t>(data);
+        write->len = static_cast<uint32_t>(file.data.size());
+        write->buf_index = 0;
+
+        io_uring_sqe* close = next(STEP_CLOSE);
+        close->opcode = IORING_OP_CLOSE;
+        close->file_index = slot + 1;
+
+        storeRelease(_sqTail, tail);
+    }
+    runRound(failed);
+}
+
+void IoUringWriter::runRound(std::vector<const ShardFile*>& failed) {
+    if (_queued == 0) return;
+    unsigned toSubmit = *_sqTail - loadAcquire(_sqHead);
+    unsigned outstanding = _queued;
+
+    const io_uring_cqe* cqes = static_cast<const io_uring_cqe*>(_cqes);
+    while (outstanding > 0) {
+        int result = ioUringEnter(_ring, toSubmit, 1, IORING_ENTER_GETEVENTS);
+        if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+            // The ring is unusable: whatever hasn't completed is retried by the caller
+            for (unsigned slot = 0; slot < _queued; slot++) {
+                if (_chains[slot].pending > 0) failed.push_back(_chains[slot].file);
+            }
+            ::close(_ring);
+            _ring = -1;
+            _queued = 0;
+            _bufferUsed = 0;
+            return;
+        }
+        if (result > 0) toSubmit -= std::min(toSubmit, static_cast<unsigned>(result));
+
+        unsigned head = *_cqHead;
+        unsigned tail = loadAcquire(_cqTail);
+        unsigned sqTail = *_sqTail;
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe = cqes[head & *_cqMask];
+            unsigned slot = static_cast<unsigned>(cqe.user_data / 4);
+            uint64_t step = cqe.user_data % 4;
+            Chain& chain = _chains[slot];
+            const ShardFile& file = *chain.file;
+            if (step == STEP_OPEN && cqe.res >= 0) chain.opened = true;
+            if (step == STEP_RELEASE) {
+                // Should the close fail too, the slot is emptied through the file table
+                if (cqe.res < 0) emptySlot(slot);
+            }
+            else if (cqe.res < 0 || (step == STEP_WRITE && static_cast<size_t>(cqe.res) != file.data.size())) {
+                chain.failed = true;
+            }
+            // A failed write cancels the linked close, which would leave the file open
+            // in the slot for the next chain that uses it; close it on its own
+            if (step == STEP_CLOSE && cqe.res == -ECANCELED && chain.opened) {
+                unsigned index = sqTail++ & *_sqMask;
+                io_uring_sqe* release = &static_cast<io_uring_sqe*>(_sqes)[index];
+                std::memset(release, 0, sizeof(*release));
+                release->opcode = IORING_OP_CLOSE;
+                release->file_index = slot + 1;
+                release->user_data = uint64_t(slot) * 4 + STEP_RELEASE;
+                _sqArray[index] = index;
+                chain.pending++;
+                toSubmit++;
+            }
+            if (--chain.pending == 0) {
+                outstanding--;
+                if (chain.failed) failed.push_back(&file);
+            }
+        }
+        storeRelease(_sqTail, sqTail);
+        storeRelease(_cqHead, head);
+    }
+    _queued = 0;
+    _bufferUsed = 0;
+}
+
+void IoUringWriter::emptySlot(unsigned slot) {
+    int empty = -1;
+    io_uring_files_update update;
+    std::memset(&update, 0, sizeof(update));
+    update.offset = slot;
+    update.fds = reinterpret_cast<uint64_t>(&empty);
+    ioUringRegister(_ring, IORING_REGISTER_FILES_UPDATE, &update, 1);
+}
+
+#else
+
+IoUringWriter::~IoUringWriter() = default;
+
+bool IoUringWriter::init(unsigned, size_t) {
+    return false;
+}
+
+bool IoUringWriter::available() {
+    return false;
+}
+
+void IoUringWriter::write(const std::vector<ShardFile>& batch, std::vector<const ShardFile*>& failed) {
+    for (const ShardFile& file : batch) failed.push_back(&file);
+}
+
+void IoUringWriter::runRound(std::vector<const ShardFile*>&) {}
+
+void IoUringWriter::emptySlot(unsigned) {}
+
+#endif
@@ -0,0 +1,89 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// ShardWriter backend on Linux io_uring. Each file is one linked chain of
+// openat -> write -> close on a direct descriptor, so creating, writing and
+// closing a file costs no system call of its own: a whole round of files is
+// submitted, and waited for, with a single io_uring_enter(). File contents are
+// copied into a buffer registered with the ring, so the kernel doesn't map the
+// pages of every write. Elsewhere, or on kernels without what it needs,
+// init() fails and ShardWriter uses its thread pool.
+//
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ShardWriter.h"
+
+class IoUringWriter {
+public:
+    IoUringWriter() = default;
+    ~IoUringWriter();
+    IoUringWriter(const IoUringWriter&) = delete;
+    IoUringWriter& operator=(const IoUringWriter&) = delete;
+
+    // Sets up a ring keeping up to `depth` files in flight. Returns false if
+    // io_uring, or an operation or feature it relies on, is unavailable.
+    bool init(unsigned depth = 64, size_t bufferSize = 4 << 20);
+
+    // Writes every file of the batch and appends the ones that failed to
+    // `failed`, so the caller can retry them through writeWholeFile()
+    void write(const std::vector<ShardFile>& batch, std::vector<const ShardFile*>& failed);
+
+    // True if io_uring can be used in this process, checked once
+    static bool available();
+
+private:
+    // Submits the chains queued so far and waits for all of them
+    void runRound(std::vector<const ShardFile*>& failed);
+    // Drops whatever file the direct descriptor slot holds, through the file table
+    void emptySlot(unsigned slot);
+
+    int _ring = -1;
+    unsigned _depth = 0;
+    void* _sqRing = nullptr;
+    void* _cqRing = nullptr;
+    void* _sqes = nullptr;
+    size_t _sqRingSize = 0;
+    size_t _cqRingSize = 0;
+    size_t _sqesSize = 0;
+    unsigned* _sqHead = nullptr;
+    unsigned* _sqTail = nullptr;
+    unsigned* _sqMask = nullptr;
+    unsigned* _sqArray = nullptr;
+    unsigned* _cqHead = nullptr;
+    unsigned* _cqTail = nullptr;
+    unsigned* _cqMask = nullptr;
+    void* _cqes = nullptr;
+
+    std::vector<char> _buffer;  // registered with the ring when the memlock limit allows
+    bool _fixedBuffer = false;
+    size_t _bufferUsed = 0;
+
+    // The files of the current round, by direct descriptor slot
+    struct Chain {
+        const ShardFile* file = nullptr;
+        int pending = 0;  // completions still to come
+        bool failed = false;
+        bool opened = false;  // the openat filled the slot
+    };
+    std::vector<Chain> _chains;
+    unsigned _queued = 0;   // chains in the current round
+};
@@ -0,0 +1,82 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "JsonEscape.h"
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SDKCORE_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+bool needsEscape(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+// Position of the first byte at or after `from` that needs escaping, or text.size()
+size_t findEscape(std::string_view text, size_t from) {
+    size_t i = from;
+#ifdef SDKCORE_HAVE_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= text.size(); i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+        // Unsigned v <= 0x1F is max(v, 0x1F) == 0x1F
+        __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)),
+            _mm_cmpeq_epi8(_mm_max_epu8(v, control), control));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if (mask) return i + static_cast<size_t>(std::countr_zero(mask));
+    }
+#endif
+    for (; i < text.size(); i++) {
+        if (needsEscape(static_cast<unsigned char>(text[i]))) return i;
+    }
+    return text.size();
+}
+
+} // namespace
+
+void appendJsonString(std::string& out, std::string_view text) {
+    static constexpr char HEX[] = "0123456789abcdef";
+
+    out += '"';
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t next = findEscape(text, pos);
+        out.append(text.data() + pos, next - pos);
+        if (next == text.size()) break;
+
+        unsigned char c = static_cast<unsigned char>(text[next]);
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            out += "\\u00";
+            out += HEX[c >> 4];
+            out += HEX[c & 0xF];
+            break;
+        }
+        pos = next + 1;
+    }
+    out += '"';
+}
@@ -0,0 +1,32 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// JSON string escaping for the NDJSON export
+//
+#include <string>
+#include <string_view>
+
+//
+// Appends `text` to `out` as a quoted JSON string. Quotes, backslashes and
+// control characters are escaped; everything else, including UTF-8, is copied
+// as is. In dump names only the backslash of an escaped private-use name needs
+// escaping, so the runs in between are found 16 bytes at a time.
+//
+void appendJsonString(std::string& out, std::string_view text);
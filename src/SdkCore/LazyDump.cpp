@@ -0,0 +1,55 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "LazyDump.h"
+
+namespace {
+
+// scanDump() visitor that keeps the header and fields of a single class block
+struct LazyClassBuilder {
+    LazyClass& out;
+    void onClass(const DumpClassHeader& header) { out.header = header; }
+    void onField(const DumpField& field) { out.fields.push_back(field); }
+};
+
+} // namespace
+
+void LazyDump::load(std::string_view dump) {
+    SDK_INSTRUMENT_STAGE(Index);
+    _dump = dump;
+    _index.build(dump);
+    _slots = std::make_unique<Slot[]>(_index.size());
+    _parsed = 0;
+}
+
+void LazyDump::load(std::string_view dump, std::vector<ClassSpan> spans) {
+    _dump = dump;
+    _index.assign(std::move(spans));
+    _slots = std::make_unique<Slot[]>(_index.size());
+    _parsed = 0;
+}
+
+const LazyClass& LazyDump::get(size_t i) const {
+    Slot& slot = _slots[i];
+    std::call_once(slot.once, [&] {
+        const ClassSpan& s = span(i);
+        LazyClassBuilder builder{ slot.parsed };
+        scanDump(_dump.substr(s.begin, s.end - s.begin), builder);
+        _parsed.fetch_add(1, std::memory_order_relaxed);
+    });
+    return slot.parsed;
+}
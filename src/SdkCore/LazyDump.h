@@ -0,0 +1,69 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Two-level view of a dump for lookups that touch only a few classes. Loading
+// just finds the "[Class]" headers; a class's field lines are parsed the first
+// time it is asked for and kept from then on. get() may be called from several
+// threads at once.
+//
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+#include "ClassIndex.h"
+#include "DumpParser.h"
+
+// A parsed class block. Every view points into the dump.
+struct LazyClass {
+    DumpClassHeader header;
+    std::vector<DumpField> fields;
+};
+
+class LazyDump {
+public:
+    // Indexes the class headers of `dump`, which must outlive this object
+    void load(std::string_view dump);
+
+    // Same, but only over `spans` (sorted by name) found without scanning the dump
+    void load(std::string_view dump, std::vector<ClassSpan> spans);
+
+    // Classes are numbered in name order, like ClassIndex::byName()
+    size_t size() const { return _index.size(); }
+    const ClassSpan& span(size_t i) const { return _index.byName()[i]; }
+    const ClassIndex& index() const { return _index; }
+
+    // Parses class `i` on first use, then returns the cached result
+    const LazyClass& get(size_t i) const;
+
+    // Number of classes parsed so far
+    size_t parsedCount() const { return _parsed.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot {
+        std::once_flag once;
+        LazyClass parsed;
+    };
+
+    std::string_view _dump;
+    ClassIndex _index;
+    std::unique_ptr<Slot[]> _slots;
+    mutable std::atomic<size_t> _parsed = 0;
+};
@@ -0,0 +1,189 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "MappedFile.h"
+#include "Instrument.h"
+#include <cstdint>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+        _open = std::exchange(other._open, false);
+#ifdef _WIN32
+        _file = std::exchange(other._file, nullptr);
+        _mapping = std::exchange(other._mapping, nullptr);
+#endif
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::filesystem::path& path) {
+    SDK_INSTRUMENT_STAGE(Read);
+    close();
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size)) {
+        ::CloseHandle(file);
+        return false;
+    }
+    _file = file;
+    _open = true;
+    if (size.QuadPart == 0) return true;
+
+    HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping) {
+        close();
+        return false;
+    }
+    _mapping = mapping;
+    _data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!_data) {
+        close();
+        return false;
+    }
+    _size = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::close() {
+    if (_data) ::UnmapViewOfFile(_data);
+    if (_mapping) ::CloseHandle(_mapping);
+    if (_file) ::CloseHandle(_file);
+    _data = nullptr;
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+    _open = false;
+}
+
+bool MappedOutputFile::create(const std::filesystem::path& path, size_t size) {
+    close();
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    _file = file;
+    if (size == 0) return true;
+
+    // Mapping more than the file holds extends the file to that size
+    uint64_t size64 = size;
+    HANDLE mapping = ::CreateFileMappingW(file, NULL, PAGE_READWRITE, static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64), NULL);
+    if (!mapping) {
+        close();
+        return false;
+    }
+    _mapping = mapping;
+    _data = ::MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (!_data) {
+        close();
+        return false;
+    }
+    _size = size;
+    return true;
+}
+
+bool MappedOutputFile::close() {
+    bool ok = true;
+    if (_data) ok = ::UnmapViewOfFile(_data) != 0;
+    if (_mapping) ::CloseHandle(_mapping);
+    if (_file) ok = ::CloseHandle(_file) != 0 && ok;
+    _data = nullptr;
+    _mapping = nullptr;
+    _file = nullptr;
+    _size = 0;
+    return ok;
+}
+
+#else
+
+bool MappedFile::open(const std::filesystem::path& path) {
+    SDK_INSTRUMENT_STAGE(Read);
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    _open = true;
+    if (st.st_size == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    void* data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (data == MAP_FAILED) {
+        _open = false;
+        return false;
+    }
+    ::madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    _data = data;
+    _size = static_cast<size_t>(st.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (_data) ::munmap(const_cast<void*>(_data), _size);
+    _data = nullptr;
+    _size = 0;
+    _open = false;
+}
+
+bool MappedOutputFile::create(const std::filesystem::path& path, size_t size) {
+    close();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    if (size == 0) return ::close(fd) == 0;
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return false;
+    }
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (data == MAP_FAILED) return false;
+    _data = data;
+    _size = size;
+    return true;
+}
+
+bool MappedOutputFile::close() {
+    bool ok = true;
+    if (_data) ok = ::munmap(_data, _size) == 0;
+    _data = nullptr;
+    _size = 0;
+    return ok;
+}
+
+#endif
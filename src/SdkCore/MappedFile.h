@@ -0,0 +1,82 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Memory mappings of whole files (mmap on POSIX, MapViewOfFile on Windows):
+// MappedFile reads an existing file, MappedOutputFile writes a new one of known size.
+//
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Returns false if the file can't be opened or mapped. Empty files map to an empty view.
+    bool open(const std::filesystem::path& path);
+    void close();
+
+    bool isOpen() const { return _open; }
+    std::string_view view() const { return std::string_view(static_cast<const char*>(_data), _size); }
+    size_t size() const { return _size; }
+
+private:
+    const void* _data = nullptr;
+    size_t _size = 0;
+    bool _open = false;
+#ifdef _WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#endif
+};
+
+//
+// Creates (or truncates) a file of exactly `size` bytes and maps it for writing,
+// so independent parts of the output can be written in place and in parallel.
+//
+class MappedOutputFile {
+public:
+    MappedOutputFile() = default;
+    ~MappedOutputFile() { close(); }
+    MappedOutputFile(const MappedOutputFile&) = delete;
+    MappedOutputFile& operator=(const MappedOutputFile&) = delete;
+
+    // Returns false if the file can't be created, sized or mapped
+    bool create(const std::filesystem::path& path, size_t size);
+    // Unmaps and closes the file; returns false if the data may not have been written
+    bool close();
+
+    char* data() const { return static_cast<char*>(_data); }
+    size_t size() const { return _size; }
+
+private:
+    void* _data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    void* _file = nullptr;
+    void* _mapping = nullptr;
+#endif
+};
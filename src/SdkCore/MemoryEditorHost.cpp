@@ -0,0 +1,120 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "MemoryEditorHost.h"
+#include "Instrument.h"
+#include <algorithm>
+
+void MemoryEditorHost::setSetting(std::string section, std::string key, std::string value) {
+    _settings[{ std::move(section), std::move(key) }] = std::move(value);
+}
+
+void MemoryEditorHost::clearLog() {
+    openedFiles.clear();
+    errors.clear();
+    messages.clear();
+    questions.clear();
+    progressReports.clear();
+}
+
+std::string MemoryEditorHost::selection() {
+    return selectedText;
+}
+
+size_t MemoryEditorHost::documentLength() {
+    return document.size();
+}
+
+bool MemoryEditorHost::documentView(std::string_view& text) {
+    if (!directAccess) return false;
+    text = document;
+    return true;
+}
+
+bool MemoryEditorHost::readDocument(size_t chunkSize, const std::function<void(std::string_view chunk)>& onChunk) {
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    for (size_t pos = 0; pos < document.size(); pos += chunkSize) {
+        {
+            SDK_INSTRUMENT_STAGE(Read);
+            _chunk.assign(document, pos, chunkSize);
+        }
+        onChunk(_chunk);
+    }
+    return true;
+}
+
+bool MemoryEditorHost::runJob(ExportJob::Work work, ExportJob::Done done) {
+    // On a thread of its own as in the editor, but waited for, so a command has
+    // finished when it returns. A cancelled job is cancelled before its work starts.
+    ExportJobResult result;
+    auto start = [this, work = std::move(work)](ExportProgressTracker& progress) {
+        if (cancelJobs) _job.cancel();
+        work(progress);
+    };
+    auto report = [this](const ExportProgress& progress) { progressReports.push_back(progress); };
+    if (!_job.start(start, report, [&](const ExportJobResult& finished) { result = finished; })) return false;
+    _job.wait();
+    done(result);
+    return true;
+}
+
+bool MemoryEditorHost::currentDirectory(std::filesystem::path& dir) {
+    if (directory.empty()) return false;
+    dir = directory;
+    return true;
+}
+
+std::string MemoryEditorHost::setting(std::string_view section, std::string_view key) {
+    auto it = _settings.find({ std::string(section), std::string(key) });
+    return it == _settings.end() ? "" : it->second;
+}
+
+std::filesystem::path MemoryEditorHost::settingsPath() {
+    return settingsFile;
+}
+
+bool MemoryEditorHost::openFile(const std::filesystem::path& path, EditorLanguage language) {
+    openedFiles.push_back({ path, language });
+    return true;
+}
+
+void MemoryEditorHost::showError(std::string_view message) {
+    errors.emplace_back(message);
+}
+
+void MemoryEditorHost::showMessage(std::string_view message) {
+    messages.emplace_back(message);
+}
+
+bool MemoryEditorHost::askYesNo(std::string_view, std::string_view question) {
+    questions.emplace_back(question);
+    return answerYes;
+}
+
+bool MemoryEditorHost::askSavePath(const std::vector<EditorFileType>& types, std::string_view,
+    std::filesystem::path& path, size_t& type) {
+    if (cancelDialogs || saveType >= types.size()) return false;
+    if (!savePath.empty()) path = savePath;
+    type = saveType;
+    return true;
+}
+
+bool MemoryEditorHost::askFolder(std::string_view, std::filesystem::path& picked) {
+    if (cancelDialogs) return false;
+    if (!folder.empty()) picked = folder;
+    return true;
+}
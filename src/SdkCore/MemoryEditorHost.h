@@ -0,0 +1,88 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// An EditorHost without an editor, for running the plugin's commands headless.
+// The test or benchmark sets the document, the selection, the folder and the
+// settings; dialogs are answered from the fields below instead of a user, and
+// everything the commands show or open is recorded for checking afterwards.
+//
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "EditorHost.h"
+
+class MemoryEditorHost : public EditorHost {
+public:
+    struct OpenedFile {
+        std::filesystem::path path;
+        EditorLanguage language;
+    };
+
+    // The editor's state
+    std::string document;
+    std::string selectedText;
+    std::filesystem::path directory;    // folder of the current document; empty for an unsaved one
+    std::filesystem::path settingsFile = "SdkFormatter.ini";
+    bool directAccess = true;           // false: documentView() is refused, as by an editor without it
+    bool cancelJobs = false;            // jobs are cancelled before they do anything
+
+    // Answers to the dialogs: yes/no questions get `answerYes`; save dialogs keep the
+    // suggested path unless `savePath` is set, and `saveType` picks the file type;
+    // folder pickers keep their starting folder unless `folder` is set. With
+    // `cancelDialogs` every save and folder dialog is cancelled instead.
+    bool answerYes = true;
+    bool cancelDialogs = false;
+    std::filesystem::path savePath;
+    size_t saveType = 0;
+    std::filesystem::path folder;
+
+    // What the commands did
+    std::vector<OpenedFile> openedFiles;
+    std::vector<std::string> errors;
+    std::vector<std::string> messages;
+    std::vector<std::string> questions;
+    std::vector<ExportProgress> progressReports;
+
+    void setSetting(std::string section, std::string key, std::string value);
+    // Forgets what earlier commands did, keeping the state and the answers
+    void clearLog();
+
+    std::string selection() override;
+    size_t documentLength() override;
+    bool documentView(std::string_view& text) override;
+    bool readDocument(size_t chunkSize, const std::function<void(std::string_view chunk)>& onChunk) override;
+    bool runJob(ExportJob::Work work, ExportJob::Done done) override;
+    bool currentDirectory(std::filesystem::path& dir) override;
+    std::string setting(std::string_view section, std::string_view key) override;
+    std::filesystem::path settingsPath() override;
+    bool openFile(const std::filesystem::path& path, EditorLanguage language) override;
+    void showError(std::string_view message) override;
+    void showMessage(std::string_view message) override;
+    bool askYesNo(std::string_view title, std::string_view question) override;
+    bool askSavePath(const std::vector<EditorFileType>& types, std::string_view defaultExtension,
+        std::filesystem::path& path, size_t& type) override;
+    bool askFolder(std::string_view title, std::filesystem::path& folder) override;
+
+private:
+    std::map<std::pair<std::string, std::string>, std::string> _settings;
+    std::string _chunk;                 // readDocument() copies out through it, like an editor's API would
+    ExportJob _job;
+};
@@ -0,0 +1,205 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Binary offsets database (".sdkdb") and its header-only reader. Tools that only
+// need (class, field) -> offset lookups map the file and query it in place
+// instead of parsing SDK.cs at startup. Only this header and Hash.h are needed.
+//
+// Layout, little-endian, every section 8-byte aligned:
+//     OffsetsDbHeader
+//     string pool                   class names, field names and types, not NUL terminated
+//     OffsetsDbClass[classCount]    sorted by name
+//     OffsetsDbField[fieldCount]    grouped by class, sorted by name within a class
+//     uint32_t[bucketCount]         perfect hash pilots     } only with
+//     uint32_t[slotCount]           perfect hash slots      } OFFSETS_DB_HAS_HASH
+//
+// The perfect hash maps every (class, field) pair to its own slot, so lookups
+// cost two hashes and one string comparison; without it they binary search.
+// There are a few percent more slots than fields (unused ones hold 0xFFFFFFFF),
+// which keeps building the hash fast.
+//
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "Hash.h"
+
+static_assert(std::endian::native == std::endian::little, "the offsets database is little-endian");
+
+constexpr uint32_t OFFSETS_DB_VERSION = 1;
+constexpr uint32_t OFFSETS_DB_HAS_HASH = 1;
+
+struct OffsetsDbHeader {
+    char magic[8];          // "SDKOFFDB"
+    uint32_t version;
+    uint32_t flags;
+    uint32_t classCount;
+    uint32_t fieldCount;
+    uint32_t bucketCount;   // 0 without the perfect hash
+    uint32_t slotCount;     // 0 without the perfect hash
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint64_t classesOffset;
+    uint64_t fieldsOffset;
+    uint64_t bucketsOffset;
+    uint64_t slotsOffset;
+};
+
+struct OffsetsDbClass {
+    uint32_t nameOffset;    // into the string pool
+    uint32_t nameLength;
+    uint32_t firstField;
+    uint32_t fieldCount;
+};
+
+struct OffsetsDbField {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t typeOffset;
+    uint32_t typeLength;
+    uint32_t classIndex;
+    uint32_t offset;
+    uint8_t tag;            // FieldTag: 0 instance, 1 static, 2 const
+    uint8_t reserved[7];
+};
+
+static_assert(sizeof(OffsetsDbHeader) == 80, "OffsetsDbHeader layout is persisted");
+static_assert(sizeof(OffsetsDbClass) == 16, "OffsetsDbClass layout is persisted");
+static_assert(sizeof(OffsetsDbField) == 32, "OffsetsDbField layout is persisted");
+
+// Key hash of a (class, field) pair; the perfect hash is built from it
+inline uint64_t offsetsDbKeyHash(std::string_view className, std::string_view fieldName) {
+    return hashString(fieldName, hashString(className));
+}
+
+// Skewed like PTHash: 60% of the keys share the first 30% of the buckets, so the
+// buckets still left when the table is nearly full are small ones
+inline uint32_t offsetsDbBucket(uint64_t keyHash, uint32_t bucketCount) {
+    uint32_t dense = bucketCount * 3 / 10;
+    if (dense == 0 || dense == bucketCount) return static_cast<uint32_t>((keyHash >> 32) % bucketCount);
+    if (static_cast<uint32_t>(keyHash) < 0x9999999Au) return static_cast<uint32_t>((keyHash >> 32) % dense);
+    return dense + static_cast<uint32_t>((keyHash >> 32) % (bucketCount - dense));
+}
+
+inline uint32_t offsetsDbSlot(uint64_t keyHash, uint32_t pilot, uint32_t slotCount) {
+    return static_cast<uint32_t>(hashMix(keyHash ^ ((pilot + 1ull) * 0x9E3779B97F4A7C15ull)) % slotCount);
+}
+
+class OffsetsDbReader {
+public:
+    // Checks the header and section bounds of a mapped database. `data` must stay
+    // mapped and be 8-byte aligned (a mapping or heap buffer always is).
+    bool attach(const void* data, size_t size) {
+        _header = nullptr;
+        if (size < sizeof(OffsetsDbHeader)) return false;
+        const char* base = static_cast<const char*>(data);
+        const OffsetsDbHeader* h = reinterpret_cast<const OffsetsDbHeader*>(base);
+        if (std::memcmp(h->magic, "SDKOFFDB", 8) != 0 || h->version != OFFSETS_DB_VERSION) return false;
+
+        auto fits = [&](uint64_t offset, uint64_t bytes) { return offset <= size && bytes <= size - offset && offset % 8 == 0; };
+        if (!fits(h->stringsOffset, h->stringsSize)) return false;
+        if (!fits(h->classesOffset, uint64_t(h->classCount) * sizeof(OffsetsDbClass))) return false;
+        if (!fits(h->fieldsOffset, uint64_t(h->fieldCount) * sizeof(OffsetsDbField))) return false;
+        if (h->flags & OFFSETS_DB_HAS_HASH) {
+            if (h->bucketCount == 0 || h->slotCount < h->fieldCount) return false;
+            if (!fits(h->bucketsOffset, uint64_t(h->bucketCount) * 4) || !fits(h->slotsOffset, uint64_t(h->slotCount) * 4)) return false;
+        }
+
+        _header = h;
+        _strings = base + h->stringsOffset;
+        _classes = reinterpret_cast<const OffsetsDbClass*>(base + h->classesOffset);
+        _fields = reinterpret_cast<const OffsetsDbField*>(base + h->fieldsOffset);
+        _pilots = reinterpret_cast<const uint32_t*>(base + h->bucketsOffset);
+        _slots = reinterpret_cast<const uint32_t*>(base + h->slotsOffset);
+        return true;
+    }
+
+    // Checks every record against the section bounds; attach() alone trusts them.
+    // Worth calling once on files that don't come from buildOffsetsDb().
+    bool validate() const {
+        if (!_header) return false;
+        auto inPool = [&](uint32_t offset, uint32_t length) { return uint64_t(offset) + length <= _header->stringsSize; };
+        for (size_t i = 0; i < classCount(); i++) {
+            const OffsetsDbClass& c = _classes[i];
+            if (!inPool(c.nameOffset, c.nameLength) || uint64_t(c.firstField) + c.fieldCount > fieldCount()) return false;
+        }
+        for (size_t i = 0; i < fieldCount(); i++) {
+            const OffsetsDbField& f = _fields[i];
+            if (!inPool(f.nameOffset, f.nameLength) || !inPool(f.typeOffset, f.typeLength) || f.classIndex >= classCount()) return false;
+        }
+        return true;
+    }
+
+    bool hasHash() const { return _header && (_header->flags & OFFSETS_DB_HAS_HASH); }
+    size_t classCount() const { return _header ? _header->classCount : 0; }
+    size_t fieldCount() const { return _header ? _header->fieldCount : 0; }
+    const OffsetsDbClass& classAt(size_t i) const { return _classes[i]; }
+    const OffsetsDbField& fieldAt(size_t i) const { return _fields[i]; }
+
+    std::string_view name(const OffsetsDbClass& c) const { return std::string_view(_strings + c.nameOffset, c.nameLength); }
+    std::string_view name(const OffsetsDbField& f) const { return std::string_view(_strings + f.nameOffset, f.nameLength); }
+    std::string_view type(const OffsetsDbField& f) const { return std::string_view(_strings + f.typeOffset, f.typeLength); }
+
+    // Binary search by fully qualified class name
+    const OffsetsDbClass* findClass(std::string_view className) const {
+        size_t lo = 0, hi = classCount();
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (name(_classes[mid]) < className) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo < classCount() && name(_classes[lo]) == className ? &_classes[lo] : nullptr;
+    }
+
+    // Binary search for a field within its class
+    const OffsetsDbField* findSorted(std::string_view className, std::string_view fieldName) const {
+        const OffsetsDbClass* c = findClass(className);
+        if (!c) return nullptr;
+        size_t lo = c->firstField, hi = size_t(c->firstField) + c->fieldCount;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (name(_fields[mid]) < fieldName) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo < size_t(c->firstField) + c->fieldCount && name(_fields[lo]) == fieldName ? &_fields[lo] : nullptr;
+    }
+
+    // O(1) through the perfect hash when the file has one, otherwise findSorted()
+    const OffsetsDbField* find(std::string_view className, std::string_view fieldName) const {
+        if (!hasHash()) return findSorted(className, fieldName);
+        uint64_t h = offsetsDbKeyHash(className, fieldName);
+        uint32_t pilot = _pilots[offsetsDbBucket(h, _header->bucketCount)];
+        uint32_t index = _slots[offsetsDbSlot(h, pilot, _header->slotCount)];
+        if (index >= _header->fieldCount) return nullptr;
+        const OffsetsDbField& f = _fields[index];
+        // A key that isn't in the table still lands on some slot, so confirm the match
+        if (name(f) != fieldName || name(_classes[f.classIndex]) != className) return nullptr;
+        return &f;
+    }
+
+private:
+    const OffsetsDbHeader* _header = nullptr;
+    const char* _strings = nullptr;
+    const OffsetsDbClass* _classes = nullptr;
+    const OffsetsDbField* _fields = nullptr;
+    const uint32_t* _pilots = nullptr;
+    const uint32_t* _slots = nullptr;
+};
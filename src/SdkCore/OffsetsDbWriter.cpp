@@ -0,0 +1,194 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "OffsetsDbWriter.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Helper function to round a section offset up to 8 bytes
+uint64_t align8(uint64_t offset) {
+    return (offset + 7) & ~uint64_t(7);
+}
+
+//
+// Builds a perfect hash by hash-and-displace: keys are split into buckets, and
+// buckets are placed largest first by searching for a pilot value that sends all
+// of their keys to free slots. Returns false if two keys have the same hash.
+//
+bool buildPerfectHash(const std::vector<uint64_t>& keys, std::vector<uint32_t>& pilots, std::vector<uint32_t>& slots) {
+    const uint32_t n = static_cast<uint32_t>(keys.size());
+    const uint32_t bucketCount = std::max<uint32_t>(1, n / 2);
+    // 2% spare slots; filling the very last ones of a full table dominates the build time
+    const uint32_t slotCount = n + n / 50 + 1;
+
+    // Counting sort of the keys by bucket: bucket b owns keysByBucket[first[b], first[b + 1])
+    std::vector<uint32_t> first(bucketCount + 1, 0), keysByBucket(n);
+    std::vector<uint32_t> bucketOf(n);
+    for (uint32_t i = 0; i < n; i++) {
+        bucketOf[i] = offsetsDbBucket(keys[i], bucketCount);
+        first[bucketOf[i] + 1]++;
+    }
+    for (uint32_t b = 0; b < bucketCount; b++) first[b + 1] += first[b];
+    std::vector<uint32_t> fill(first.begin(), first.end() - 1);
+    for (uint32_t i = 0; i < n; i++) keysByBucket[fill[bucketOf[i]]++] = i;
+
+    std::vector<uint32_t> order(bucketCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return first[a + 1] - first[a] > first[b + 1] - first[b]; });
+
+    static constexpr uint32_t NO_KEY = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t MAX_PILOT = 1u << 24;
+    pilots.assign(bucketCount, 0);
+    slots.assign(slotCount, NO_KEY);
+    std::vector<uint32_t> taken;
+
+    for (uint32_t b : order) {
+        const uint32_t* bucket = keysByBucket.data() + first[b];
+        const uint32_t size = first[b + 1] - first[b];
+        if (size == 0) break;
+
+        uint32_t pilot = 0;
+        for (; pilot < MAX_PILOT; pilot++) {
+            taken.clear();
+            bool ok = true;
+            for (uint32_t i = 0; i < size; i++) {
+                uint32_t slot = offsetsDbSlot(keys[bucket[i]], pilot, slotCount);
+                if (slots[slot] != NO_KEY || std::find(taken.begin(), taken.end(), slot) != taken.end()) {
+                    ok = false;
+                    break;
+                }
+                taken.push_back(slot);
+            }
+            if (ok) break;
+        }
+        if (pilot == MAX_PILOT) return false;
+
+        pilots[b] = pilot;
+        for (uint32_t i = 0; i < size; i++) slots[taken[i]] = bucket[i];
+    }
+    return true;
+}
+
+} // namespace
+
+std::string buildOffsetsDb(const ColumnStore& columns, bool withHash) {
+    if (columns.fieldCount() >= std::numeric_limits<uint32_t>::max() || columns.classCount() >= std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("offsets database: too many fields");
+    }
+
+    // Classes in name order, and each class's rows in field name order
+    std::vector<uint32_t> classOrder(columns.classCount());
+    std::iota(classOrder.begin(), classOrder.end(), 0u);
+    std::stable_sort(classOrder.begin(), classOrder.end(), [&](uint32_t a, uint32_t b) {
+        return columns.strings.str(columns.classNames[a]) < columns.strings.str(columns.classNames[b]);
+    });
+
+    std::vector<std::vector<uint32_t>> rowsByClass(columns.classCount());
+    for (size_t row = 0; row < columns.fieldCount(); row++) rowsByClass[columns.classId[row]].push_back(static_cast<uint32_t>(row));
+
+    // String pool, each distinct string stored once
+    std::string pool;
+    std::unordered_map<std::string_view, uint32_t> pooled;
+    auto intern = [&](std::string_view s) {
+        auto it = pooled.find(s);
+        if (it != pooled.end()) return it->second;
+        if (pool.size() + s.size() > std::numeric_limits<uint32_t>::max()) throw std::runtime_error("offsets database: string pool too large");
+        uint32_t offset = static_cast<uint32_t>(pool.size());
+        pool.append(s);
+        pooled.emplace(s, offset);
+        return offset;
+    };
+
+    std::vector<OffsetsDbClass> classes;
+    std::vector<OffsetsDbField> fields;
+    std::vector<uint64_t> keys;
+    classes.reserve(columns.classCount());
+    fields.reserve(columns.fieldCount());
+    for (uint32_t cls : classOrder) {
+        std::string_view className = columns.strings.str(columns.classNames[cls]);
+        std::vector<uint32_t>& rows = rowsByClass[cls];
+        std::stable_sort(rows.begin(), rows.end(), [&](uint32_t a, uint32_t b) {
+            return columns.strings.str(columns.nameId[a]) < columns.strings.str(columns.nameId[b]);
+        });
+        rows.erase(std::unique(rows.begin(), rows.end(), [&](uint32_t a, uint32_t b) { return columns.nameId[a] == columns.nameId[b]; }), rows.end());
+
+        OffsetsDbClass c = {};
+        c.nameOffset = intern(className);
+        c.nameLength = static_cast<uint32_t>(className.size());
+        c.firstField = static_cast<uint32_t>(fields.size());
+        c.fieldCount = static_cast<uint32_t>(rows.size());
+        for (uint32_t row : rows) {
+            if (columns.offset[row] > std::numeric_limits<uint32_t>::max()) throw std::runtime_error("offsets database: offset does not fit 32 bits");
+            std::string_view fieldName = columns.strings.str(columns.nameId[row]);
+            std::string_view type = columns.strings.str(columns.typeId[row]);
+            OffsetsDbField f = {};
+            f.nameOffset = intern(fieldName);
+            f.nameLength = static_cast<uint32_t>(fieldName.size());
+            f.typeOffset = intern(type);
+            f.typeLength = static_cast<uint32_t>(type.size());
+            f.classIndex = static_cast<uint32_t>(classes.size());
+            f.offset = static_cast<uint32_t>(columns.offset[row]);
+            f.tag = columns.tag[row];
+            fields.push_back(f);
+            keys.push_back(offsetsDbKeyHash(className, fieldName));
+        }
+        classes.push_back(c);
+    }
+
+    std::vector<uint32_t> pilots, slots;
+    bool hashed = withHash && !fields.empty() && buildPerfectHash(keys, pilots, slots);
+
+    OffsetsDbHeader header = {};
+    std::memcpy(header.magic, "SDKOFFDB", sizeof(header.magic));
+    header.version = OFFSETS_DB_VERSION;
+    header.flags = hashed ? OFFSETS_DB_HAS_HASH : 0;
+    header.classCount = static_cast<uint32_t>(classes.size());
+    header.fieldCount = static_cast<uint32_t>(fields.size());
+    header.bucketCount = hashed ? static_cast<uint32_t>(pilots.size()) : 0;
+    header.slotCount = hashed ? static_cast<uint32_t>(slots.size()) : 0;
+    header.stringsOffset = sizeof(OffsetsDbHeader);
+    header.stringsSize = pool.size();
+    header.classesOffset = align8(header.stringsOffset + header.stringsSize);
+    header.fieldsOffset = align8(header.classesOffset + classes.size() * sizeof(OffsetsDbClass));
+    uint64_t end = header.fieldsOffset + fields.size() * sizeof(OffsetsDbField);
+    if (hashed) {
+        header.bucketsOffset = align8(end);
+        header.slotsOffset = align8(header.bucketsOffset + pilots.size() * sizeof(uint32_t));
+        end = header.slotsOffset + slots.size() * sizeof(uint32_t);
+    }
+
+    std::string out(static_cast<size_t>(end), '\0');
+    auto put = [&](uint64_t offset, const void* data, size_t size) {
+        if (size) std::memcpy(out.data() + offset, data, size);
+    };
+    put(0, &header, sizeof(header));
+    put(header.stringsOffset, pool.data(), pool.size());
+    put(header.classesOffset, classes.data(), classes.size() * sizeof(OffsetsDbClass));
+    put(header.fieldsOffset, fields.data(), fields.size() * sizeof(OffsetsDbField));
+    if (hashed) {
+        put(header.bucketsOffset, pilots.data(), pilots.size() * sizeof(uint32_t));
+        put(header.slotsOffset, slots.data(), slots.size() * sizeof(uint32_t));
+    }
+    return out;
+}
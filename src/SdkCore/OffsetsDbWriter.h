@@ -0,0 +1,33 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Writes the binary offsets database described in OffsetsDb.h
+//
+#include <string>
+#include "ColumnStore.h"
+#include "OffsetsDb.h"
+
+//
+// Serialises the classes and fields of `columns`. A field name repeated within a
+// class keeps its first occurrence. The perfect hash is skipped (and the file
+// falls back to binary search) if `withHash` is false or it can't be built.
+// Throws std::runtime_error if the data doesn't fit the 32-bit format.
+//
+std::string buildOffsetsDb(const ColumnStore& columns, bool withHash = true);
@@ -0,0 +1,192 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "OutputTemplate.h"
+#include <charconv>
+#include <stdexcept>
+
+OutputTemplate OutputTemplate::compile(std::string_view text, bool forFields) {
+    OutputTemplate result;
+    auto error = [&](const std::string& what, size_t column) {
+        throw std::runtime_error("template: " + what + " at column " + std::to_string(column + 1));
+    };
+    // Consecutive literal text is merged into one step
+    auto literal = [&](std::string_view s) {
+        if (result._steps.empty() || result._steps.back().op != Op::Literal) {
+            result._steps.push_back({ Op::Literal, static_cast<uint32_t>(result._literals.size()), 0 });
+        }
+        result._literals.append(s);
+        result._steps.back().length += static_cast<uint32_t>(s.size());
+    };
+
+    static constexpr struct {
+        std::string_view name;
+        Op op;
+        bool fieldOnly;
+    } placeholders[] = {
+        { "name", Op::Name, true },
+        { "type", Op::Type, true },
+        { "tag", Op::Tag, true },
+        { "offset", Op::OffsetText, true },
+        { "offset:hex", Op::OffsetHex, true },
+        { "offset:dec", Op::OffsetDec, true },
+        { "class", Op::Class, false },
+        { "fullname", Op::FullName, false },
+        { "base", Op::Base, false },
+        { "header", Op::Header, false },
+    };
+
+    size_t i = 0;
+    while (i < text.size()) {
+        char c = text[i];
+        if (c == '{' && i + 1 < text.size() && text[i + 1] == '{') {
+            literal("{");
+            i += 2;
+        }
+        else if (c == '}' && i + 1 < text.size() && text[i + 1] == '}') {
+            literal("}");
+            i += 2;
+        }
+        else if (c == '{') {
+            size_t close = text.find('}', i);
+            if (close == std::string_view::npos) error("unterminated placeholder", i);
+            std::string_view name = text.substr(i + 1, close - i - 1);
+            bool found = false;
+            for (const auto& placeholder : placeholders) {
+                if (placeholder.name != name) continue;
+                if (placeholder.fieldOnly && !forFields) error("{" + std::string(name) + "} is only available in field templates", i);
+                result._steps.push_back({ placeholder.op });
+                found = true;
+                break;
+            }
+            if (!found) error("unknown placeholder {" + std::string(name) + "}", i);
+            i = close + 1;
+        }
+        else if (c == '}') {
+            error("unmatched '}' (write '}}')", i);
+        }
+        else if (c == '\\' && i + 1 < text.size()) {
+            char e = text[i + 1];
+            if (e == 'n') literal("\n");
+            else if (e == 't') literal("\t");
+            else if (e == '\\') literal("\\");
+            else error(std::string("unknown escape \\") + e, i);
+            i += 2;
+        }
+        else {
+            size_t next = text.find_first_of("{}\\", i + 1);
+            if (next == std::string_view::npos) next = text.size();
+            literal(text.substr(i, next - i));
+            i = next;
+        }
+    }
+    return result;
+}
+
+void OutputTemplate::render(std::string& out, const TemplateContext& context) const {
+    char number[24];
+    for (const Step& step : _steps) {
+        switch (step.op) {
+        case Op::Literal:
+            out.append(_literals, step.begin, step.length);
+            break;
+        case Op::Name:
+            out += context.field->name;
+            break;
+        case Op::Type:
+            out += context.field->type;
+            break;
+        case Op::Tag:
+            out += fieldTagLetter(context.field->tag);
+            break;
+        case Op::OffsetText:
+            out += context.field->offsetText;
+            break;
+        case Op::OffsetHex: {
+            char* end = std::to_chars(number, number + sizeof(number), context.field->offset, 16).ptr;
+            for (char* p = number; p < end; p++) {
+                if (*p >= 'a') *p = static_cast<char>(*p - 'a' + 'A');
+            }
+            out.append(number, static_cast<size_t>(end - number));
+            break;
+        }
+        case Op::OffsetDec: {
+            char* end = std::to_chars(number, number + sizeof(number), context.field->offset).ptr;
+            out.append(number, static_cast<size_t>(end - number));
+            break;
+        }
+        case Op::Class:
+            out += context.structName;
+            break;
+        case Op::FullName:
+            out += context.header->name;
+            break;
+        case Op::Base:
+            out += context.header->bases;
+            break;
+        case Op::Header:
+            out += context.header->line;
+            break;
+        }
+    }
+}
+
+SdkTemplate SdkTemplate::parse(std::string_view text) {
+    SdkTemplate result;
+    result.fileBegin = OutputTemplate::compile("namespace SDK\\n{{\\n", false);
+    result.classBegin = OutputTemplate::compile("    // {header}\\n    public readonly partial struct {class}\\n    {{\\n", false);
+    result.field = OutputTemplate::compile("        public const uint {name} = 0x{offset}; // {type}\\n", true);
+    result.classEnd = OutputTemplate::compile("    }}\\n", false);
+    result.separator = OutputTemplate::compile("\\n", false);
+    result.fileEnd = OutputTemplate::compile("}}\\n", false);
+
+    size_t lineNumber = 0;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t nl = text.find('\n', pos);
+        if (nl == std::string_view::npos) nl = text.size();
+        std::string_view line = trimView(text.substr(pos, nl - pos));
+        pos = nl + 1;
+        lineNumber++;
+        if (line.empty() || line[0] == '#' || line[0] == ';') continue;
+
+        try {
+            size_t eq = line.find('=');
+            if (eq == std::string_view::npos) throw std::runtime_error("template: expected key = value");
+            std::string_view key = trimView(line.substr(0, eq));
+            // Only leading blanks are dropped from the value; write \t for leading tabs
+            std::string_view value = line.substr(eq + 1);
+            while (!value.empty() && value[0] == ' ') value.remove_prefix(1);
+
+            if (key == "file") result.fileBegin = OutputTemplate::compile(value, false);
+            else if (key == "class") result.classBegin = OutputTemplate::compile(value, false);
+            else if (key == "field") result.field = OutputTemplate::compile(value, true);
+            else if (key == "classEnd") result.classEnd = OutputTemplate::compile(value, false);
+            else if (key == "separator") result.separator = OutputTemplate::compile(value, false);
+            else if (key == "fileEnd") result.fileEnd = OutputTemplate::compile(value, false);
+            else if (key == "extension") {
+                if (value.empty()) throw std::runtime_error("template: empty extension");
+                result.extension = value[0] == '.' ? std::string(value) : "." + std::string(value);
+            }
+            else throw std::runtime_error("template: unknown key '" + std::string(key) + "'");
+        }
+        catch (const std::runtime_error& e) {
+            throw std::runtime_error(std::string(e.what()) + " (line " + std::to_string(lineNumber) + ")");
+        }
+    }
+    return result;
+}
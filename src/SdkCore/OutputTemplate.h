@@ -0,0 +1,85 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// User supplied output formats, e.g.
+//
+//     field = \t\tpublic const ulong {name} = 0x{offset:hex};\n
+//
+// Placeholders:  {name} {type} {tag} (I, S or C) {offset} (as written in the dump)
+//                {offset:hex} {offset:dec}       per field
+//                {class} (struct name) {fullname} {base} {header}   per class
+// Text:          {{ and }} for braces, \n \t \\ for newline, tab and backslash
+//
+// A template is compiled once into a flat list of literal-copy and insert ops;
+// rendering walks that list and appends to a caller-owned buffer.
+//
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "DumpParser.h"
+
+// What a template is rendered against; field is null outside of field templates
+struct TemplateContext {
+    const DumpClassHeader* header = nullptr;
+    std::string_view structName;
+    const DumpField* field = nullptr;
+};
+
+class OutputTemplate {
+public:
+    OutputTemplate() = default;
+
+    // Throws std::runtime_error with the column of the problem. Field placeholders
+    // are only accepted when `forFields` is set.
+    static OutputTemplate compile(std::string_view text, bool forFields);
+
+    void render(std::string& out, const TemplateContext& context) const;
+
+private:
+    enum class Op : uint8_t { Literal, Name, Type, Tag, OffsetText, OffsetHex, OffsetDec, Class, FullName, Base, Header };
+
+    struct Step {
+        Op op;
+        uint32_t begin = 0;  // Literal: range in _literals
+        uint32_t length = 0;
+    };
+
+    std::vector<Step> _steps;
+    std::string _literals;
+};
+
+// A complete output format: file, class and field templates
+struct SdkTemplate {
+    OutputTemplate fileBegin;
+    OutputTemplate classBegin;
+    OutputTemplate field;
+    OutputTemplate classEnd;
+    OutputTemplate separator; // between two classes
+    OutputTemplate fileEnd;
+    std::string extension = ".txt";
+
+    //
+    // Reads "key = value" lines, '#' or ';' starting a comment line. Keys are file,
+    // class, field, classEnd, separator, fileEnd and extension; missing templates
+    // keep Lone's C# format. Throws std::runtime_error naming the line on errors.
+    //
+    static SdkTemplate parse(std::string_view text);
+};
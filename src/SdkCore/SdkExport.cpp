@@ -0,0 +1,738 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "SdkExport.h"
+#include "AsyncFileWriter.h"
+#include "CompressedDump.h"
+#include "Instrument.h"
+#include "MappedFile.h"
+#include "ShardWriter.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+std::string makeSdkStructName(std::string_view className) {
+    return makeIdentifier(className);
+}
+
+namespace {
+
+// Unbuffered output straight to a FILE*, used when there is a single sink
+struct FileOutput {
+    FILE* out;
+    void write(std::string_view data) { fwrite(data.data(), sizeof(char), data.size(), out); }
+};
+
+// Helper function to add what an export did to the instrumentation counters
+void instrumentStats([[maybe_unused]] const SdkExportStats& stats) {
+    SDK_INSTRUMENT_COUNT(Classes, stats.classCount);
+    SDK_INSTRUMENT_COUNT(Fields, stats.fieldCount);
+    SDK_INSTRUMENT_COUNT(DuplicateClasses, stats.duplicateClasses);
+    SDK_INSTRUMENT_COUNT(FilteredClasses, stats.filteredClasses);
+    SDK_INSTRUMENT_COUNT(FilteredFields, stats.filteredFields);
+}
+
+//
+// scanDump() visitor that formats classes through an emitter and optionally fills a ColumnStore.
+// Output is anything with write(std::string_view), e.g. FileOutput or AsyncFileWriter.
+//
+template <typename Emitter, typename Output>
+class SdkExportVisitor {
+public:
+    SdkExportVisitor(Output& out, const SdkExportOptions& options, Emitter emitter)
+        : _emitter(std::move(emitter)), _out(out), _columns(options.columns), _filter(options.filter && !options.filter->empty() ? options.filter : nullptr) {}
+
+    void onClass(const DumpClassHeader& header) {
+        // If we were processing a class, write it out
+        if (_insideClass) {
+            _emitter.endClass(_classContent, false);
+            flushClass();
+        }
+        _seenClass = true;
+
+        // Skip if already processed; different classes with the same struct name get numbered
+        bool added = false;
+        std::string_view validStructName = _structNames.get(header.name, &added);
+        if (!added) {
+            _insideClass = false;
+            stats.duplicateClasses++;
+            return;
+        }
+
+        if (_filter && _filter->beginClass(header, _filterContext) == FieldFilter::ClassVerdict::Reject) {
+            _insideClass = false;
+            stats.filteredClasses++;
+            return;
+        }
+
+        stats.classCount++;
+        _insideClass = true;
+        _classFields = 0;
+        if (_columns) {
+            _columnMark = _columns->fieldCount();
+            _currentColumnClass = _columns->beginClass(header.name);
+        }
+
+        // Write class header
+        _emitter.beginClass(_classContent, header, validStructName);
+    }
+
+    void onField(const DumpField& field) {
+        if (!_insideClass) {
+            // Fields of skipped classes are counted with their class; these belong to none
+            if constexpr (INSTRUMENT_COMPILED_IN) _orphanFields += !_seenClass;
+            return;
+        }
+        if (_filter && !_filter->acceptField(_filterContext, field)) {
+            stats.filteredFields++;
+            return;
+        }
+
+        _emitter.field(_classContent, field);
+        stats.fieldCount++;
+        stats.tagCounts[static_cast<size_t>(field.tag)]++;
+        _classFields++;
+        if (_columns) _columns->addField(_currentColumnClass, field);
+    }
+
+    void beginFile() {
+        _emitter.beginFile(_classContent);
+        write();
+    }
+
+    void finish() {
+        // Close last class if any
+        if (_insideClass) {
+            _emitter.endClass(_classContent, true);
+            flushClass();
+        }
+        _emitter.endFile(_classContent);
+        write();
+        SDK_INSTRUMENT_COUNT(BytesOut, _bytesOut);
+        SDK_INSTRUMENT_COUNT(OrphanFields, _orphanFields);
+        instrumentStats(stats);
+    }
+
+    SdkExportStats stats;
+
+private:
+    void flushClass() {
+        // A class whose fields were all filtered out is dropped as a whole
+        if (_filter && _classFields == 0 && _filterContext.verdict == FieldFilter::ClassVerdict::PerField) {
+            stats.classCount--;
+            stats.filteredClasses++;
+            if (_columns) _columns->dropLastClass(_columnMark);
+            _classContent.clear();
+        }
+        else {
+            write();
+        }
+    }
+
+    // The buffer keeps its capacity, so steady state formatting doesn't allocate
+    void write() {
+        if constexpr (INSTRUMENT_COMPILED_IN) _bytesOut += _classContent.size();
+        _out.write(_classContent);
+        _classContent.clear();
+    }
+
+    Emitter _emitter;
+    Output& _out;
+    ColumnStore* _columns;
+    const FieldFilter* _filter;
+    FieldFilter::ClassContext _filterContext;
+    size_t _classFields = 0;
+    size_t _columnMark = 0;
+    std::string _classContent;
+    // Track processed classes to avoid duplicates
+    IdentifierTable _structNames;
+    bool _insideClass = false;
+    bool _seenClass = false;
+    uint32_t _currentColumnClass = 0;
+    // Only kept for instrumentation, and reported by finish()
+    uint64_t _bytesOut = 0;
+    uint64_t _orphanFields = 0;
+};
+
+// scanDump() visitor that tells the export's progress tracker of every class before
+// passing it on, and stops the export once the tracker's job is cancelled
+template <typename Visitor>
+struct TrackedVisitor {
+    Visitor& visitor;
+    ExportProgressTracker* progress;
+
+    void onClass(const DumpClassHeader& header) {
+        if (progress && !progress->advanceTo(header.name.data())) throw ExportCancelled();
+        visitor.onClass(header);
+    }
+
+    void onField(const DumpField& field) { visitor.onField(field); }
+};
+
+// Helper function to run an export with the emitter selected in the options.
+// `feed` is called with the visitor and reports the classes to it.
+template <typename Feed>
+SdkExportStats runSdkExport(FILE* out, const SdkExportOptions& options, Feed&& feed) {
+    return withSdkEmitter(options.language, options.format, [&](auto emitter) {
+        FileOutput output{ out };
+        using Visitor = SdkExportVisitor<decltype(emitter), FileOutput>;
+        Visitor visitor(output, options, std::move(emitter));
+        TrackedVisitor<Visitor> tracked{ visitor, options.progress };
+        SDK_INSTRUMENT_STAGE(Convert);
+        visitor.beginFile();
+        feed(tracked);
+        visitor.finish();
+        return visitor.stats;
+    });
+}
+
+// One output of a multi-sink export. The virtual calls happen once per class,
+// the per-field work stays inside the statically dispatched visitor.
+class SdkSinkBase {
+public:
+    virtual ~SdkSinkBase() = default;
+    virtual void onClass(const LazyClass& parsed) = 0;
+    virtual SdkExportStats finish() = 0;
+};
+
+template <typename Emitter>
+class SdkSink : public SdkSinkBase {
+public:
+    SdkSink(const SdkExportSink& sink, Emitter emitter) : _writer(sink.out), _visitor(_writer, sink.options, std::move(emitter)) {
+        _visitor.beginFile();
+    }
+
+    void onClass(const LazyClass& parsed) override {
+        _visitor.onClass(parsed.header);
+        for (const DumpField& field : parsed.fields) _visitor.onField(field);
+    }
+
+    SdkExportStats finish() override {
+        _visitor.finish();
+        _writer.finish();
+        return _visitor.stats;
+    }
+
+private:
+    AsyncFileWriter _writer;
+    SdkExportVisitor<Emitter, AsyncFileWriter> _visitor;
+};
+
+// scanDump() visitor that groups the stream into whole classes and hands each one to every sink
+class SdkSinkFanOut {
+public:
+    SdkSinkFanOut(std::vector<std::unique_ptr<SdkSinkBase>>& sinks, ExportProgressTracker* progress) : _sinks(sinks), _progress(progress) {}
+
+    void onClass(const DumpClassHeader& header) {
+        dispatch();
+        _current.header = header;
+        _insideClass = true;
+    }
+
+    void onField(const DumpField& field) {
+        if (_insideClass) _current.fields.push_back(field);
+    }
+
+    void dispatch() {
+        if (!_insideClass) return;
+        for (auto& sink : _sinks) sink->onClass(_current);
+        _current.fields.clear();
+        _insideClass = false;
+        if (_progress && !_progress->advanceTo(_current.header.name.data())) throw ExportCancelled();
+    }
+
+private:
+    std::vector<std::unique_ptr<SdkSinkBase>>& _sinks;
+    ExportProgressTracker* _progress;
+    LazyClass _current;
+    bool _insideClass = false;
+};
+
+// Helper function to run a multi-sink export; `feed` reports the dump text to scan
+template <typename Feed>
+void runSdkMultiExport(std::vector<SdkExportSink>& sinks, ExportProgressTracker* progress, Feed&& feed) {
+    std::vector<std::unique_ptr<SdkSinkBase>> outputs;
+    for (const SdkExportSink& sink : sinks) {
+        outputs.push_back(withSdkEmitter(sink.options.language, sink.options.format, [&](auto emitter) -> std::unique_ptr<SdkSinkBase> {
+            return std::make_unique<SdkSink<decltype(emitter)>>(sink, std::move(emitter));
+        }));
+    }
+
+    SDK_INSTRUMENT_STAGE(Convert);
+    SdkSinkFanOut fanOut(outputs, progress);
+    feed(fanOut);
+    fanOut.dispatch();
+
+    for (size_t i = 0; i < sinks.size(); i++) sinks[i].stats = outputs[i]->finish();
+}
+
+// Output appending to a caller-owned string
+struct StringOutput {
+    std::string& out;
+    void write(std::string_view data) { out += data; }
+};
+
+// What phase one of the parallel export learned about one class
+struct ClassPlacement {
+    enum State : uint8_t { Written, Duplicate, Rejected, Emptied };
+
+    std::string structName;
+    State state = Written;
+    size_t keptFields = 0;
+    size_t droppedFields = 0;
+    size_t keptTags[FIELD_TAG_COUNT] = {};  // keptFields by FieldTag
+    size_t length = 0;  // formatted bytes, including the separator after it
+    size_t offset = 0;  // where it goes in the output
+};
+
+// Helper function to run fn(worker, k) for k in [0, count) on `threads` workers,
+// handing out small batches so uneven classes balance out. Each worker's share
+// is instrumented as one `stage`.
+template <typename Fn>
+void parallelFor(size_t count, unsigned threads, [[maybe_unused]] InstrumentStage stage, Fn&& fn) {
+    static constexpr size_t BATCH = 64;
+    std::atomic<size_t> next = 0;
+    auto work = [&](unsigned worker) {
+#if defined(SDKCORE_INSTRUMENT)
+        InstrumentScope scope(stage);
+#endif
+        for (size_t begin; (begin = next.fetch_add(BATCH, std::memory_order_relaxed)) < count;) {
+            size_t end = std::min(count, begin + BATCH);
+            for (size_t k = begin; k < end; k++) fn(worker, k);
+        }
+    };
+    if (threads <= 1 || count <= BATCH) {
+        work(0);
+        return;
+    }
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; t++) pool.emplace_back(work, t);
+    work(0);
+    for (std::thread& thread : pool) thread.join();
+}
+
+//
+// Formats one class the way SdkExportVisitor would, into `out`. Returns false,
+// writing nothing, if the filter drops the class; `placement` gets the field counts.
+//
+template <typename Emitter>
+bool formatClass(Emitter& emitter, const LazyClass& parsed, const FieldFilter* filter, bool last, ClassPlacement& placement, std::string& out) {
+    FieldFilter::ClassContext context;
+    if (filter && filter->beginClass(parsed.header, context) == FieldFilter::ClassVerdict::Reject) {
+        placement.state = ClassPlacement::Rejected;
+        return false;
+    }
+
+    size_t mark = out.size();
+    placement.keptFields = placement.droppedFields = 0;
+    std::fill_n(placement.keptTags, FIELD_TAG_COUNT, size_t(0));
+    emitter.beginClass(out, parsed.header, placement.structName);
+    for (const DumpField& field : parsed.fields) {
+        if (filter && !filter->acceptField(context, field)) {
+            placement.droppedFields++;
+            continue;
+        }
+        emitter.field(out, field);
+        placement.keptFields++;
+        placement.keptTags[static_cast<size_t>(field.tag)]++;
+    }
+    emitter.endClass(out, last);
+
+    if (filter && placement.keptFields == 0 && context.verdict == FieldFilter::ClassVerdict::PerField) {
+        placement.state = ClassPlacement::Emptied;
+        out.resize(mark);
+        return false;
+    }
+    return true;
+}
+
+// Helper function to add a formatted class to the stats the way the streaming export counts it
+void countPlacement(SdkExportStats& stats, const ClassPlacement& placement) {
+    if (placement.state == ClassPlacement::Duplicate) {
+        stats.duplicateClasses++;
+        return;
+    }
+    if (placement.state != ClassPlacement::Written) {
+        stats.filteredClasses++;
+        if (placement.state == ClassPlacement::Emptied) stats.filteredFields += placement.droppedFields;
+        return;
+    }
+    stats.classCount++;
+    stats.fieldCount += placement.keptFields;
+    for (size_t tag = 0; tag < FIELD_TAG_COUNT; tag++) stats.tagCounts[tag] += placement.keptTags[tag];
+    stats.filteredFields += placement.droppedFields;
+}
+
+// Helper function to add the fields of a written class that pass the filter to a ColumnStore
+void addColumns(ColumnStore& columns, const LazyClass& parsed, const FieldFilter* filter) {
+    FieldFilter::ClassContext context;
+    if (filter) filter->beginClass(parsed.header, context);
+    uint32_t cls = columns.beginClass(parsed.header.name);
+    for (const DumpField& field : parsed.fields) {
+        if (!filter || filter->acceptField(context, field)) columns.addField(cls, field);
+    }
+}
+
+//
+// The parallel export. `allocate(size)` returns where the `size` output bytes go.
+//
+template <typename Allocate>
+SdkExportStats runParallelExport(const LazyDump& dump, const SdkExportOptions& options, unsigned threads, Allocate&& allocate) {
+    SdkExportStats stats;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Classes in dump order, like the streaming export sees them
+    std::vector<size_t> order(dump.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return dump.span(a).begin < dump.span(b).begin; });
+
+    // Progress goes by the bytes of the class blocks, half of each for either phase below
+    ExportProgressTracker* progress = options.progress;
+    auto blockSize = [&](size_t i) { return static_cast<uint64_t>(dump.span(i).end - dump.span(i).begin); };
+    if (progress) {
+        uint64_t total = 0;
+        for (size_t i = 0; i < dump.size(); i++) total += blockSize(i);
+        progress->setTotalBytes(total);
+    }
+
+    const FieldFilter* filter = options.filter && !options.filter->empty() ? options.filter : nullptr;
+    return withSdkEmitter(options.language, options.format, [&](auto emitter) {
+        using Emitter = decltype(emitter);
+
+        // The database isn't made of independent classes, so it is built in one go
+        if constexpr (std::is_same_v<Emitter, OffsetsDbEmitter>) {
+            std::string bytes;
+            StringOutput output{ bytes };
+            SdkExportVisitor<Emitter, StringOutput> visitor(output, options, std::move(emitter));
+            visitor.beginFile();
+            for (size_t i : order) {
+                if (progress && !progress->advance(blockSize(i))) throw ExportCancelled();
+                const LazyClass& parsed = dump.get(i);
+                visitor.onClass(parsed.header);
+                for (const DumpField& field : parsed.fields) visitor.onField(field);
+            }
+            visitor.finish();
+            char* dest = allocate(bytes.size());
+            if (!bytes.empty()) std::memcpy(dest, bytes.data(), bytes.size());
+            return visitor.stats;
+        }
+        else {
+            std::vector<ClassPlacement> placements(order.size());
+            std::vector<Emitter> emitters(threads, emitter);
+            std::vector<std::string> scratch(threads);
+
+            // The streaming export only knows a class is the last one when the dump ends,
+            // so only the final class block of the dump is formatted as last
+            auto isLast = [&](size_t k) { return k + 1 == order.size(); };
+
+            // Serially, from the class names alone: struct names and duplicates (the first
+            // class with a name wins)
+            IdentifierTable structNames;
+            for (size_t k = 0; k < placements.size(); k++) {
+                bool added = false;
+                placements[k].structName = structNames.get(dump.span(order[k]).name, &added);
+                if (!added) placements[k].state = ClassPlacement::Duplicate;
+            }
+
+            // Phase one: parse and measure every class. Cancelling skips the classes
+            // still to do, and the export stops once the workers are back.
+            parallelFor(order.size(), threads, InstrumentStage::Parse, [&](unsigned worker, size_t k) {
+                if (progress && !progress->advance(blockSize(order[k]) / 2, 0)) return;
+                ClassPlacement& placement = placements[k];
+                if (placement.state == ClassPlacement::Duplicate) return;
+                const LazyClass& parsed = dump.get(order[k]);
+                std::string& buffer = scratch[worker];
+                buffer.clear();
+                if (formatClass(emitters[worker], parsed, filter, isLast(k), placement, buffer)) placement.length = buffer.size();
+            });
+            if (progress) progress->throwIfCancelled();
+
+            // Serially: stats and offsets
+            std::string head, tail;
+            emitter.beginFile(head);
+            size_t offset = head.size();
+            for (size_t k = 0; k < placements.size(); k++) {
+                ClassPlacement& placement = placements[k];
+                countPlacement(stats, placement);
+                if (placement.state != ClassPlacement::Written) continue;
+                placement.offset = offset;
+                offset += placement.length;
+            }
+            emitter.endFile(tail);
+            size_t total = offset + tail.size();
+
+            char* dest = allocate(total);
+            SDK_INSTRUMENT_COUNT(BytesOut, total);
+            if (!head.empty()) std::memcpy(dest, head.data(), head.size());
+            if (!tail.empty()) std::memcpy(dest + offset, tail.data(), tail.size());
+
+            // Phase two: format again, each class into its own slot. Both passes format the
+            // same way, so a class that comes out another length is a bug; it is reported
+            // once the workers are back rather than left as a cut or a gap in the file.
+            std::atomic<size_t> mismatched = SIZE_MAX;
+            parallelFor(order.size(), threads, InstrumentStage::Format, [&](unsigned worker, size_t k) {
+                if (progress && !progress->advance(blockSize(order[k]) - blockSize(order[k]) / 2)) return;
+                ClassPlacement& placement = placements[k];
+                if (placement.state != ClassPlacement::Written) return;
+                std::string& buffer = scratch[worker];
+                buffer.clear();
+                formatClass(emitters[worker], dump.get(order[k]), filter, isLast(k), placement, buffer);
+                if (buffer.size() != placement.length) {
+                    mismatched.store(k, std::memory_order_relaxed);
+                    return;
+                }
+                std::memcpy(dest + placement.offset, buffer.data(), buffer.size());
+            });
+            if (progress) progress->throwIfCancelled();
+            if (size_t k = mismatched.load(); k != SIZE_MAX) {
+                throw std::logic_error("parallel export: class " + std::string(dump.span(order[k]).name)
+                                       + " formatted to a different length in its second pass");
+            }
+
+            if (options.columns) {
+                for (size_t k = 0; k < placements.size(); k++) {
+                    if (placements[k].state == ClassPlacement::Written) addColumns(*options.columns, dump.get(order[k]), filter);
+                }
+            }
+            instrumentStats(stats);
+            return stats;
+        }
+    });
+}
+
+// Helper function to make one directory name from a namespace component; also
+// steers clear of the device names Windows reserves in every directory
+std::string makeShardDirectoryName(std::string_view component) {
+    std::string name = makeSdkStructName(component);
+    static const char* reserved[] = { "CON", "PRN", "AUX", "NUL", "COM1", "COM2", "COM3", "COM4", "COM5", "COM6", "COM7", "COM8", "COM9",
+                                      "LPT1", "LPT2", "LPT3", "LPT4", "LPT5", "LPT6", "LPT7", "LPT8", "LPT9" };
+    for (const char* device : reserved) {
+        if (name.size() == std::strlen(device)
+            && std::equal(name.begin(), name.end(), device, [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == b; })) {
+            return name + '_';
+        }
+    }
+    return name;
+}
+
+// Helper function to fold a relative path for the case-insensitive comparison of shard paths
+std::string foldShardPath(const std::filesystem::path& path) {
+    std::string folded = path.generic_string();
+    for (char& c : folded) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return folded;
+}
+
+} // namespace
+
+SdkExportStats exportDumpAsSdkParallelToString(const LazyDump& dump, std::string& out, const SdkExportOptions& options, unsigned threads) {
+    return runParallelExport(dump, options, threads, [&](size_t size) {
+        out.resize(size);
+        return out.data();
+    });
+}
+
+SdkExportStats exportDumpAsSdkParallel(const LazyDump& dump, const std::filesystem::path& path, const SdkExportOptions& options, unsigned threads) {
+    MappedOutputFile file;
+    SdkExportStats stats = runParallelExport(dump, options, threads, [&](size_t size) {
+        if (!file.create(path, size)) throw std::runtime_error("failed to create " + path.string());
+        return file.data();
+    });
+    {
+        SDK_INSTRUMENT_STAGE(Write);
+        if (!file.close()) throw std::runtime_error("failed to write " + path.string());
+    }
+    return stats;
+}
+
+std::filesystem::path sdkShardPath(std::string_view className, std::string_view extension, bool byNamespace) {
+    std::filesystem::path path;
+    if (byNamespace) {
+        size_t dot;
+        while ((dot = className.find('.')) != std::string_view::npos) {
+            std::string_view component = className.substr(0, dot);
+            if (!component.empty() && component != "-") path /= makeShardDirectoryName(component);
+            className.remove_prefix(dot + 1);
+        }
+    }
+    path /= makeSdkStructName(className) + "_Offsets" + std::string(extension);
+    return path;
+}
+
+SdkExportStats exportDumpAsShards(const LazyDump& dump, std::vector<size_t> classes, const std::filesystem::path& dir,
+                                  const SdkExportOptions& options, const SdkShardOptions& shard) {
+    if (options.language == SdkLanguage::OffsetsDb) throw std::runtime_error("the offsets database can't be split into one file per class");
+    std::string extension = options.language == SdkLanguage::Template ? options.format->extension : sdkFileExtension(options.language);
+
+    // Classes in dump order, so the first of several with the same name wins as in the other exports
+    std::sort(classes.begin(), classes.end(), [&](size_t a, size_t b) { return dump.span(a).begin < dump.span(b).begin; });
+
+    // Serially, from the class headers alone: paths, duplicates and the directories to create
+    struct Shard {
+        size_t position;
+        std::filesystem::path path;
+        ClassPlacement placement;
+    };
+    std::vector<Shard> shards;
+    shards.reserve(classes.size());
+    SdkExportStats stats;
+    IdentifierTable structNames;
+    std::unordered_set<std::string> seenPaths;
+    std::set<std::filesystem::path> directories;
+    const std::string suffix = "_Offsets" + extension;
+    for (size_t i : classes) {
+        std::string_view name = dump.span(i).name;
+        bool added = false;
+        std::string_view structName = structNames.get(name, &added);
+        if (!added) {
+            stats.duplicateClasses++;
+            continue;
+        }
+        std::filesystem::path path = shard.byNamespace ? sdkShardPath(name, extension, true) : std::filesystem::path(std::string(structName) + suffix);
+        // Paths that only differ in case are one file on Windows, so the later ones are numbered
+        std::string stem = path.filename().string();
+        stem.resize(stem.size() - suffix.size());
+        for (size_t n = 2; !seenPaths.insert(foldShardPath(path)).second; n++) {
+            path.replace_filename(stem + '_' + std::to_string(n) + suffix);
+        }
+        if (path.has_parent_path()) directories.insert(dir / path.parent_path());
+        shards.push_back({ i, dir / path, {} });
+        shards.back().placement.structName = structName;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    for (const std::filesystem::path& directory : directories) {
+        if (error) break;
+        std::filesystem::create_directories(directory, error);
+    }
+    if (error) throw std::runtime_error("failed to create directories under " + dir.string() + ": " + error.message());
+
+    const FieldFilter* filter = options.filter && !options.filter->empty() ? options.filter : nullptr;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    ShardWriter writer(shard.threads, shard.writer);
+
+    withSdkEmitter(options.language, options.format, [&](auto emitter) {
+        using Emitter = decltype(emitter);
+        if constexpr (!std::is_same_v<Emitter, OffsetsDbEmitter>) {
+            std::string head, tail;
+            emitter.beginFile(head);
+            emitter.endFile(tail);
+
+            // Formatting is cheap next to creating the files, so each worker hands
+            // its files to the writer in batches as it goes
+            static constexpr size_t BATCH = 64;
+            std::vector<Emitter> emitters(threads, emitter);
+            std::vector<std::vector<ShardFile>> pending(threads);
+            parallelFor(shards.size(), threads, InstrumentStage::Format, [&](unsigned worker, size_t k) {
+                Shard& item = shards[k];
+                const LazyClass& parsed = dump.get(item.position);
+                std::string data = head;
+                if (!formatClass(emitters[worker], parsed, filter, true, item.placement, data)) return;
+                data += tail;
+                pending[worker].push_back({ item.path, std::move(data) });
+                if (pending[worker].size() >= BATCH) writer.write(std::exchange(pending[worker], {}));
+            });
+            for (std::vector<ShardFile>& batch : pending) writer.write(std::move(batch));
+        }
+        return 0;
+    });
+
+    size_t failed = writer.finish();
+    if (failed) {
+        throw std::runtime_error("failed to write " + std::to_string(failed) + " of " + std::to_string(shards.size())
+                                 + " files, the first being " + writer.firstFailure().string());
+    }
+
+    for (const Shard& item : shards) countPlacement(stats, item.placement);
+    instrumentStats(stats);
+    return stats;
+}
+
+SdkExportStats exportDumpAsSdk(std::string_view dump, FILE* out, const SdkExportOptions& options) {
+    // A compressed dump's classes aren't in `dump`, so only they are counted
+    if (options.progress && sniffDumpCompression(dump) == DumpCompression::None) options.progress->setInput(dump);
+    return runSdkExport(out, options, [&](auto& visitor) {
+        scanAnyDump(dump, visitor);
+    });
+}
+
+SdkExportStats exportDumpAsSdk(std::string_view dump, std::vector<ClassSpan> spans, FILE* out, const SdkExportOptions& options) {
+    std::sort(spans.begin(), spans.end(), [](const ClassSpan& a, const ClassSpan& b) { return a.begin < b.begin; });
+    if (options.progress) options.progress->setInput(dump);
+
+    return runSdkExport(out, options, [&](auto& visitor) {
+        for (const ClassSpan& span : spans) {
+            scanDump(dump.substr(span.begin, span.end - span.begin), visitor);
+        }
+    });
+}
+
+SdkExportStats exportDumpAsSdk(const LazyDump& dump, std::vector<size_t> classes, FILE* out, const SdkExportOptions& options) {
+    std::sort(classes.begin(), classes.end(), [&](size_t a, size_t b) { return dump.span(a).begin < dump.span(b).begin; });
+
+    // Replay the cached classes through the same visitor the text scan uses
+    return runSdkExport(out, options, [&](auto& visitor) {
+        for (size_t i : classes) {
+            const LazyClass& parsed = dump.get(i);
+            visitor.onClass(parsed.header);
+            for (const DumpField& field : parsed.fields) visitor.onField(field);
+        }
+    });
+}
+
+void exportDumpAsSdk(std::string_view dump, std::vector<SdkExportSink>& sinks, ExportProgressTracker* progress) {
+    if (progress && sniffDumpCompression(dump) == DumpCompression::None) progress->setInput(dump);
+    runSdkMultiExport(sinks, progress, [&](SdkSinkFanOut& fanOut) {
+        // The fan-out holds the last class until dispatched, so that happens while its text is there
+        scanAnyDump(dump, fanOut, [&] { fanOut.dispatch(); });
+    });
+}
+
+void exportDumpAsSdk(const DumpChunkReader& read, std::vector<SdkExportSink>& sinks, ExportProgressTracker* progress) {
+    runSdkMultiExport(sinks, progress, [&](SdkSinkFanOut& fanOut) {
+        DumpStreamScanner<SdkSinkFanOut> scanner(fanOut);
+        read([&](std::string_view chunk) {
+            scanner.feed(chunk);
+            if (progress && !progress->advance(chunk.size(), 0)) throw ExportCancelled();
+        });
+        scanner.finish();
+        // The last class points into the scanner's last run, so it goes out before that is freed
+        fanOut.dispatch();
+    });
+}
+
+void exportDumpAsSdk(std::string_view dump, std::vector<ClassSpan> spans, std::vector<SdkExportSink>& sinks, ExportProgressTracker* progress) {
+    std::sort(spans.begin(), spans.end(), [](const ClassSpan& a, const ClassSpan& b) { return a.begin < b.begin; });
+    if (progress) progress->setInput(dump);
+
+    runSdkMultiExport(sinks, progress, [&](SdkSinkFanOut& fanOut) {
+        for (const ClassSpan& span : spans) {
+            scanDump(dump.substr(span.begin, span.end - span.begin), fanOut);
+            fanOut.dispatch();
+        }
+    });
+}
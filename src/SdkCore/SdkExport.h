@@ -0,0 +1,149 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Whole-dump conversion to Lone's SDK.cs format (or the C++ and Rust variants
+// in Emitter.h), shared by the plugin's "Export Entire File to SDK" command
+// and the command line tool.
+//
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ClassIndex.h"
+#include "ColumnStore.h"
+#include "Emitter.h"
+#include "ExportJob.h"
+#include "FieldFilter.h"
+#include "LazyDump.h"
+#include "ShardWriter.h"
+
+struct SdkExportOptions {
+    ColumnStore* columns = nullptr;       // filled with the exported fields in the same pass (not by the sharded export)
+    const FieldFilter* filter = nullptr;  // fields and classes to keep
+    SdkLanguage language = SdkLanguage::CSharp;
+    const SdkTemplate* format = nullptr;  // required for SdkLanguage::Template
+    ExportProgressTracker* progress = nullptr; // told of every class; a cancelled one stops the whole-dump exports with ExportCancelled
+};
+
+struct SdkExportStats {
+    int classCount = 0;
+    size_t fieldCount = 0;
+    size_t tagCounts[FIELD_TAG_COUNT] = {}; // fieldCount by FieldTag
+    size_t duplicateClasses = 0;
+    size_t filteredClasses = 0;
+    size_t filteredFields = 0;
+};
+
+struct SdkShardOptions {
+    bool byNamespace = false; // EFT.InventoryLogic.Item goes to EFT/InventoryLogic/Item_Offsets.cs
+    unsigned threads = 0;     // file writers, 0 = a few per core
+    ShardWriterBackend writer = ShardWriterBackend::Auto;
+};
+
+// One output of a multi-sink export, with its own filter and language
+struct SdkExportSink {
+    FILE* out = nullptr;
+    SdkExportOptions options;
+    SdkExportStats stats; // filled in by the export
+};
+
+// Turns a dump class name into a struct name (see Identifier.h). The exports number
+// different classes that come out the same; this doesn't, as it sees one name.
+std::string makeSdkStructName(std::string_view className);
+
+//
+// Converts an entire dump and writes "namespace SDK { ... }" to `out`.
+// With a filter, rejected fields are dropped, and so are classes that are rejected
+// outright or end up with no field left. A gzip, zstd or xz compressed dump is
+// decompressed on the fly (see CompressedDump.h).
+//
+SdkExportStats exportDumpAsSdk(std::string_view dump, FILE* out, const SdkExportOptions& options = {});
+
+//
+// Same as above for a subset of class blocks, e.g. from ClassIndex::matchGlob().
+// Only those byte ranges are parsed; classes are written in dump order.
+//
+SdkExportStats exportDumpAsSdk(std::string_view dump, std::vector<ClassSpan> spans, FILE* out, const SdkExportOptions& options = {});
+
+//
+// Same again for classes of a LazyDump, given as positions in name order. Classes
+// already parsed by earlier lookups are not parsed again.
+//
+SdkExportStats exportDumpAsSdk(const LazyDump& dump, std::vector<size_t> classes, FILE* out, const SdkExportOptions& options = {});
+
+//
+// Two-phase parallel export of a whole LazyDump, byte-identical to the streaming
+// export above for any thread count. Phase one parses and formats every class on
+// `threads` workers (0 = one per core) to learn its exact length; a prefix sum over
+// the lengths gives each class its offset, and phase two formats the classes again
+// and copies each one to its own slot of `path`, a file created at its final size
+// and mapped. SdkLanguage::OffsetsDb is written as a whole and so is produced
+// serially. Throws std::runtime_error if the file can't be written.
+//
+SdkExportStats exportDumpAsSdkParallel(const LazyDump& dump, const std::filesystem::path& path, const SdkExportOptions& options = {}, unsigned threads = 0);
+
+// Same, into a single preallocated string
+SdkExportStats exportDumpAsSdkParallelToString(const LazyDump& dump, std::string& out, const SdkExportOptions& options = {}, unsigned threads = 0);
+
+//
+// Where the sharded export below writes a class, relative to its directory:
+// "<struct name>_Offsets<extension>", or with `byNamespace` one directory per
+// namespace component (the dumper's "-" namespace has none) and the short class name.
+//
+std::filesystem::path sdkShardPath(std::string_view className, std::string_view extension, bool byNamespace);
+
+//
+// Writes each of the given classes of a LazyDump (positions in name order) to a
+// file of its own under `dir`, named by sdkShardPath(), each a complete file with
+// the emitter's header and footer. Classes are formatted on every core and the
+// files are created by a ShardWriter, so tens of thousands of them take seconds.
+// Classes whose name was already written are counted as duplicates; different
+// classes with the same struct name, or with paths that only differ in case, get
+// numbered ("_2", "_3", ...). Classes the filter drops get no file. Throws std::runtime_error for SdkLanguage::OffsetsDb, which
+// can't be split, and if a directory or file can't be written.
+//
+SdkExportStats exportDumpAsShards(const LazyDump& dump, std::vector<size_t> classes, const std::filesystem::path& dir,
+                                  const SdkExportOptions& options = {}, const SdkShardOptions& shard = {});
+
+//
+// Parses the dump once and writes every sink from the same class stream. Each
+// sink filters and formats on its own and writes through its own AsyncFileWriter,
+// so a slow file only holds up its own output. The whole-dump form takes
+// compressed dumps like the single-output export. `progress` (rather than the
+// sinks' options) is told of every class, and a cancelled one stops the export
+// with ExportCancelled.
+//
+void exportDumpAsSdk(std::string_view dump, std::vector<SdkExportSink>& sinks, ExportProgressTracker* progress = nullptr);
+void exportDumpAsSdk(std::string_view dump, std::vector<ClassSpan> spans, std::vector<SdkExportSink>& sinks,
+                     ExportProgressTracker* progress = nullptr);
+
+// Reads a dump by calling onChunk() with consecutive pieces of its text, each valid only during the call
+using DumpChunkReader = std::function<void(const std::function<void(std::string_view chunk)>& onChunk)>;
+
+//
+// Same as the multi-sink export for a dump that is read a piece at a time, such as
+// an editor's buffer. Classes are parsed as soon as they are complete (see
+// DumpStreamScanner), so the text held at any time is a few pieces' worth,
+// whatever the size of the dump. The text must be plain, not compressed. Every
+// piece counts towards `progress`, whose total is up to the caller.
+//
+void exportDumpAsSdk(const DumpChunkReader& read, std::vector<SdkExportSink>& sinks, ExportProgressTracker* progress = nullptr);
@@ -0,0 +1,142 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "SdkMerge.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// Helper function to match the struct line of a class, and not of others whose name it starts
+std::string structPattern(const std::string& className) {
+    return "public\\s+readonly\\s+partial\\s+struct\\s+" + className + "\\b";
+}
+
+// Helper function to check for the "// [Class] ..." comment the C# emitter writes above a struct
+bool isClassComment(const std::string& line) {
+    size_t start = line.find_first_not_of(" \t");
+    return start != std::string::npos && line.compare(start, 10, "// [Class]") == 0;
+}
+
+} // namespace
+
+bool checkClassExists(const std::string& className, const std::string& sdkPath, size_t& startLine, size_t& endLine) {
+    std::ifstream file(sdkPath);
+    if (!file.is_open()) return false;
+
+    std::string line;
+    std::regex classPattern(structPattern(className));
+    size_t currentLine = 0;
+    bool found = false;
+    int braceCount = 0;
+    
+    while (std::getline(file, line)) {
+        currentLine++;
+        
+        if (!found && std::regex_search(line, classPattern)) {
+            found = true;
+            startLine = currentLine;
+            braceCount = 0;
+            for (char c : line) {
+                if (c == '{') braceCount++;
+            }
+            continue;
+        }
+        
+        if (found) {
+            for (char c : line) {
+                if (c == '{') braceCount++;
+                if (c == '}') braceCount--;
+            }
+            if (braceCount <= 0) {
+                endLine = currentLine;
+                return true;
+            }
+        }
+    }
+    return found;
+}
+
+bool hasProperNamespaceClosure(const std::string& sdkPath) {
+    std::ifstream file(sdkPath);
+    if (!file.is_open()) return false;
+
+    // Read the entire file into a string
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string content = buffer.str();
+
+    // Trim whitespace from the end
+    content.erase(std::find_if(content.rbegin(), content.rend(), [](unsigned char ch) {
+        return !std::isspace(ch);
+    }).base(), content.end());
+
+    // Check if the file ends with a closing brace, or has nothing after the namespace's
+    // opening one (its only class was taken out to be replaced)
+    if (content.empty() || content.back() == '}') return true;
+    content.erase(std::remove_if(content.begin(), content.end(), [](unsigned char ch) { return std::isspace(ch); }), content.end());
+    return content == "namespaceSDK{";
+}
+
+void removeExistingClass(const std::string& className, const std::string& sdkPath) {
+    std::ifstream inFile(sdkPath);
+    std::vector<std::string> kept;
+    std::string line;
+    std::regex classPattern(structPattern(className));
+    bool skipping = false;
+    bool removed = false;
+    int braceCount = 0;
+
+    while (std::getline(inFile, line)) {
+        if (!skipping) {
+            if (std::regex_search(line, classPattern)) {
+                // The header comment above the struct goes with it
+                if (!kept.empty() && isClassComment(kept.back())) kept.pop_back();
+                skipping = true;
+                braceCount = 0;
+                continue;
+            }
+            // So does the blank line after it, so the file still ends with a closing brace
+            if (removed && line.empty()) {
+                removed = false;
+                continue;
+            }
+            removed = false;
+            kept.push_back(line);
+        }
+        else {
+            // Count braces to find the end of the class
+            for (char c : line) {
+                if (c == '{') braceCount++;
+                if (c == '}') braceCount--;
+            }
+            if (braceCount <= 0) {
+                skipping = false;
+                removed = true;
+            }
+        }
+    }
+    inFile.close();
+
+    std::ofstream outFile(sdkPath);
+    for (const std::string& keptLine : kept) outFile << keptLine << "\n";
+}
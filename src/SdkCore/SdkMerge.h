@@ -0,0 +1,37 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Merging a class into an SDK file that was built up selection by selection
+// ("Export Selection to Master SDK"): finding an earlier definition of the struct
+// and taking it out before the new one is appended.
+//
+#include <cstddef>
+#include <string>
+
+// Checks if a struct is defined in the SDK file and gets its 1-based line range
+bool checkClassExists(const std::string& className, const std::string& sdkPath, size_t& startLine, size_t& endLine);
+
+// Checks that the SDK file ends with the closing brace of its namespace (an empty file, or
+// an empty namespace, passes)
+bool hasProperNamespaceClosure(const std::string& sdkPath);
+
+// Rewrites the SDK file without the struct's definition
+void removeExistingClass(const std::string& className, const std::string& sdkPath);
@@ -0,0 +1,139 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "SelectionFormatter.h"
+#include <limits>
+
+namespace {
+
+// \s of std::regex: the "C" locale's whitespace
+bool isRegexSpace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool isUpperHexDigit(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F');
+}
+
+// Helper function to skip \s* from `pos`
+size_t skipSpaces(std::string_view line, size_t pos) {
+    while (pos < line.size() && isRegexSpace(line[pos])) pos++;
+    return pos;
+}
+
+//
+// Matches \[([0-9A-F]+)\](?:\[([CS])\])?\s+([^\s:]+)\s*:\s*(.+) starting at the '['
+// at `at`, with the groups std::regex_search would give.
+//
+bool matchOffsetLineAt(std::string_view line, size_t at, std::string_view& offset, char& tag, std::string_view& name, std::string_view& type) {
+    size_t pos = at + 1;
+    while (pos < line.size() && isUpperHexDigit(line[pos])) pos++;
+    if (pos == at + 1 || pos >= line.size() || line[pos] != ']') return false;
+    offset = line.substr(at + 1, pos - at - 1);
+    pos++;
+
+    tag = 0;
+    if (pos + 2 < line.size() && line[pos] == '[' && (line[pos + 1] == 'C' || line[pos + 1] == 'S') && line[pos + 2] == ']') {
+        tag = line[pos + 1];
+        pos += 3;
+    }
+
+    size_t nameStart = skipSpaces(line, pos);
+    if (nameStart == pos) return false;
+    pos = nameStart;
+    while (pos < line.size() && !isRegexSpace(line[pos]) && line[pos] != ':') pos++;
+    if (pos == nameStart) return false;
+    name = line.substr(nameStart, pos - nameStart);
+
+    pos = skipSpaces(line, pos);
+    if (pos >= line.size() || line[pos] != ':') return false;
+    size_t colon = pos;
+
+    // '.' stops at line terminators; when nothing else is left it backtracks into the spaces
+    auto isTerminator = [](char c) { return c == '\n' || c == '\r'; };
+    size_t typeStart = skipSpaces(line, colon + 1);
+    size_t typeEnd = typeStart;
+    while (typeEnd < line.size() && !isTerminator(line[typeEnd])) typeEnd++;
+    if (typeEnd == typeStart) {
+        while (typeStart > colon + 1 && isTerminator(line[typeStart - 1])) typeStart--;
+        if (typeStart == colon + 1) return false;
+        typeStart--;
+        typeEnd = typeStart + 1;
+    }
+    type = line.substr(typeStart, typeEnd - typeStart);
+    return true;
+}
+
+} // namespace
+
+bool parseSelectionClassLine(std::string_view line, DumpClassHeader& header) {
+    // Same as searching for \[Class\]\s+([^:]+)(?:\s*:\s*([^{]+))? with std::regex
+    for (size_t at = line.find("[Class]"); at != std::string_view::npos; at = line.find("[Class]", at + 1)) {
+        size_t afterMarker = at + 7;
+        size_t nameStart = skipSpaces(line, afterMarker);
+        if (nameStart == afterMarker) continue;
+        size_t nameEnd = std::min(line.find(':', nameStart), line.size());
+        if (nameEnd == nameStart) {
+            // [^:]+ takes back one of the spaces, if \s+ can spare it
+            if (nameStart - afterMarker < 2) continue;
+            nameStart--;
+        }
+
+        header.line = line;
+        header.name = trimView(line.substr(nameStart, nameEnd - nameStart));
+        header.bases = std::string_view();
+        if (nameEnd < line.size()) {
+            size_t colon = nameEnd;
+            size_t basesStart = skipSpaces(line, colon + 1);
+            size_t basesEnd = std::min(line.find('{', basesStart), line.size());
+            if (basesEnd == basesStart && basesStart > colon + 1) basesStart--;
+            if (basesEnd > basesStart) header.bases = trimView(line.substr(basesStart, basesEnd - basesStart));
+        }
+        return true;
+    }
+    return false;
+}
+
+bool parseOffsetLine(std::string_view line, DumpField& field) {
+    // Look for [offset][type] fieldName : dataType anywhere in the line; names like
+    // <Name>k__BackingField are made into identifiers by the emitter
+    std::string_view offset, name, type;
+    char tag = 0;
+    size_t at = line.find('[');
+    while (at != std::string_view::npos && !matchOffsetLineAt(line, at, offset, tag, name, type)) at = line.find('[', at + 1);
+    if (at == std::string_view::npos) return false;
+
+    // Validate the offset is a hex number that fits an unsigned long, as std::stoul would
+    unsigned long hexValue = 0;
+    for (char c : offset) {
+        unsigned long digit = static_cast<unsigned long>(c <= '9' ? c - '0' : c - 'A' + 10);
+        if (hexValue > (std::numeric_limits<unsigned long>::max() - digit) / 16) return false;
+        hexValue = hexValue * 16 + digit;
+    }
+    if (hexValue == 0 && offset != "0") {
+        // Invalid hex value (zero but not "0")
+        return false;
+    }
+
+    field.offsetText = offset;
+    field.offset = hexValue;
+    field.tag = tag == 0 ? FieldTag::Instance : tag == 'C' ? FieldTag::Const : FieldTag::Static;
+    field.name = name;
+    field.type = type;
+    return true;
+}
@@ -0,0 +1,93 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// The plugin's selection exports: the classes and offset lines of text selected in
+// the editor, formatted through an emitter. Unlike the whole-file exports this
+// looks for a class header or field anywhere in each line, so it copes with
+// partial classes and stray lines in a hand-made selection. The matchers accept
+// what the regular expressions in their comments would, without std::regex, so
+// a field line costs no allocation.
+//
+#include <string>
+#include <string_view>
+#include "Emitter.h"
+
+// Finds "[Class] Name : Bases" anywhere in a selected line. The header points into `line`.
+bool parseSelectionClassLine(std::string_view line, DumpClassHeader& header);
+
+// Parses a selected "[offset][tag] fieldName : dataType" line. The field points into `line`.
+bool parseOffsetLine(std::string_view line, DumpField& field);
+
+//
+// Formats the classes and offset lines of a selection through an emitter. `className`
+// receives the struct name of the last class and `processedLines` the number of
+// fields; returns "" if there were none.
+//
+template <typename Emitter>
+std::string formatSelection(const std::string& selectedText, Emitter emitter, std::string& className, int& processedLines) {
+    std::string_view text = selectedText;
+    std::string output;
+    processedLines = 0;
+    IdentifierTable structNames;
+    bool insideClass = false;
+    DumpClassHeader header;
+    DumpField field;
+
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) end = text.size();
+        std::string_view line = text.substr(pos, end - pos);
+        pos = end + 1;
+        // Selections from CRLF documents keep the '\r'
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        // Check if this is a class declaration line
+        if (parseSelectionClassLine(line, header)) {
+            // If we were processing a previous class, close and add it to the output
+            if (insideClass) {
+                emitter.endClass(output, false);
+            }
+
+            // Same struct name as the whole-file export gives the class
+            std::string_view structName = structNames.get(header.name);
+            insideClass = true;
+            className = structName; // Store the last processed class name
+
+            // Start building the output for this class
+            emitter.beginClass(output, header, structName);
+            continue;
+        }
+
+        // If we're inside a class definition, process the line
+        if (insideClass && parseOffsetLine(line, field)) {
+            emitter.field(output, field);
+            processedLines++;
+        }
+    }
+
+    // Close and add the last class if we were processing one
+    if (insideClass) {
+        emitter.endClass(output, false);
+    }
+
+    return processedLines > 0 ? output : "";
+}
@@ -0,0 +1,146 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "ShardWriter.h"
+#include "Instrument.h"
+#include "IoUringWriter.h"
+#include <algorithm>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+bool parseShardWriterBackend(std::string_view name, ShardWriterBackend& out) {
+    if (name == "auto") out = ShardWriterBackend::Auto;
+    else if (name == "threads") out = ShardWriterBackend::Threads;
+    else if (name == "uring" || name == "io_uring") out = ShardWriterBackend::IoUring;
+    else return false;
+    return true;
+}
+
+ShardWriter::ShardWriter(unsigned threads, ShardWriterBackend backend, size_t maxQueued)
+    : _backend(backend == ShardWriterBackend::Threads || !IoUringWriter::available() ? ShardWriterBackend::Threads : ShardWriterBackend::IoUring),
+      _maxQueued(maxQueued) {
+    if (threads == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        threads = _backend == ShardWriterBackend::IoUring ? std::max(1u, cores / 4) : std::max(4u, 2 * cores);
+    }
+    for (unsigned t = 0; t < threads; t++) _threads.emplace_back([this] { run(); });
+}
+
+void ShardWriter::write(std::vector<ShardFile> batch) {
+    if (batch.empty()) return;
+    std::unique_lock<std::mutex> lock(_mutex);
+    _drained.wait(lock, [this] { return _queue.size() < _maxQueued; });
+    _queue.push_back(std::move(batch));
+    lock.unlock();
+    _ready.notify_one();
+}
+
+size_t ShardWriter::finish() {
+    if (!_threads.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _finishing = true;
+        }
+        _ready.notify_all();
+        for (std::thread& thread : _threads) thread.join();
+        _threads.clear();
+    }
+    return _failed;
+}
+
+void ShardWriter::run() {
+    // Each io_uring thread has a ring of its own
+    IoUringWriter ring;
+    bool useRing = _backend == ShardWriterBackend::IoUring && ring.init();
+    std::vector<const ShardFile*> retry;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _ready.wait(lock, [this] { return !_queue.empty() || _finishing; });
+        if (_queue.empty()) return;
+
+        std::vector<ShardFile> batch = std::move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        _drained.notify_one();
+
+        SDK_INSTRUMENT_STAGE(Write);
+#if defined(SDKCORE_INSTRUMENT)
+        for (const ShardFile& file : batch) SDK_INSTRUMENT_COUNT(BytesOut, file.data.size());
+#endif
+
+        // Files the ring couldn't write get a second chance with blocking calls
+        size_t failed = 0;
+        const std::filesystem::path* failure = nullptr;
+        auto writeBlocking = [&](const ShardFile& file) {
+            if (writeWholeFile(file.path, file.data)) return;
+            if (failed++ == 0) failure = &file.path;
+        };
+        if (useRing) {
+            retry.clear();
+            ring.write(batch, retry);
+            for (const ShardFile* file : retry) writeBlocking(*file);
+        }
+        else {
+            for (const ShardFile& file : batch) writeBlocking(file);
+        }
+
+        lock.lock();
+        if (failed && _failed == 0) _firstFailure = *failure;
+        _failed += failed;
+    }
+}
+
+#ifdef _WIN32
+
+bool writeWholeFile(const std::filesystem::path& path, std::string_view data) {
+    HANDLE file = ::CreateFileW(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    bool ok = true;
+    while (ok && !data.empty()) {
+        DWORD chunk = static_cast<DWORD>(std::min<size_t>(data.size(), 1u << 30));
+        DWORD written = 0;
+        ok = ::WriteFile(file, data.data(), chunk, &written, NULL) != 0 && written > 0;
+        data.remove_prefix(written);
+    }
+    return ::CloseHandle(file) != 0 && ok;
+}
+
+#else
+
+bool writeWholeFile(const std::filesystem::path& path, std::string_view data) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    bool ok = true;
+    while (ok && !data.empty()) {
+        ssize_t written = ::write(fd, data.data(), data.size());
+        if (written < 0 && errno == EINTR) continue;
+        ok = written > 0;
+        if (ok) data.remove_prefix(static_cast<size_t>(written));
+    }
+    return ::close(fd) == 0 && ok;
+}
+
+#endif
@@ -0,0 +1,94 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Writes many small files, each in one go, on a pool of threads. Exports that
+// produce one file per class are limited by the time the file system takes to
+// create and close each file rather than by the bytes written, so several files
+// are kept in flight at once and the code producing them only waits when the
+// writers fall far behind.
+//
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// How a ShardWriter creates its files
+enum class ShardWriterBackend : uint8_t {
+    Auto,     // io_uring where the kernel has it, else Threads
+    Threads,  // a pool of threads making blocking calls
+    IoUring,  // linked open/write/close chains on Linux io_uring (IoUringWriter.h); Threads where unavailable
+};
+
+// Parses "auto", "threads" or "uring"; returns false for anything else
+bool parseShardWriterBackend(std::string_view name, ShardWriterBackend& out);
+
+struct ShardFile {
+    std::filesystem::path path;
+    std::string data;
+};
+
+class ShardWriter {
+public:
+    // threads = 0 picks a few per core for the thread pool, since those threads mostly
+    // wait on the file system, and one ring per four cores for io_uring, whose
+    // threads only submit and reap
+    explicit ShardWriter(unsigned threads = 0, ShardWriterBackend backend = ShardWriterBackend::Auto, size_t maxQueued = 64);
+    ~ShardWriter() { finish(); }
+    ShardWriter(const ShardWriter&) = delete;
+    ShardWriter& operator=(const ShardWriter&) = delete;
+
+    // Queues a batch of files, each created (or truncated) and written whole.
+    // Safe to call from several threads.
+    void write(std::vector<ShardFile> batch);
+
+    // Waits until every queued file is written and stops the threads.
+    // Returns the number of files that couldn't be written.
+    size_t finish();
+
+    // Threads or IoUring, whichever is in use
+    ShardWriterBackend backend() const { return _backend; }
+
+    // The first file that couldn't be written, if any
+    const std::filesystem::path& firstFailure() const { return _firstFailure; }
+
+private:
+    void run();
+
+    ShardWriterBackend _backend;
+    size_t _maxQueued;
+    std::mutex _mutex;
+    std::condition_variable _ready;   // a batch was queued, or finish() was called
+    std::condition_variable _drained; // a batch was written
+    std::deque<std::vector<ShardFile>> _queue;
+    bool _finishing = false;
+    size_t _failed = 0;
+    std::filesystem::path _firstFailure;
+    std::vector<std::thread> _threads;
+};
+
+// Helper function to create (or truncate) `path` and write `data` to it with one
+// open, write and close. Returns false on any error.
+bool writeWholeFile(const std::filesystem::path& path, std::string_view data);
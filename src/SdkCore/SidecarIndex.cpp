@@ -0,0 +1,234 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#include "SidecarIndex.h"
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+#include "DumpParser.h"
+#include "Hash.h"
+
+static_assert(std::endian::native == std::endian::little, "the sidecar format is little-endian");
+
+static constexpr char SIDECAR_MAGIC[8] = { 'S', 'D', 'K', 'I', 'D', 'X', 0, 0 };
+
+uint64_t sampleDumpHash(std::string_view dump) {
+    static constexpr size_t SAMPLE_SIZE = 4096;
+    static constexpr size_t SAMPLE_COUNT = 64;
+
+    if (dump.size() <= SAMPLE_SIZE * SAMPLE_COUNT) return hashString(dump);
+
+    // Evenly spaced samples, the last one ending exactly at the end of the dump
+    uint64_t h = dump.size();
+    size_t stride = (dump.size() - SAMPLE_SIZE) / (SAMPLE_COUNT - 1);
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        h = hashBytes(dump.data() + i * stride, SAMPLE_SIZE, h);
+    }
+    return h;
+}
+
+std::filesystem::path SidecarIndex::sidecarPath(const std::filesystem::path& dumpPath) {
+    std::filesystem::path path = dumpPath;
+    path += ".idx";
+    return path;
+}
+
+namespace {
+
+// scanDump() visitor that only counts field lines
+struct FieldCounter {
+    uint32_t fields = 0;
+    void onClass(const DumpClassHeader&) {}
+    void onField(const DumpField&) { fields++; }
+};
+
+} // namespace
+
+bool SidecarIndex::openOrBuild(const std::filesystem::path& dumpPath, std::string_view dump) {
+    _header = nullptr;
+    _reused = false;
+    _built.clear();
+    _dumpPath = dumpPath;
+
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(dumpPath, ec);
+    int64_t dumpMtime = ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+    uint64_t sampleHash = sampleDumpHash(dump);
+    std::filesystem::path idxPath = sidecarPath(dumpPath);
+
+    // Reuse the sidecar on disk if it still describes this dump
+    if (_file.open(idxPath) && attach(_file.view(), dump.size(), dumpMtime, sampleHash)) {
+        _reused = true;
+        return true;
+    }
+    _file.close();
+    return build(idxPath, dump, dumpMtime, sampleHash);
+}
+
+bool SidecarIndex::build(const std::filesystem::path& idxPath, std::string_view dump, int64_t dumpMtime, uint64_t sampleHash) {
+    _header = nullptr;
+    _reused = false;
+    _file.close();
+
+    // Scan the dump once and record every class block
+    ClassIndex classes;
+    classes.build(dump);
+
+    std::string namePool;
+    std::vector<SidecarEntry> entries;
+    entries.reserve(classes.size());
+    for (const ClassSpan& span : classes.byName()) {
+        std::string_view block = dump.substr(span.begin, span.end - span.begin);
+        FieldCounter counter;
+        scanDump(block, counter);
+
+        SidecarEntry e = {};
+        e.offset = span.begin;
+        e.length = block.size();
+        e.nameHash = hashString(span.name);
+        e.blockHash = hashString(block);
+        e.nameOffset = static_cast<uint32_t>(namePool.size());
+        e.nameLength = static_cast<uint32_t>(span.name.size());
+        e.fieldCount = counter.fields;
+        entries.push_back(e);
+        namePool.append(span.name);
+    }
+
+    SidecarHeader header = {};
+    std::memcpy(header.magic, SIDECAR_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.classCount = static_cast<uint32_t>(entries.size());
+    header.dumpSize = dump.size();
+    header.dumpMtime = dumpMtime;
+    header.sampleHash = sampleHash;
+    header.namePoolOffset = sizeof(SidecarHeader) + entries.size() * sizeof(SidecarEntry);
+    header.namePoolSize = namePool.size();
+
+    _built.resize(static_cast<size_t>(header.namePoolOffset + header.namePoolSize));
+    std::memcpy(_built.data(), &header, sizeof(header));
+    if (!entries.empty()) std::memcpy(_built.data() + sizeof(header), entries.data(), entries.size() * sizeof(SidecarEntry));
+    if (!namePool.empty()) std::memcpy(_built.data() + header.namePoolOffset, namePool.data(), namePool.size());
+
+    // Write through a temporary file so a crash never leaves a torn sidecar behind
+    std::error_code ec;
+    std::filesystem::path tmpPath = idxPath;
+    tmpPath += ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        out.write(_built.data(), static_cast<std::streamsize>(_built.size()));
+        out.close();
+        if (out.good()) std::filesystem::rename(tmpPath, idxPath, ec);
+        else std::filesystem::remove(tmpPath, ec);
+    }
+
+    return attach(std::string_view(_built.data(), _built.size()), dump.size(), dumpMtime, sampleHash);
+}
+
+bool SidecarIndex::attach(std::string_view bytes, uint64_t dumpSize, int64_t dumpMtime, uint64_t sampleHash) {
+    _header = nullptr;
+    if (bytes.size() < sizeof(SidecarHeader)) return false;
+
+    const SidecarHeader* header = reinterpret_cast<const SidecarHeader*>(bytes.data());
+    if (std::memcmp(header->magic, SIDECAR_MAGIC, sizeof(header->magic)) != 0 || header->version != VERSION) return false;
+    if (header->dumpSize != dumpSize || header->dumpMtime != dumpMtime || header->sampleHash != sampleHash) return false;
+
+    uint64_t entriesEnd = sizeof(SidecarHeader) + uint64_t(header->classCount) * sizeof(SidecarEntry);
+    if (header->namePoolOffset < entriesEnd || header->namePoolOffset + header->namePoolSize > bytes.size()) return false;
+
+    const SidecarEntry* entries = reinterpret_cast<const SidecarEntry*>(bytes.data() + sizeof(SidecarHeader));
+    for (uint32_t i = 0; i < header->classCount; i++) {
+        const SidecarEntry& e = entries[i];
+        if (uint64_t(e.nameOffset) + e.nameLength > header->namePoolSize) return false;
+        if (e.offset + e.length > dumpSize) return false;
+    }
+
+    _header = header;
+    _entries = entries;
+    _names = bytes.data() + header->namePoolOffset;
+    return true;
+}
+
+size_t SidecarIndex::lowerBound(std::string_view name) const {
+    size_t lo = 0, hi = size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (this->name(_entries[mid]) < name) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+const SidecarEntry* SidecarIndex::find(std::string_view name) const {
+    size_t i = lowerBound(name);
+    if (i < size() && this->name(_entries[i]) == name) return &_entries[i];
+    return nullptr;
+}
+
+std::vector<const SidecarEntry*> SidecarIndex::matchEntries(std::string_view pattern) const {
+    size_t wildcard = pattern.find_first_of("*?");
+    std::string_view prefix = pattern.substr(0, wildcard);
+
+    std::vector<const SidecarEntry*> result;
+    for (size_t i = lowerBound(prefix); i < size(); i++) {
+        const SidecarEntry& e = _entries[i];
+        std::string_view n = name(e);
+        if (n.substr(0, prefix.size()) != prefix) break;
+        if (wildcard == std::string_view::npos ? n.size() == pattern.size() : globMatch(pattern, n)) result.push_back(&e);
+    }
+    return result;
+}
+
+std::vector<ClassSpan> SidecarIndex::matchGlob(std::string_view pattern) const {
+    std::vector<ClassSpan> result;
+    for (const SidecarEntry* e : matchEntries(pattern)) {
+        result.push_back({ name(*e), static_cast<size_t>(e->offset), static_cast<size_t>(e->offset + e->length) });
+    }
+    return result;
+}
+
+bool SidecarIndex::verify(const SidecarEntry& e, std::string_view dump) const {
+    if (e.offset + e.length > dump.size()) return false;
+    return hashString(name(e)) == e.nameHash
+        && hashString(dump.substr(static_cast<size_t>(e.offset), static_cast<size_t>(e.length))) == e.blockHash;
+}
+
+std::vector<ClassSpan> SidecarIndex::seekGlob(std::string_view pattern, std::string_view dump) {
+    // One rebuild is enough: a freshly built index describes `dump` exactly
+    for (int attempt = 0; attempt < 2; attempt++) {
+        std::vector<ClassSpan> result;
+        bool stale = false;
+        for (const SidecarEntry* e : matchEntries(pattern)) {
+            if (!verify(*e, dump)) {
+                stale = true;
+                break;
+            }
+
+            // Take the name from the verified header line rather than the index
+            std::string_view block = dump.substr(static_cast<size_t>(e->offset), static_cast<size_t>(e->length));
+            DumpClassHeader header;
+            parseClassHeader(block.substr(0, block.find('\n')), header);
+            result.push_back({ header.name, static_cast<size_t>(e->offset), static_cast<size_t>(e->offset + e->length) });
+        }
+        if (!stale || attempt == 1) return result;
+
+        std::error_code ec;
+        auto mtime = std::filesystem::last_write_time(_dumpPath, ec);
+        build(sidecarPath(_dumpPath), dump, ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count()), sampleDumpHash(dump));
+    }
+    return {};
+}
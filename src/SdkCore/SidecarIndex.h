@@ -0,0 +1,122 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+#pragma once
+
+//
+// Persistent "<dump>.idx" sidecar recording where every class lives in a dump,
+// so later runs seek straight to the classes they need instead of rescanning.
+//
+// Layout (little-endian, used in place through a memory mapping):
+//     SidecarHeader
+//     SidecarEntry[classCount]   sorted by class name
+//     name pool                  class names, not NUL terminated
+//
+// The file is trusted only while the dump's size, mtime and a sampled content
+// hash still match the header; otherwise it is rebuilt. Classes reached through
+// seekGlob() are also checked against their name and block hash, so an edit
+// the sampled hash missed rebuilds the sidecar instead of yielding stale spans.
+//
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ClassIndex.h"
+#include "MappedFile.h"
+
+struct SidecarHeader {
+    char magic[8];          // "SDKIDX\0\0"
+    uint32_t version;
+    uint32_t classCount;
+    uint64_t dumpSize;
+    int64_t dumpMtime;      // filesystem clock ticks
+    uint64_t sampleHash;    // hash of evenly spaced samples of the dump
+    uint64_t namePoolOffset;
+    uint64_t namePoolSize;
+    uint64_t reserved;
+};
+
+struct SidecarEntry {
+    uint64_t offset;        // byte offset of the header line in the dump
+    uint64_t length;        // bytes up to the next header
+    uint64_t nameHash;
+    uint64_t blockHash;     // hash of the whole class block
+    uint32_t nameOffset;    // into the name pool
+    uint32_t nameLength;
+    uint32_t fieldCount;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(SidecarHeader) == 64, "SidecarHeader layout is persisted");
+static_assert(sizeof(SidecarEntry) == 48, "SidecarEntry layout is persisted");
+
+// Fingerprint of a dump that is cheap to compute even for very large files
+uint64_t sampleDumpHash(std::string_view dump);
+
+class SidecarIndex {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    // Path of the sidecar belonging to `dumpPath`
+    static std::filesystem::path sidecarPath(const std::filesystem::path& dumpPath);
+
+    //
+    // Maps "<dump>.idx" if it is still valid for `dump` (the mapped contents of
+    // dumpPath), otherwise scans the dump and writes a fresh one. Returns false
+    // only if no index could be produced at all; failing to write the sidecar
+    // just means the next run rebuilds it.
+    //
+    bool openOrBuild(const std::filesystem::path& dumpPath, std::string_view dump);
+
+    // True if the last openOrBuild() reused the sidecar on disk
+    bool reused() const { return _reused; }
+
+    size_t size() const { return _header ? _header->classCount : 0; }
+    const SidecarEntry& entry(size_t i) const { return _entries[i]; }
+    std::string_view name(const SidecarEntry& e) const { return std::string_view(_names + e.nameOffset, e.nameLength); }
+
+    // Exact lookup by fully qualified class name, nullptr if absent
+    const SidecarEntry* find(std::string_view name) const;
+
+    // Same semantics as ClassIndex::matchGlob(); span names point into the index
+    std::vector<ClassSpan> matchGlob(std::string_view pattern) const;
+
+    // True if the block `e` describes is still in `dump` with the recorded hashes
+    bool verify(const SidecarEntry& e, std::string_view dump) const;
+
+    //
+    // matchGlob() for reading the matched blocks out of `dump`: each one is
+    // verified first, and on any mismatch the sidecar is rebuilt and the match
+    // repeated. Span names point into the dump, so they stay valid across rebuilds.
+    //
+    std::vector<ClassSpan> seekGlob(std::string_view pattern, std::string_view dump);
+
+private:
+    bool build(const std::filesystem::path& idxPath, std::string_view dump, int64_t dumpMtime, uint64_t sampleHash);
+    bool attach(std::string_view bytes, uint64_t dumpSize, int64_t dumpMtime, uint64_t sampleHash);
+    size_t lowerBound(std::string_view name) const;
+    std::vector<const SidecarEntry*> matchEntries(std::string_view pattern) const;
+
+    MappedFile _file;
+    std::vector<char> _built; // used instead of _file when the sidecar couldn't be written
+    const SidecarHeader* _header = nullptr;
+    const SidecarEntry* _entries = nullptr;
+    const char* _names = nullptr;
+    std::filesystem::path _dumpPath;
+    bool _reused = false;
+};
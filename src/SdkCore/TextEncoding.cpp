@@ -0,0 +1,216 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#include "TextEncoding.h"
+#include "Instrument.h"
+#include <algorithm>
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SDKCORE_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+DumpTextInfo detectDumpEncoding(std::string_view data) {
+    DumpTextInfo info;
+    auto startsWith = [&](std::string_view bom) { return data.substr(0, bom.size()) == bom; };
+    if (startsWith("\xEF\xBB\xBF")) {
+        info.bomSize = 3;
+        return info;
+    }
+    if (startsWith("\xFF\xFE")) {
+        info.encoding = DumpEncoding::Utf16LE;
+        info.bomSize = 2;
+        return info;
+    }
+    if (startsWith("\xFE\xFF")) {
+        info.encoding = DumpEncoding::Utf16BE;
+        info.bomSize = 2;
+        return info;
+    }
+
+    // No BOM: UTF-16 if nearly all zero bytes sit on one side of the code units
+    size_t sample = std::min<size_t>(data.size(), 4096) & ~size_t(1);
+    size_t evenZeros = 0, oddZeros = 0;
+    for (size_t i = 0; i < sample; i += 2) {
+        evenZeros += data[i] == '\0';
+        oddZeros += data[i + 1] == '\0';
+    }
+    size_t units = sample / 2;
+    if (units >= 4) {
+        if (oddZeros * 10 >= units * 9 && evenZeros * 10 < units) info.encoding = DumpEncoding::Utf16LE;
+        else if (evenZeros * 10 >= units * 9 && oddZeros * 10 < units) info.encoding = DumpEncoding::Utf16BE;
+    }
+    return info;
+}
+
+const char* dumpEncodingName(DumpEncoding encoding) {
+    switch (encoding) {
+    case DumpEncoding::Utf16LE: return "UTF-16LE";
+    case DumpEncoding::Utf16BE: return "UTF-16BE";
+    default: return "UTF-8";
+    }
+}
+
+namespace {
+
+// Helper function to append one code point as UTF-8
+char* putUtf8(char* out, uint32_t c) {
+    if (c < 0x80) {
+        *out++ = static_cast<char>(c);
+    }
+    else if (c < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (c >> 6));
+        *out++ = static_cast<char>(0x80 | (c & 0x3F));
+    }
+    else if (c < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (c >> 12));
+        *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (c & 0x3F));
+    }
+    else {
+        *out++ = static_cast<char>(0xF0 | (c >> 18));
+        *out++ = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (c & 0x3F));
+    }
+    return out;
+}
+
+constexpr uint32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+} // namespace
+
+std::string utf16ToUtf8(std::string_view bytes, bool bigEndian) {
+    const unsigned char* src = reinterpret_cast<const unsigned char*>(bytes.data());
+    size_t units = bytes.size() / 2;
+    auto unitAt = [&](size_t i) -> uint32_t {
+        return bigEndian ? (uint32_t(src[2 * i]) << 8) | src[2 * i + 1] : (uint32_t(src[2 * i + 1]) << 8) | src[2 * i];
+    };
+
+    // Every code unit becomes at most 3 bytes (a surrogate pair, 2 units, becomes 4)
+    std::string text(units * 3 + 3, '\0');
+    char* out = text.data();
+    size_t i = 0;
+    while (i < units) {
+#ifdef SDKCORE_HAVE_SSE2
+        // Runs of ASCII: narrow 8 code units to 8 bytes at a time
+        const __m128i nonAscii = _mm_set1_epi16(static_cast<short>(0xFF80));
+        for (; i + 8 <= units; i += 8) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * i));
+            if (bigEndian) v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, nonAscii), _mm_setzero_si128())) != 0xFFFF) break;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v, v));
+            out += 8;
+        }
+        if (i >= units) break;
+#endif
+        // One code point the slow way, then back to the fast loop
+        uint32_t c = unitAt(i++);
+        if (c >= 0xD800 && c <= 0xDBFF) {
+            uint32_t low = i < units ? unitAt(i) : 0;
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                i++;
+            }
+            else {
+                c = REPLACEMENT_CHARACTER;
+            }
+        }
+        else if (c >= 0xDC00 && c <= 0xDFFF) {
+            c = REPLACEMENT_CHARACTER;
+        }
+        out = putUtf8(out, c);
+    }
+    if (bytes.size() % 2) out = putUtf8(out, REPLACEMENT_CHARACTER);
+    text.resize(static_cast<size_t>(out - text.data()));
+    return text;
+}
+
+std::string_view normalizeDumpText(std::string_view data, std::string& storage, DumpTextInfo* info) {
+    SDK_INSTRUMENT_STAGE(Decode);
+    DumpTextInfo detected = detectDumpEncoding(data);
+    if (info) *info = detected;
+    if (detected.encoding == DumpEncoding::Utf8) return data.substr(detected.bomSize);
+    // Transcode first: `data` may point into `storage`
+    std::string text = utf16ToUtf8(data.substr(detected.bomSize), detected.encoding == DumpEncoding::Utf16BE);
+    storage = std::move(text);
+    return storage;
+}
+
+namespace {
+
+// Length of the valid UTF-8 sequence starting at text[i] (a non-ASCII byte), or 0
+size_t validSequenceLength(std::string_view text, size_t i) {
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(text.data()) + i;
+    size_t left = text.size() - i;
+    auto continuation = [&](size_t k) { return k < left && (s[k] & 0xC0) == 0x80; };
+
+    unsigned char lead = s[0];
+    if (lead >= 0xC2 && lead <= 0xDF) return continuation(1) ? 2 : 0;
+    if (lead >= 0xE0 && lead <= 0xEF) {
+        if (!continuation(1) || !continuation(2)) return 0;
+        if (lead == 0xE0 && s[1] < 0xA0) return 0; // overlong
+        if (lead == 0xED && s[1] > 0x9F) return 0; // surrogate
+        return 3;
+    }
+    if (lead >= 0xF0 && lead <= 0xF4) {
+        if (!continuation(1) || !continuation(2) || !continuation(3)) return 0;
+        if (lead == 0xF0 && s[1] < 0x90) return 0; // overlong
+        if (lead == 0xF4 && s[1] > 0x8F) return 0; // past U+10FFFF
+        return 4;
+    }
+    return 0; // continuation byte, C0/C1 overlong lead, or F5..FF
+}
+
+} // namespace
+
+size_t findInvalidUtf8(std::string_view text, size_t from) {
+    size_t i = from;
+    while (i < text.size()) {
+#ifdef SDKCORE_HAVE_SSE2
+        // Skip ASCII 16 bytes at a time; the first byte with its top bit set stops it
+        for (; i + 16 <= text.size(); i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + i));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(v));
+            if (mask) {
+                i += static_cast<size_t>(std::countr_zero(mask));
+                break;
+            }
+        }
+        if (i >= text.size()) break;
+#endif
+        if (static_cast<unsigned char>(text[i]) < 0x80) {
+            i++;
+            continue;
+        }
+        size_t length = validSequenceLength(text, i);
+        if (length == 0) return i;
+        i += length;
+    }
+    return std::string_view::npos;
+}
+
+std::vector<size_t> invalidUtf8Offsets(std::string_view text, size_t limit) {
+    SDK_INSTRUMENT_STAGE(Decode);
+    std::vector<size_t> offsets;
+    for (size_t at = findInvalidUtf8(text); at != std::string_view::npos && offsets.size() < limit; at = findInvalidUtf8(text, at + 1)) {
+        offsets.push_back(at);
+    }
+    return offsets;
+}
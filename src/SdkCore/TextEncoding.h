@@ -0,0 +1,75 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+
+#pragma once
+
+//
+// Input normalisation: dumps may come as UTF-8 (with or without a byte order
+// mark) or as UTF-16 from Windows tools. Everything past this point works on
+// UTF-8; CRLF line ends are left in place and dropped by scanDump() itself.
+//
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class DumpEncoding : uint8_t {
+    Utf8,
+    Utf16LE,
+    Utf16BE,
+};
+
+struct DumpTextInfo {
+    DumpEncoding encoding = DumpEncoding::Utf8;
+    size_t bomSize = 0; // bytes of byte order mark skipped at the start
+};
+
+//
+// Works out the encoding from the byte order mark or, without one, from where
+// the zero bytes fall in the first few kilobytes: ASCII text in UTF-16 has a
+// zero in every other byte.
+//
+DumpTextInfo detectDumpEncoding(std::string_view data);
+
+// "UTF-8", "UTF-16LE" or "UTF-16BE"
+const char* dumpEncodingName(DumpEncoding encoding);
+
+//
+// UTF-16 to UTF-8. Runs of ASCII are narrowed 8 code units at a time; unpaired
+// surrogates and a trailing odd byte become U+FFFD. `bytes` excludes the BOM.
+//
+std::string utf16ToUtf8(std::string_view bytes, bool bigEndian);
+
+//
+// Returns the dump as UTF-8 text without a BOM: a view into `data` when it is
+// already UTF-8, else the transcoded text, kept in `storage` (which `data` may
+// point into). `info`, if given, receives what was detected.
+//
+std::string_view normalizeDumpText(std::string_view data, std::string& storage, DumpTextInfo* info = nullptr);
+
+//
+// Offset of the first byte at or after `from` that starts an invalid UTF-8
+// sequence (a stray continuation byte, truncated or overlong sequence, surrogate
+// or code point past U+10FFFF), or npos if there is none. ASCII is skipped 16
+// bytes at a time, so mostly-ASCII dumps validate at memory speed.
+//
+size_t findInvalidUtf8(std::string_view text, size_t from = 0);
+
+// Up to `limit` offsets of invalid sequences, for error reports
+std::vector<size_t> invalidUtf8Offsets(std::string_view text, size_t limit = 16);
@@ -0,0 +1,1601 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+//
+// Micro-benchmarks for SdkCore, run by name:
+//     SdkFormatterBench <benchmark> [args...]
+//
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <regex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "AllocationCounter.h"
+#include "PerfCounters.h"
+#include "SdkCore/CompressedDump.h"
+#include "SdkCore/DumpGenerator.h"
+#include "SdkCore/EditorCommands.h"
+#include "SdkCore/Hash.h"
+#include "SdkCore/Instrument.h"
+#include "SdkCore/IoUringWriter.h"
+#include "SdkCore/MappedFile.h"
+#include "SdkCore/MemoryEditorHost.h"
+#include "SdkCore/OffsetsDb.h"
+#include "SdkCore/SdkExport.h"
+#include "SdkCore/SdkMerge.h"
+#include "SdkCore/SelectionFormatter.h"
+#include "SdkCore/ShardWriter.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Keeps the optimiser from discarding a computed value
+static volatile uint64_t benchSink;
+
+
+// Parses SDK.cs the way a consumer without the database would: struct name -> field name -> offset
+using SdkOffsetMap = std::unordered_map<std::string, std::unordered_map<std::string, uint32_t>>;
+
+static SdkOffsetMap parseSdkCs(std::string_view text) {
+    static constexpr std::string_view STRUCT_PREFIX = "public readonly partial struct ";
+    static constexpr std::string_view FIELD_PREFIX = "public const uint ";
+
+    SdkOffsetMap offsets;
+    std::unordered_map<std::string, uint32_t>* current = nullptr;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) end = text.size();
+        std::string_view line = trimView(text.substr(pos, end - pos));
+        pos = end + 1;
+
+        if (line.substr(0, STRUCT_PREFIX.size()) == STRUCT_PREFIX) {
+            current = &offsets[std::string(line.substr(STRUCT_PREFIX.size()))];
+        }
+        else if (current && line.substr(0, FIELD_PREFIX.size()) == FIELD_PREFIX) {
+            line.remove_prefix(FIELD_PREFIX.size());
+            size_t assign = line.find(" = 0x");
+            if (assign == std::string_view::npos) continue;
+            (*current)[std::string(line.substr(0, assign))] = static_cast<uint32_t>(strtoul(line.data() + assign + 5, nullptr, 16));
+        }
+    }
+    return offsets;
+}
+
+//
+// offsetsdb <SDK.cs> <file.sdkdb> [lookups]: startup cost and per-lookup latency of
+// the offsets database against parsing the equivalent SDK.cs into hash maps.
+// Both files must come from the same dump, e.g. "export dump.txt -o SDK.cs -o file.sdkdb".
+//
+static int benchOffsetsDb(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "offsetsdb: expected <SDK.cs> <file.sdkdb> [lookups]\n");
+        return 2;
+    }
+    size_t lookups = argc > 2 ? std::max<size_t>(1, static_cast<size_t>(strtoull(argv[2], nullptr, 10))) : 1000000;
+
+    // Startup: read and parse SDK.cs
+    auto start = std::chrono::steady_clock::now();
+    MappedFile sdkFile;
+    if (!sdkFile.open(argv[0])) {
+        fprintf(stderr, "Failed to read %s\n", argv[0]);
+        return 1;
+    }
+    SdkOffsetMap sdk = parseSdkCs(sdkFile.view());
+    double parseMs = elapsedMs(start);
+
+    // Startup: map and attach the database
+    start = std::chrono::steady_clock::now();
+    MappedFile dbFile;
+    OffsetsDbReader db;
+    if (!dbFile.open(argv[1]) || !db.attach(dbFile.view().data(), dbFile.size())) {
+        fprintf(stderr, "%s is not a valid offsets database\n", argv[1]);
+        return 1;
+    }
+    double attachMs = elapsedMs(start);
+    if (db.fieldCount() == 0) {
+        fprintf(stderr, "%s has no fields\n", argv[1]);
+        return 1;
+    }
+
+    // Random (class, field) keys drawn from the database, with the matching SDK.cs struct names
+    struct Key {
+        std::string_view className;
+        std::string_view fieldName;
+        std::string structName;
+    };
+    std::mt19937_64 rng(12345);
+    std::vector<Key> keys(std::min<size_t>(lookups, 1 << 16));
+    for (Key& key : keys) {
+        const OffsetsDbField& field = db.fieldAt(static_cast<size_t>(rng() % db.fieldCount()));
+        key.className = db.name(db.classAt(field.classIndex));
+        key.fieldName = db.name(field);
+        key.structName = makeSdkStructName(key.className);
+    }
+
+    // Helper function to time `lookups` calls of lookup(key) and return ns per call.
+    // One untimed pass over the keys first, so page faults on the mapping aren't counted.
+    auto timeLookups = [&](auto&& lookup) {
+        uint64_t sum = 0;
+        for (const Key& key : keys) sum += lookup(key);
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; i++) sum += lookup(keys[i % keys.size()]);
+        benchSink = sum;
+        return elapsedMs(begin) * 1e6 / static_cast<double>(lookups);
+    };
+
+    std::string fieldName;
+    double mapNs = timeLookups([&](const Key& key) -> uint64_t {
+        auto cls = sdk.find(key.structName);
+        if (cls == sdk.end()) return 0;
+        fieldName.assign(key.fieldName);
+        auto field = cls->second.find(fieldName);
+        return field == cls->second.end() ? 0 : field->second;
+    });
+    double hashNs = timeLookups([&](const Key& key) -> uint64_t {
+        const OffsetsDbField* field = db.find(key.className, key.fieldName);
+        return field ? field->offset : 0;
+    });
+    double sortedNs = timeLookups([&](const Key& key) -> uint64_t {
+        const OffsetsDbField* field = db.findSorted(key.className, key.fieldName);
+        return field ? field->offset : 0;
+    });
+
+    printf("%zu classes, %zu fields, %zu lookups\n", db.classCount(), db.fieldCount(), lookups);
+    printf("SDK.cs      startup %9.2f ms   lookup %7.1f ns   (parse into hash maps)\n", parseMs, mapNs);
+    printf("sdkdb hash  startup %9.3f ms   lookup %7.1f ns%s\n", attachMs, hashNs, db.hasHash() ? "" : "   (no perfect hash in this file)");
+    printf("sdkdb bsearch                      lookup %7.1f ns\n", sortedNs);
+    return 0;
+}
+
+#ifdef __linux__
+// Helper function to count the files left in the direct descriptor tables of the
+// process's io_uring instances, from the "UserFiles:" list of their fdinfo
+static size_t ringFilesOpen() {
+    size_t open = 0;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/fd", error)) {
+        std::filesystem::path target = std::filesystem::read_symlink(entry.path(), error);
+        if (error || target.string().find("io_uring") == std::string::npos) continue;
+        FILE* info = fopen(("/proc/self/fdinfo/" + entry.path().filename().string()).c_str(), "r");
+        if (!info) continue;
+        char line[512];
+        bool inFiles = false;
+        while (fgets(line, sizeof(line), info)) {
+            if (!strncmp(line, "UserFiles:", 10)) inFiles = true;
+            else if (line[0] != ' ' && line[0] != '\t') inFiles = false;
+            else if (inFiles) open++;
+        }
+        fclose(info);
+    }
+    return open;
+}
+#endif
+
+// Helper function to write a batch through an io_uring writer with a few files whose
+// write fails (to /dev/full) among good ones, over several rounds of a shallow ring.
+// Only the failed files may come back, the others must hold their contents, and no
+// failed file may be left open in the ring's slots. Returns false if any of that fails.
+static bool checkRingWriteFailures(const std::filesystem::path& dir) {
+#ifdef __linux__
+    IoUringWriter ring;
+    if (!ring.init(4)) return true;
+    std::filesystem::path runDir = dir / "failures";
+    std::filesystem::remove_all(runDir);
+    std::filesystem::create_directories(runDir);
+    std::vector<ShardFile> batch(24);
+    for (size_t i = 0; i < batch.size(); i++) {
+        batch[i].path = i % 5 == 1 ? std::filesystem::path("/dev/full") : runDir / ("Class" + std::to_string(i) + "_Offsets.cs");
+        batch[i].data = "class " + std::to_string(i) + "\n";
+    }
+    std::vector<const ShardFile*> failed;
+    ring.write(batch, failed);
+
+    bool ok = true;
+    for (const ShardFile& file : batch) {
+        bool expectFailure = file.path == "/dev/full";
+        if ((std::find(failed.begin(), failed.end(), &file) != failed.end()) != expectFailure) {
+            fprintf(stderr, "shardwriter: %s %s through io_uring\n", file.path.string().c_str(), expectFailure ? "didn't fail" : "failed");
+            ok = false;
+        }
+        MappedFile written;
+        if (!expectFailure && (!written.open(file.path) || written.view() != file.data)) {
+            fprintf(stderr, "shardwriter: %s doesn't hold what was written\n", file.path.string().c_str());
+            ok = false;
+        }
+    }
+    if (size_t open = ringFilesOpen(); open != 0) {
+        fprintf(stderr, "shardwriter: %zu files left open in the ring's slots\n", open);
+        ok = false;
+    }
+    std::filesystem::remove_all(runDir);
+    return ok;
+#else
+    (void)dir;
+    return true;
+#endif
+}
+
+//
+// shardwriter <dir> [file counts...] [--size <bytes>]: time to create that many small
+// files (default 10000, 50000 and 100000 of 400 bytes, about a class each) under
+// <dir> with blocking fopen/fwrite/fclose on one thread, with ShardWriter's thread
+// pool and, where the kernel has it, with ShardWriter on io_uring. Each run writes
+// into a fresh directory that is deleted afterwards, outside the timing. Before
+// that, where io_uring is available, checks that files whose write fails mid-batch
+// don't stop the ring writing the rest (exits 1 if they do).
+//
+static int benchShardWriter(int argc, char** argv) {
+    if (argc < 1) {
+        fprintf(stderr, "shardwriter: expected <dir> [file counts...] [--size <bytes>]\n");
+        return 2;
+    }
+    std::filesystem::path dir = argv[0];
+    std::vector<size_t> counts;
+    size_t size = 400;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--size") && i + 1 < argc) size = static_cast<size_t>(strtoull(argv[++i], nullptr, 10));
+        else counts.push_back(std::max<size_t>(1, static_cast<size_t>(strtoull(argv[i], nullptr, 10))));
+    }
+    if (counts.empty()) counts = { 10000, 50000, 100000 };
+
+    std::string content(size, ' ');
+    for (size_t i = 0; i < size; i++) content[i] = i % 64 == 63 ? '\n' : static_cast<char>('a' + i % 26);
+
+    // Helper function to time writing `count` files into a fresh directory with write(files)
+    auto timeRun = [&](const char* name, size_t count, auto&& write) {
+        std::filesystem::path runDir = dir / name;
+        std::filesystem::remove_all(runDir);
+        std::filesystem::create_directories(runDir);
+        std::vector<ShardFile> files(count);
+        for (size_t i = 0; i < count; i++) {
+            files[i].path = runDir / ("Class" + std::to_string(i) + "_Offsets.cs");
+            files[i].data = content;
+        }
+        auto start = std::chrono::steady_clock::now();
+        bool ok = write(files);
+        double ms = elapsedMs(start);
+        std::filesystem::remove_all(runDir);
+        printf("%-9s %7zu files %9.1f ms %10.0f files/s%s\n", name, count, ms, static_cast<double>(count) * 1000.0 / ms, ok ? "" : "   (some files failed)");
+    };
+
+    // Helper function to hand the files to a ShardWriter in batches, the way the sharded export does
+    auto writeSharded = [](std::vector<ShardFile>& files, ShardWriterBackend backend) {
+        ShardWriter writer(0, backend);
+        for (size_t begin = 0; begin < files.size(); begin += 64) {
+            size_t end = std::min(files.size(), begin + 64);
+            writer.write(std::vector<ShardFile>(std::make_move_iterator(files.begin() + static_cast<std::ptrdiff_t>(begin)),
+                                                std::make_move_iterator(files.begin() + static_cast<std::ptrdiff_t>(end))));
+        }
+        return writer.finish() == 0;
+    };
+
+    bool haveRing = ShardWriter(1, ShardWriterBackend::IoUring).backend() == ShardWriterBackend::IoUring;
+    if (haveRing && !checkRingWriteFailures(dir)) return 1;
+    for (size_t count : counts) {
+        timeRun("fopen", count, [&](std::vector<ShardFile>& files) {
+            bool ok = true;
+            for (const ShardFile& file : files) {
+                FILE* out = fopen(file.path.string().c_str(), "wb");
+                if (!out) {
+                    ok = false;
+                    continue;
+                }
+                ok = fwrite(file.data.data(), 1, file.data.size(), out) == file.data.size() && ok;
+                ok = fclose(out) == 0 && ok;
+            }
+            return ok;
+        });
+        timeRun("threads", count, [&](std::vector<ShardFile>& files) { return writeSharded(files, ShardWriterBackend::Threads); });
+        if (haveRing) timeRun("io_uring", count, [&](std::vector<ShardFile>& files) { return writeSharded(files, ShardWriterBackend::IoUring); });
+    }
+    if (!haveRing) printf("io_uring is not available here\n");
+    return 0;
+}
+
+// Helper function to restart the peak resident set size. Linux allows it through
+// clear_refs; elsewhere the peak is the process's since it started.
+static void resetPeakRss() {
+#ifdef __linux__
+    if (FILE* f = fopen("/proc/self/clear_refs", "w")) {
+        fputs("5", f);
+        fclose(f);
+    }
+#endif
+}
+
+// Peak resident set size in bytes, or 0 where it can't be read
+static size_t peakRss() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return counters.PeakWorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    size_t kb = 0;
+    if (FILE* f = fopen("/proc/self/status", "r")) {
+        char line[256];
+        while (fgets(line, sizeof(line), f)) {
+            if (!strncmp(line, "VmHWM:", 6)) kb = static_cast<size_t>(strtoull(line + 6, nullptr, 10));
+        }
+        fclose(f);
+    }
+    return kb * 1024;
+#else
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<size_t>(usage.ru_maxrss);
+#endif
+}
+
+// Helper function to read the current resident set size in bytes, or 0 where it can't be read
+static size_t currentRss() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return counters.WorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    size_t kb = 0;
+    if (FILE* f = fopen("/proc/self/status", "r")) {
+        char line[256];
+        while (fgets(line, sizeof(line), f)) {
+            if (!strncmp(line, "VmRSS:", 6)) kb = static_cast<size_t>(strtoull(line + 6, nullptr, 10));
+        }
+        fclose(f);
+    }
+    return kb * 1024;
+#else
+    return 0;
+#endif
+}
+
+static size_t countLines(std::string_view text) {
+    return static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + (!text.empty() && text.back() != '\n');
+}
+
+// Parses "10M", "100M", "1G" (also K and plain bytes); 0 if it isn't a size
+static size_t parseSize(const char* text) {
+    char* end = nullptr;
+    double value = strtod(text, &end);
+    if (end == text || value <= 0) return 0;
+    switch (*end) {
+    case 'k': case 'K': value *= 1024.0; end++; break;
+    case 'm': case 'M': value *= 1024.0 * 1024.0; end++; break;
+    case 'g': case 'G': value *= 1024.0 * 1024.0 * 1024.0; end++; break;
+    default: break;
+    }
+    if (*end == 'B' || *end == 'b') end++;
+    return *end ? 0 : static_cast<size_t>(value);
+}
+
+// One input of the pipeline benchmark
+struct PipelineInput {
+    std::string name;
+    std::string text;
+    size_t lines = 0;
+    size_t fieldLines = 0;
+};
+
+// What a benchmark case processes per iteration, for the rates
+struct PipelineWork {
+    size_t bytes = 0;
+    size_t lines = 0;
+    size_t fieldLines = 0;   // for the hardware counters
+};
+
+struct PipelineOptions {
+    double minTimeMs = 500;
+    size_t interactiveLimit = 16ull << 20;
+    std::vector<std::string> filters;
+    PerfCounters* counters = nullptr;   // null without hardware counters
+    size_t allocationSites = 0;         // call sites to print per case (debug builds)
+};
+
+static size_t countFieldLines(std::string_view text) {
+    size_t count = 0, pos = 0;
+    DumpField field;
+    while (pos < text.size()) {
+        size_t end = text.find('\n', pos);
+        if (end == std::string_view::npos) end = text.size();
+        count += parseFieldLine(text.substr(pos, end - pos), field);
+        pos = end + 1;
+    }
+    return count;
+}
+
+// Helper function to format a count with a k/M/G suffix
+static std::string formatCount(double value) {
+    char text[32];
+    if (value >= 1e9) snprintf(text, sizeof(text), "%.2fG", value / 1e9);
+    else if (value >= 1e6) snprintf(text, sizeof(text), "%.2fM", value / 1e6);
+    else if (value >= 1e4) snprintf(text, sizeof(text), "%.1fk", value / 1e3);
+    else snprintf(text, sizeof(text), "%.2f", value);
+    return text;
+}
+
+// Helper function to print the counters of `iterations` runs per input MB and per field line
+static void printCounters(const PerfSample& sample, PipelineWork work, size_t iterations) {
+    const double units[2] = {
+        static_cast<double>(work.bytes) * static_cast<double>(iterations) / (1024.0 * 1024.0),
+        static_cast<double>(work.fieldLines) * static_cast<double>(iterations),
+    };
+    const char* labels[2] = { "  per MB", "  per field line" };
+    for (int row = 0; row < 2; row++) {
+        if (units[row] <= 0) continue;
+        printf("%-36s", labels[row]);
+        for (size_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+            const PerfCounter counter = static_cast<PerfCounter>(i);
+            printf(" %s %s", perfCounterName(counter), sample.has(counter) ? formatCount(sample[counter] / units[row]).c_str() : "-");
+        }
+        if (row == 0 && sample.has(PerfCounter::Cycles) && sample.has(PerfCounter::Instructions) && sample[PerfCounter::Cycles] > 0) {
+            printf(" IPC %.2f", sample[PerfCounter::Instructions] / sample[PerfCounter::Cycles]);
+        }
+        printf("\n");
+    }
+}
+
+// Helper function to print where the most allocations since resetAllocationSites() came from
+static void printAllocationSites(size_t limit) {
+    if (!ALLOCATION_SITES_AVAILABLE) {
+        printf("  (allocation sites are only recorded in debug builds)\n");
+        return;
+    }
+    for (const AllocationSite& site : allocationSites(limit)) {
+        printf("  %10llu allocs ", static_cast<unsigned long long>(site.count));
+        for (size_t i = 0; i < ALLOCATION_SITE_FRAMES && site.frames[i]; i++) {
+            printf("%s%s", i ? " <- " : " ", describeCodeAddress(site.frames[i]).c_str());
+        }
+        printf("\n");
+    }
+}
+
+//
+// Google Benchmark style runner: one untimed warm-up iteration, then timed ones
+// until minTimeMs has passed. Allocations are counted over the timed iterations
+// only, so buffers that are reused from one iteration to the next don't count.
+// An `allocationFree` case fails if the timed iterations allocate at all; returns
+// false then.
+//
+static bool runPipelineCase(const PipelineOptions& options, const std::string& name, PipelineWork work, const std::function<void()>& iteration,
+                            bool allocationFree = false) {
+    if (!options.filters.empty()
+        && std::none_of(options.filters.begin(), options.filters.end(), [&](const std::string& f) { return name.find(f) != std::string::npos; })) {
+        return true;
+    }
+    resetPeakRss();
+    iteration();
+
+    size_t iterations = 0;
+    resetAllocationSites();
+    uint64_t allocations = allocationCount();
+    if (options.counters) options.counters->start();
+    auto start = std::chrono::steady_clock::now();
+    double ms = 0;
+    do {
+        iteration();
+        iterations++;
+        ms = elapsedMs(start);
+    } while (ms < options.minTimeMs);
+    PerfSample sample = options.counters ? options.counters->stop() : PerfSample();
+    allocations = allocationCount() - allocations;
+
+    double seconds = ms / 1000.0 / static_cast<double>(iterations);
+    double perLine = work.lines ? static_cast<double>(allocations) / static_cast<double>(iterations * work.lines) : 0.0;
+    printf("%-36s %10.3f ms %6zu %10.1f MB/s %10.3f M lines/s %10.4f allocs/line %8.1f MB peak\n",
+        name.c_str(), seconds * 1000.0, iterations,
+        static_cast<double>(work.bytes) / (1024.0 * 1024.0) / seconds,
+        static_cast<double>(work.lines) / 1e6 / seconds,
+        perLine, static_cast<double>(peakRss()) / (1024.0 * 1024.0));
+    if (options.counters) printCounters(sample, work, iterations);
+
+    bool failed = allocationFree && allocations != 0;
+    if (failed) printf("  FAILED: %llu allocations after warm-up, this path must not allocate per field\n", static_cast<unsigned long long>(allocations));
+    if (options.allocationSites || failed) printAllocationSites(options.allocationSites ? options.allocationSites : 5);
+    fflush(stdout);
+    return !failed;
+}
+
+//
+// pipeline [inputs...] [--example <dump>] [--seed <n>] [--min-time <ms>] [--interactive-limit <size>] [--filter <text>] [--no-counters] [--instrument <file>]
+//          [--allocation-sites <n>]:
+// the conversion paths on each input. An input is a dump file, "example" (default
+// "test file/example_txt") or a size ("10M", "100M", "1G") of dump for DumpGenerator
+// to make from --seed. Without inputs: example, 10M, 100M and 1G. Cases:
+//     offset_line      the selection path per line: parseOffsetLine() and the C# emitter
+//                      (class headers start a class, as they do there)
+//     field_line       the whole-file path per line: parseFieldLine() and the C# emitter
+// Both must not allocate once warmed up: the run fails (exit code 1) if they do,
+// printing the call sites of the allocations in debug builds.
+//     selection        formatSelection() over the input, as if it were all selected
+//     export           exportDumpAsSdk() streaming to the null device
+//     export_parallel  LazyDump::load() and exportDumpAsSdkParallelToString() on every core
+//     sdk_merge        checkClassExists() and removeExistingClass() on the input's SDK.cs
+//     sanitize         struct names through an IdentifierTable and field names through appendIdentifier()
+// The editor paths (offset_line, selection, sdk_merge) are skipped on
+// inputs over --interactive-limit (default 16M). Each line reports time per
+// iteration, iterations, MB/s and lines/s of input, allocations per input line
+// and peak RSS, then, where perf_event_open works, cycles, instructions, branch
+// misses and L1d/LLC misses per input MB and per field line. --instrument writes
+// the SdkCore stage report over every case (builds with SDKCORE_INSTRUMENT) as
+// Chrome trace events to a .trace.json file, JSON to a .json one, else a table.
+// --allocation-sites <n> prints the n call sites with the most allocations for
+// every case (debug builds).
+//
+static int benchPipeline(int argc, char** argv) {
+    PipelineOptions options;
+    std::string examplePath = "test file/example_txt";
+    DumpGeneratorOptions generator;
+    bool useCounters = true;
+    const char* instrumentPath = nullptr;
+    std::vector<const char*> inputArgs;
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "--example") && i + 1 < argc) examplePath = argv[++i];
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) generator.seed = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--min-time") && i + 1 < argc) options.minTimeMs = strtod(argv[++i], nullptr);
+        else if (!strcmp(argv[i], "--interactive-limit") && i + 1 < argc) options.interactiveLimit = parseSize(argv[++i]);
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) options.filters.push_back(argv[++i]);
+        else if (!strcmp(argv[i], "--no-counters")) useCounters = false;
+        else if (!strcmp(argv[i], "--instrument") && i + 1 < argc) instrumentPath = argv[++i];
+        else if (!strcmp(argv[i], "--allocation-sites") && i + 1 < argc) options.allocationSites = strtoull(argv[++i], nullptr, 10);
+        else inputArgs.push_back(argv[i]);
+    }
+
+    PerfCounters counters;
+    if (useCounters && counters.available()) options.counters = &counters;
+    else if (useCounters) fprintf(stderr, "pipeline: no hardware counters, timing only (%s)\n", counters.error().c_str());
+    if (instrumentPath && !INSTRUMENT_COMPILED_IN) fprintf(stderr, "pipeline: built without SDKCORE_INSTRUMENT, the --instrument report will be empty\n");
+
+    if (inputArgs.empty()) {
+        if (std::filesystem::exists(examplePath)) inputArgs.push_back("example");
+        else fprintf(stderr, "pipeline: %s not found, skipping it (run from the repository root or pass --example <dump>)\n", examplePath.c_str());
+        inputArgs.insert(inputArgs.end(), { "10M", "100M", "1G" });
+    }
+
+    const std::filesystem::path scratchDir = std::filesystem::temp_directory_path() / "SdkFormatterBench";
+    std::filesystem::create_directories(scratchDir);
+#ifdef _WIN32
+    const char* nullDevice = "NUL";
+#else
+    const char* nullDevice = "/dev/null";
+#endif
+
+    size_t allocatingCases = 0;
+    printf("%-36s %13s %6s %15s %19s %22s %13s\n", "Benchmark", "Time", "Iter", "Input", "Lines", "Allocations", "RSS");
+    for (const char* arg : inputArgs) {
+        PipelineInput input;
+        size_t size = parseSize(arg);
+        if (size) {
+            input.name = arg;
+            input.text = generateDump(generator, size);
+        }
+        else {
+            const char* path = strcmp(arg, "example") ? arg : examplePath.c_str();
+            MappedFile file;
+            if (!file.open(path)) {
+                fprintf(stderr, "Failed to read %s\n", path);
+                return 1;
+            }
+            input.name = std::filesystem::path(path).filename().string();
+            input.text.assign(file.view());
+        }
+        input.lines = countLines(input.text);
+        input.fieldLines = countFieldLines(input.text);
+        const PipelineWork work{ input.text.size(), input.lines, input.fieldLines };
+        const bool interactive = input.text.size() <= options.interactiveLimit;
+        auto caseName = [&](const char* name) { return std::string(name) + "/" + input.name; };
+
+        std::string out;
+        std::string line;
+        DumpField field;
+        DumpClassHeader header;
+        CSharpEmitter emitter;
+
+        if (interactive) {
+            allocatingCases += !runPipelineCase(options, caseName("offset_line"), work, [&] {
+                out.clear();
+                size_t pos = 0;
+                while (pos < input.text.size()) {
+                    size_t end = input.text.find('\n', pos);
+                    if (end == std::string::npos) end = input.text.size();
+                    line.assign(input.text, pos, end - pos);
+                    pos = end + 1;
+                    if (parseSelectionClassLine(line, header)) emitter.beginClass(out, header, "Class");
+                    else if (parseOffsetLine(line, field)) emitter.field(out, field);
+                    if (out.size() > (1 << 16)) out.clear();
+                }
+                benchSink = out.size();
+            }, true);
+        }
+
+        allocatingCases += !runPipelineCase(options, caseName("field_line"), work, [&] {
+            out.clear();
+            std::string_view text = input.text;
+            size_t pos = 0;
+            while (pos < text.size()) {
+                size_t end = text.find('\n', pos);
+                if (end == std::string_view::npos) end = text.size();
+                std::string_view view = text.substr(pos, end - pos);
+                pos = end + 1;
+                if (parseClassHeader(view, header)) emitter.beginClass(out, header, "Class");
+                else if (parseFieldLine(view, field)) emitter.field(out, field);
+                if (out.size() > (1 << 16)) out.clear();
+            }
+            benchSink = out.size();
+        }, true);
+
+        if (interactive) {
+            runPipelineCase(options, caseName("selection"), work, [&] {
+                std::string className;
+                int processedLines = 0;
+                benchSink = formatSelection(input.text, CSharpEmitter(), className, processedLines).size();
+            });
+        }
+
+        runPipelineCase(options, caseName("export"), work, [&] {
+            FILE* sink = fopen(nullDevice, "wb");
+            if (!sink) throw std::runtime_error("can't open the null device");
+            benchSink = exportDumpAsSdk(input.text, sink).fieldCount;
+            fclose(sink);
+        });
+
+        runPipelineCase(options, caseName("export_parallel"), work, [&] {
+            LazyDump dump;
+            dump.load(input.text);
+            benchSink = exportDumpAsSdkParallelToString(dump, out).fieldCount;
+        });
+        out = std::string();
+
+        if (interactive) {
+            // The input's own SDK.cs, and a few struct names spread through it to merge
+            std::filesystem::path basePath = scratchDir / "base_SDK.cs";
+            std::filesystem::path workPath = scratchDir / "custom_SDK.cs";
+            FILE* sdkFile = fopen(basePath.string().c_str(), "wb");
+            if (!sdkFile) throw std::runtime_error("can't write " + basePath.string());
+            exportDumpAsSdk(input.text, sdkFile);
+            fclose(sdkFile);
+
+            std::vector<std::string> structNames;
+            {
+                LazyDump dump;
+                dump.load(input.text);
+                IdentifierTable names;
+                for (size_t i = 0; i < 8 && dump.size(); i++) structNames.emplace_back(names.get(dump.span(i * dump.size() / 8).name));
+            }
+            MappedFile sdk;
+            sdk.open(basePath.string());
+            const PipelineWork sdkWork{ sdk.size(), countLines(sdk.view()), input.fieldLines };
+            sdk.close();
+
+            size_t next = 0;
+            runPipelineCase(options, caseName("sdk_merge"), sdkWork, [&] {
+                std::filesystem::copy_file(basePath, workPath, std::filesystem::copy_options::overwrite_existing);
+                const std::string& structName = structNames[next++ % structNames.size()];
+                size_t startLine = 0, endLine = 0;
+                if (checkClassExists(structName, workPath.string(), startLine, endLine)) removeExistingClass(structName, workPath.string());
+                benchSink = endLine;
+            });
+            std::filesystem::remove(basePath);
+            std::filesystem::remove(workPath);
+        }
+
+        {
+            // Up to 4M names from the input, so the largest inputs don't need gigabytes of views
+            std::vector<std::string_view> classNames, fieldNames;
+            std::string_view text = input.text;
+            size_t pos = 0;
+            while (pos < text.size() && classNames.size() + fieldNames.size() < (size_t(1) << 22)) {
+                size_t end = text.find('\n', pos);
+                if (end == std::string_view::npos) end = text.size();
+                std::string_view view = text.substr(pos, end - pos);
+                pos = end + 1;
+                if (parseClassHeader(view, header)) classNames.push_back(header.name);
+                else if (parseFieldLine(view, field)) fieldNames.push_back(field.name);
+            }
+            size_t nameBytes = 0;
+            for (std::string_view name : classNames) nameBytes += name.size();
+            for (std::string_view name : fieldNames) nameBytes += name.size();
+
+            runPipelineCase(options, caseName("sanitize"), { nameBytes, classNames.size() + fieldNames.size(), fieldNames.size() }, [&] {
+                IdentifierTable structNames;
+                for (std::string_view name : classNames) structNames.get(name);
+                out.clear();
+                for (std::string_view name : fieldNames) {
+                    appendIdentifier(out, name);
+                    if (out.size() > (1 << 16)) out.clear();
+                }
+                benchSink = structNames.size() + out.size();
+            });
+        }
+    }
+    std::filesystem::remove(scratchDir);
+
+    if (instrumentPath) {
+        std::string path = instrumentPath;
+        auto endsWith = [&](std::string_view suffix) { return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0; };
+        std::string report = endsWith(".trace.json") ? formatInstrumentTrace()
+                           : endsWith(".json")       ? formatInstrumentJson(collectInstrumentReport())
+                                                     : formatInstrumentText(collectInstrumentReport());
+        FILE* out = fopen(instrumentPath, "wb");
+        if (!out) {
+            fprintf(stderr, "Failed to write %s\n", instrumentPath);
+            return 1;
+        }
+        fwrite(report.data(), sizeof(char), report.size(), out);
+        fclose(out);
+    }
+
+    if (allocatingCases) {
+        fprintf(stderr, "pipeline: %zu case(s) allocated per field after warm-up\n", allocatingCases);
+        return 1;
+    }
+    return 0;
+}
+
+//
+// generator [size] [--threads <n>]: how fast DumpGenerator makes `size` bytes of
+// dump (default 1G), on one thread and on --threads (default every core). The
+// text is made in 64 MB pieces into the same buffer, as when writing a file.
+//
+static int benchGenerator(int argc, char** argv) {
+    size_t size = 1ull << 30;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = static_cast<unsigned>(strtoul(argv[++i], nullptr, 10));
+        else if (!(size = parseSize(argv[i]))) {
+            fprintf(stderr, "generator: '%s' is not a size\n", argv[i]);
+            return 2;
+        }
+    }
+
+    printf("%-10s %12s %12s %14s\n", "Threads", "Time", "GB/s", "Classes");
+    for (unsigned count : { 1u, threads }) {
+        DumpGeneratorOptions options;
+        options.threads = count;
+        DumpGenerator generator(options);
+        std::string text;
+        size_t made = 0;
+        auto start = std::chrono::steady_clock::now();
+        while (made < size) {
+            text.clear();
+            generator.generate(text, std::min<size_t>(size - made, 64ull << 20));
+            made += text.size();
+        }
+        double ms = elapsedMs(start);
+        printf("%-10u %9.1f ms %12.2f %14llu\n", count, ms, static_cast<double>(made) / ms / 1e6, static_cast<unsigned long long>(generator.classCount()));
+        if (threads == 1) break;
+    }
+    return 0;
+}
+
+// Helper function to make a random pattern in the syntax DfaRegex supports. Groups
+// that contain a repeat aren't repeated themselves, so std::regex's backtracking
+// stays fast. Sets `repeats` if the pattern contains a repeat.
+static std::string randomPattern(std::mt19937_64& rng, int depth, bool& repeats) {
+    static constexpr std::string_view literals = "abAB01_<>, ";
+    static constexpr const char* atoms[] = { ".", "\\.", "\\d", "\\w", "\\s", "\\W", "[ab]", "[^a.]", "[a-z]", "[<>,]", "\\x41", "\\u0061",
+        "[\\0]", "\\{", "}", "[[:alpha:]]", "[[:digit:]_]", "[^[:punct:]]", "[\\x30-\\x39]", "[\\0-\\x2F]" };
+    static constexpr const char* quantifiers[] = { "*", "+", "?", "*?", "{2}", "{0,}", "{1,2}", "{0,3}" };
+    auto pick = [&](size_t n) { return static_cast<size_t>(rng() % n); };
+
+    std::string pattern;
+    size_t alternatives = pick(4) == 0 ? 2 : 1;
+    for (size_t alternative = 0; alternative < alternatives; alternative++) {
+        if (alternative) pattern += '|';
+        size_t length = 1 + pick(4);
+        for (size_t i = 0; i < length; i++) {
+            size_t kind = pick(12);
+            if (kind == 0) {
+                pattern += '^';
+                continue;
+            }
+            if (kind == 1) {
+                pattern += '$';
+                continue;
+            }
+
+            std::string atom;
+            bool innerRepeats = false;
+            if (kind == 2 && depth < 2) atom = (pick(2) ? "(" : "(?:") + randomPattern(rng, depth + 1, innerRepeats) + ")";
+            else if (kind < 6) atom = atoms[pick(std::size(atoms))];
+            else atom = literals[pick(literals.size())];
+            pattern += atom;
+            if (!innerRepeats && pick(4) == 0) {
+                pattern += quantifiers[pick(std::size(quantifiers))];
+                repeats = true;
+            }
+            repeats |= innerRepeats;
+        }
+    }
+    return pattern;
+}
+
+// Helper function to make a short random text from the characters of type names, and a NUL
+static std::string randomText(std::mt19937_64& rng) {
+    static constexpr std::string_view chars("abcAB019_.<>, {}\0", 17);
+    std::string text(static_cast<size_t>(rng() % 12), ' ');
+    for (char& c : text) c = chars[static_cast<size_t>(rng() % chars.size())];
+    return text;
+}
+
+// Fields of a dump as the filter sees them
+struct RegexField {
+    std::string_view className;
+    std::string_view name;
+    std::string_view type;
+};
+
+// scanDump() visitor that collects every field with its class name
+struct RegexFieldCollector {
+    std::vector<RegexField>& fields;
+    std::string_view className;
+    void onClass(const DumpClassHeader& header) { className = header.name; }
+    void onField(const DumpField& field) { fields.push_back({ className, field.name, field.type }); }
+};
+
+//
+// regex [--seed <n>] [--patterns <n>] [--size <bytes>]: checks that DfaRegex finds
+// what std::regex_search (ECMAScript) finds, for --patterns (default 2000) random
+// patterns on random texts (counted repeats, (?:...), \x and \u escapes and
+// [[:alpha:]] classes included), that constructs it doesn't support such as \b and
+// backreferences throw, then that FieldFilter's ~ and !~ agree with
+// std::regex_search on the class names, field names and types of a generated dump
+// of --size (default 256K), and times both engines on those types. Disagreements are
+// printed and fail the run (exit code 1).
+//
+static int benchRegex(int argc, char** argv) {
+    uint64_t seed = 1;
+    size_t patterns = 2000;
+    size_t size = 256 << 10;
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--patterns") && i + 1 < argc) patterns = static_cast<size_t>(strtoull(argv[++i], nullptr, 10));
+        else if (!strcmp(argv[i], "--size") && i + 1 < argc && (size = parseSize(argv[i + 1]))) i++;
+        else {
+            fprintf(stderr, "regex: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    size_t mismatches = 0;
+    auto report = [&](const std::string& pattern, std::string_view text, bool dfa, bool expected) {
+        if (++mismatches <= 20) {
+            printf("MISMATCH \"%s\" on \"%.*s\": DfaRegex %s, std::regex %s\n", pattern.c_str(),
+                static_cast<int>(text.size()), text.data(), dfa ? "matches" : "doesn't match", expected ? "matches" : "doesn't");
+        }
+    };
+
+    // Random patterns, including anchors inside alternatives and groups
+    std::mt19937_64 rng(seed);
+    size_t searches = 0, skipped = 0;
+    for (size_t p = 0; p < patterns; p++) {
+        bool repeats = false;
+        std::string pattern = randomPattern(rng, 0, repeats);
+        DfaRegex dfa;
+        std::regex expected;
+        try {
+            expected = std::regex(pattern);
+        }
+        catch (const std::regex_error&) {
+            skipped++; // outside ECMAScript, e.g. a repeated anchor
+            continue;
+        }
+        try {
+            dfa = DfaRegex(pattern);
+        }
+        catch (const std::runtime_error& e) {
+            printf("MISMATCH \"%s\" compiles with std::regex but not DfaRegex: %s\n", pattern.c_str(), e.what());
+            mismatches++;
+            continue;
+        }
+        for (int t = 0; t < 24; t++) {
+            std::string text = randomText(rng);
+            bool found = dfa.search(text);
+            bool wanted = std::regex_search(text, expected);
+            if (found != wanted) report(pattern, text, found, wanted);
+            searches++;
+        }
+    }
+    printf("random:  %zu patterns, %zu searches, %zu patterns std::regex rejects\n", patterns - skipped, searches, skipped);
+
+    // Constructs outside what DfaRegex supports must throw, never be taken as literal text
+    static constexpr const char* unsupported[] = {
+        "\\bm_", "_\\B", "(?=a)", "(?!a)", "(a)\\1", "\\cA", "\\q", "\\00", "\\u00e9", "[[=a=]]", "[[.a.]]", "a{,2}", "[\\w-z]",
+    };
+    for (const char* pattern : unsupported) {
+        try {
+            DfaRegex dfa(pattern);
+            printf("MISMATCH \"%s\" should not compile\n", pattern);
+            mismatches++;
+        }
+        catch (const std::runtime_error&) {
+        }
+    }
+    printf("unsupported: %zu patterns rejected\n", std::size(unsupported));
+
+    // The filter's regex operators on the fields of a generated dump
+    DumpGeneratorOptions generator;
+    generator.seed = seed;
+    generator.threads = 1;
+    std::string dump = generateDump(generator, size);
+    std::vector<RegexField> fields;
+    RegexFieldCollector collector{ fields, {} };
+    scanDump(dump, collector);
+
+    static constexpr const char* filterPatterns[] = {
+        "^System\\.Action|^System\\.Func", "Action|Func$", "^EFT\\.", "List<", "\\[\\]$", "^Unity.*Object$",
+        "^(System|UnityEngine)\\.", "<.*>$", "^[A-Z]\\w*$", "k__BackingField$", "^_", "\\d$|^\\d",
+    };
+    static constexpr const char* operands[] = { "class", "name", "type" };
+    size_t evaluated = 0;
+    for (const char* pattern : filterPatterns) {
+        std::regex expected(pattern);
+        for (size_t operand = 0; operand < std::size(operands); operand++) {
+            for (bool negate : { false, true }) {
+                std::string expression = std::string(operands[operand]) + (negate ? " !~ \"" : " ~ \"") + pattern + "\"";
+                FieldFilter filter = FieldFilter::compile(expression);
+                for (const RegexField& field : fields) {
+                    DumpClassHeader header;
+                    header.name = field.className;
+                    DumpField dumpField;
+                    dumpField.name = field.name;
+                    dumpField.type = field.type;
+                    FieldFilter::ClassContext context;
+                    FieldFilter::ClassVerdict verdict = filter.beginClass(header, context);
+                    bool passed = verdict == FieldFilter::ClassVerdict::Accept
+                        || (verdict == FieldFilter::ClassVerdict::PerField && filter.acceptField(context, dumpField));
+                    std::string_view text = operand == 0 ? field.className : operand == 1 ? field.name : field.type;
+                    bool wanted = std::regex_search(text.begin(), text.end(), expected) != negate;
+                    if (passed != wanted) report(expression, text, passed, wanted);
+                    evaluated++;
+                }
+            }
+        }
+    }
+    printf("filter:  %zu expressions on %zu fields, %zu evaluations\n", std::size(filterPatterns) * std::size(operands) * 2, fields.size(), evaluated);
+
+    // Both engines over the types, the operand filters use most
+    for (const char* pattern : { "^System\\.Action|^System\\.Func", "Action|Func$" }) {
+        DfaRegex dfa(pattern);
+        std::regex expected(pattern);
+        size_t found = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (const RegexField& field : fields) found += dfa.search(field.type);
+        double dfaMs = elapsedMs(start);
+        start = std::chrono::steady_clock::now();
+        for (const RegexField& field : fields) found += std::regex_search(field.type.begin(), field.type.end(), expected);
+        double stdMs = elapsedMs(start);
+        benchSink = found;
+        printf("timing:  %-32s DfaRegex %8.2f ms, std::regex %8.2f ms\n", pattern, dfaMs, stdMs);
+    }
+
+    if (mismatches) {
+        printf("regex: %zu mismatches\n", mismatches);
+        return 1;
+    }
+    printf("regex: DfaRegex and FieldFilter agree with std::regex_search\n");
+    return 0;
+}
+
+// One output of the regression run, compared with a golden file and timed
+struct RegressionCase {
+    std::string name;      // baseline key, e.g. "example/export.cs"
+    std::string golden;    // golden file name; the parallel export shares the streaming one's
+    std::function<void(std::string& out)> run;
+    std::string skip = {}; // why the case can't run in this build, if it can't
+};
+
+// Outputs up to this size are kept verbatim as golden files, larger ones as a hash
+constexpr size_t GOLDEN_VERBATIM_LIMIT = 256 * 1024;
+
+// Helper function to run a streaming export into a string, through a temporary file
+static void exportToString(std::string_view dump, const SdkExportOptions& options, std::string& out) {
+    FILE* file = std::tmpfile();
+    if (!file) throw std::runtime_error("failed to create a temporary file");
+    exportDumpAsSdk(dump, file, options);
+    out.resize(static_cast<size_t>(ftell(file)));
+    rewind(file);
+    size_t read = fread(out.data(), sizeof(char), out.size(), file);
+    fclose(file);
+    if (read != out.size()) throw std::runtime_error("failed to read the exported output back");
+}
+
+// Helper function to print a column store's rows, or the selected ones, one field per
+// line the way the CLI's query command does
+static void renderColumns(const ColumnStore& columns, const uint32_t* selection, size_t count, std::string& out) {
+    char line[64];
+    for (size_t i = 0; i < count; i++) {
+        uint32_t row = selection ? selection[i] : static_cast<uint32_t>(i);
+        out += columns.strings.str(columns.classNames[columns.classId[row]]);
+        out += '.';
+        out += columns.strings.str(columns.nameId[row]);
+        snprintf(line, sizeof(line), " = 0x%llX [%c] // ", static_cast<unsigned long long>(columns.offset[row]),
+            fieldTagLetter(static_cast<FieldTag>(columns.tag[row])));
+        out += line;
+        out += columns.strings.str(columns.typeId[row]);
+        out += '\n';
+    }
+}
+
+// Helper function to run the select/refine kernels over a store and print what they
+// picked, each query headed by whether plain loops over the columns pick the same rows
+static void renderColumnQueries(const ColumnStore& columns, std::string& out) {
+    size_t count = columns.fieldCount();
+    if (count == 0) return;
+    std::vector<size_t> typeCounts(columns.strings.size());
+    for (uint32_t typeId : columns.typeId) typeCounts[typeId]++;
+    uint32_t type = static_cast<uint32_t>(std::max_element(typeCounts.begin(), typeCounts.end()) - typeCounts.begin());
+    uint8_t instance = static_cast<uint8_t>(FieldTag::Instance);
+    uint64_t lowOffset = columns.offset[count / 4];
+    uint64_t minOffset = columns.offset[count / 2];
+    std::vector<uint32_t> selection(count), scratch(count), expected;
+    auto report = [&](const char* query, size_t selected) {
+        bool same = selected == expected.size() && std::equal(expected.begin(), expected.end(), selection.begin());
+        char line[160];
+        snprintf(line, sizeof(line), "# %s: %zu rows, %s\n", query, selected, same ? "as the scalar loop" : "DIFFERENT from the scalar loop");
+        out += line;
+        renderColumns(columns, selection.data(), selected, out);
+    };
+
+    expected.clear();
+    for (uint32_t i = 0; i < count; i++) if (columns.typeId[i] == type) expected.push_back(i);
+    report("type == the most common type", selectEqual(columns.typeId.data(), count, type, selection.data()));
+
+    expected.clear();
+    for (uint32_t i = 0; i < count; i++) if (columns.tag[i] == instance) expected.push_back(i);
+    report("tag == I", selectEqual(columns.tag.data(), count, instance, selection.data()));
+
+    expected.clear();
+    for (uint32_t i = 0; i < count; i++) if (columns.offset[i] >= minOffset) expected.push_back(i);
+    report("offset >= middle field's offset", selectAtLeast(columns.offset.data(), count, minOffset, selection.data()));
+
+    // The same selections chained, narrowing the previous one each time
+    expected.clear();
+    for (uint32_t i = 0; i < count; i++) {
+        if (columns.offset[i] >= lowOffset && columns.tag[i] == instance && columns.typeId[i] == type && columns.offset[i] >= minOffset) expected.push_back(i);
+    }
+    size_t selected = selectAtLeast(columns.offset.data(), count, lowOffset, selection.data());
+    selected = refineEqual(columns.tag.data(), selection.data(), selected, instance, scratch.data());
+    selection.swap(scratch);
+    selected = refineEqual(columns.typeId.data(), selection.data(), selected, type, scratch.data());
+    selection.swap(scratch);
+    selected = refineAtLeast(columns.offset.data(), selection.data(), selected, minOffset, scratch.data());
+    selection.swap(scratch);
+    report("offset >= a quarter's, then tag, type and offset as above", selected);
+}
+
+static bool readWholeFile(const std::filesystem::path& path, std::string& out) {
+    MappedFile file;
+    if (!file.open(path)) return false;
+    out.assign(file.view());
+    return true;
+}
+
+// Helper function to compare an output with its golden file ("<name>" verbatim or
+// "<name>.hash" holding size and hash); returns "" if they match, else what differs
+static std::string compareGolden(const std::filesystem::path& dir, const std::string& golden, std::string_view actual) {
+    std::string expected;
+    if (readWholeFile(dir / golden, expected)) {
+        if (expected == actual) return "";
+        size_t at = static_cast<size_t>(std::mismatch(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(std::min(expected.size(), actual.size())), actual.begin()).first - expected.begin());
+        size_t line = 1 + static_cast<size_t>(std::count(actual.begin(), actual.begin() + static_cast<std::ptrdiff_t>(at), '\n'));
+        char text[160];
+        snprintf(text, sizeof(text), "differs from %s at byte %zu (line %zu); %zu bytes, expected %zu", golden.c_str(), at, line, actual.size(), expected.size());
+        return text;
+    }
+    if (readWholeFile(dir / (golden + ".hash"), expected)) {
+        unsigned long long size = 0, hash = 0;
+        if (sscanf(expected.c_str(), "%llu %llx", &size, &hash) != 2) return golden + ".hash is not \"<size> <hash>\"";
+        if (size == actual.size() && hash == hashString(actual)) return "";
+        char text[160];
+        snprintf(text, sizeof(text), "differs from %s.hash; %zu bytes, expected %llu", golden.c_str(), actual.size(), size);
+        return text;
+    }
+    return "no golden file " + (dir / golden).string() + " (run with --update-golden)";
+}
+
+static bool updateGolden(const std::filesystem::path& dir, const std::string& golden, std::string_view actual) {
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    std::filesystem::remove(dir / golden, error);
+    std::filesystem::remove(dir / (golden + ".hash"), error);
+    if (actual.size() <= GOLDEN_VERBATIM_LIMIT) return writeWholeFile(dir / golden, actual);
+    char text[64];
+    snprintf(text, sizeof(text), "%zu %016llx\n", actual.size(), static_cast<unsigned long long>(hashString(actual)));
+    return writeWholeFile(dir / (golden + ".hash"), text);
+}
+
+//
+// Reads the "ms" of every case from a baseline written by writeBaseline(). Not a
+// general JSON parser: each "ms" belongs to the key of the object it is in.
+//
+static std::unordered_map<std::string, double> readBaseline(const std::filesystem::path& path) {
+    std::unordered_map<std::string, double> baseline;
+    std::string text;
+    if (!readWholeFile(path, text)) return baseline;
+    for (size_t at = text.find("\"ms\""); at != std::string::npos; at = text.find("\"ms\"", at + 4)) {
+        size_t open = text.rfind('{', at);
+        size_t keyEnd = open == std::string::npos ? std::string::npos : text.rfind('"', open);
+        size_t keyStart = keyEnd == std::string::npos || keyEnd == 0 ? std::string::npos : text.rfind('"', keyEnd - 1);
+        size_t colon = text.find(':', at + 4);
+        if (keyStart == std::string::npos || colon == std::string::npos) continue;
+        baseline[text.substr(keyStart + 1, keyEnd - keyStart - 1)] = strtod(text.c_str() + colon + 1, nullptr);
+    }
+    return baseline;
+}
+
+static bool writeBaseline(const std::filesystem::path& path, const std::vector<std::pair<std::string, double>>& timings) {
+    std::string text = "{\n  \"cases\": {\n";
+    for (size_t i = 0; i < timings.size(); i++) {
+        char line[256];
+        snprintf(line, sizeof(line), "    \"%s\": { \"ms\": %.4f }%s\n", timings[i].first.c_str(), timings[i].second, i + 1 < timings.size() ? "," : "");
+        text += line;
+    }
+    text += "  }\n}\n";
+    return writeWholeFile(path, text);
+}
+
+//
+// regression [--golden <dir>] [--baseline <file>] [--tolerance <fraction>] [--min-time <ms>]
+//            [--example <dump>] [--filter <text>] [--update-golden] [--update-baseline] [--no-timing]
+//            [--require-codecs]:
+// converts the example dump and two generated 4 MB dumps (plain, and with
+// duplicate classes and malformed lines) through the streaming and parallel
+// exports in every language and through the selection path, and into the column
+// store (filled on its own and by both exports, which must agree, then queried
+// with the select/refine kernels checked against plain loops), plus the gzip,
+// zstd and xz copies of the example dump ("<dump>.gz", ".zst", ".xz") through
+// the streaming export, which must give the example's outputs. A codec the
+// build lacks is skipped, or fails the run with --require-codecs. It checks each
+// output byte for byte against the golden files in --golden (default
+// "test file/golden"). Small outputs are stored verbatim, larger ones as
+// "<size> <hash>" in a .hash file. Each case is then timed (fastest of the runs
+// within --min-time, default 300 ms) and compared with --baseline (default
+// regression-baseline.json in the working directory, local to the machine):
+// more than --tolerance (default 0.15) slower fails. Exits 1 on any failure.
+// --update-golden and --update-baseline rewrite the files from this run instead.
+//
+static int benchRegression(int argc, char** argv) {
+    std::filesystem::path goldenDir = "test file/golden";
+    std::filesystem::path baselinePath = "regression-baseline.json";
+    std::string examplePath = "test file/example_txt";
+    double tolerance = 0.15;
+    double minTimeMs = 300;
+    bool updateGoldens = false, updateTimings = false, timing = true, requireCodecs = false;
+    std::vector<std::string> filters;
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "--golden") && i + 1 < argc) goldenDir = argv[++i];
+        else if (!strcmp(argv[i], "--baseline") && i + 1 < argc) baselinePath = argv[++i];
+        else if (!strcmp(argv[i], "--example") && i + 1 < argc) examplePath = argv[++i];
+        else if (!strcmp(argv[i], "--tolerance") && i + 1 < argc) tolerance = strtod(argv[++i], nullptr);
+        else if (!strcmp(argv[i], "--min-time") && i + 1 < argc) minTimeMs = strtod(argv[++i], nullptr);
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) filters.push_back(argv[++i]);
+        else if (!strcmp(argv[i], "--update-golden")) updateGoldens = true;
+        else if (!strcmp(argv[i], "--update-baseline")) updateTimings = true;
+        else if (!strcmp(argv[i], "--no-timing")) timing = false;
+        else if (!strcmp(argv[i], "--require-codecs")) requireCodecs = true;
+        else {
+            fprintf(stderr, "regression: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    // The corpora: the example dump and generated ones, which are the same for the same options
+    std::vector<std::pair<std::string, std::string>> corpora;
+    std::string example;
+    if (!readWholeFile(examplePath, example)) {
+        fprintf(stderr, "regression: failed to read %s (run from the repository root or pass --example <dump>)\n", examplePath.c_str());
+        return 2;
+    }
+    corpora.emplace_back("example", std::move(example));
+    DumpGeneratorOptions plain;
+    plain.seed = 1;
+    corpora.emplace_back("synthetic", generateDump(plain, 4u << 20));
+    DumpGeneratorOptions messy;
+    messy.seed = 2;
+    messy.duplicateRate = 0.02;
+    messy.malformedRate = 0.002;
+    corpora.emplace_back("synthetic_messy", generateDump(messy, 4u << 20));
+
+    std::vector<RegressionCase> cases;
+    const SdkLanguage languages[] = { SdkLanguage::CSharp, SdkLanguage::Cpp, SdkLanguage::Rust, SdkLanguage::Ndjson, SdkLanguage::OffsetsDb };
+    for (const auto& [corpus, text] : corpora) {
+        std::string_view dump = text;
+        for (SdkLanguage language : languages) {
+            SdkExportOptions options;
+            options.language = language;
+            std::string golden = corpus + ".export" + sdkFileExtension(language);
+            cases.push_back({ corpus + "/export" + sdkFileExtension(language), golden, [dump, options](std::string& out) {
+                exportToString(dump, options, out);
+            } });
+            cases.push_back({ corpus + "/export_parallel" + sdkFileExtension(language), golden, [dump, options](std::string& out) {
+                LazyDump lazy;
+                lazy.load(dump);
+                exportDumpAsSdkParallelToString(lazy, out, options);
+            } });
+        }
+        cases.push_back({ corpus + "/selection.cs", corpus + ".selection.cs", [&text](std::string& out) {
+            std::string className;
+            int processedLines = 0;
+            out = formatSelection(text, CSharpEmitter(), className, processedLines);
+        } });
+
+        // The column store filled on its own and by both exports must hold the same rows
+        cases.push_back({ corpus + "/columns", corpus + ".columns.txt", [dump](std::string& out) {
+            ColumnStore columns;
+            ColumnStoreBuilder builder(columns);
+            scanAnyDump(dump, builder);
+            out.clear();
+            renderColumns(columns, nullptr, columns.fieldCount(), out);
+        } });
+        for (const char* filter : { "", "tag != C && offset >= 0x20" }) {
+            std::string name = corpus + (*filter ? "/columns_filtered" : "/columns");
+            std::string golden = corpus + (*filter ? ".columns_filtered.txt" : ".columns.txt");
+            cases.push_back({ name + "_export", golden, [dump, filter](std::string& out) {
+                FieldFilter fieldFilter = FieldFilter::compile(filter);
+                ColumnStore columns;
+                SdkExportOptions options;
+                options.filter = &fieldFilter;
+                options.columns = &columns;
+                exportToString(dump, options, out);
+                out.clear();
+                renderColumns(columns, nullptr, columns.fieldCount(), out);
+            } });
+            cases.push_back({ name + "_parallel", golden, [dump, filter](std::string& out) {
+                FieldFilter fieldFilter = FieldFilter::compile(filter);
+                ColumnStore columns;
+                SdkExportOptions options;
+                options.filter = &fieldFilter;
+                options.columns = &columns;
+                LazyDump lazy;
+                lazy.load(dump);
+                exportDumpAsSdkParallelToString(lazy, out, options);
+                out.clear();
+                renderColumns(columns, nullptr, columns.fieldCount(), out);
+            } });
+        }
+        cases.push_back({ corpus + "/column_queries", corpus + ".column_queries.txt", [dump](std::string& out) {
+            ColumnStore columns;
+            ColumnStoreBuilder builder(columns);
+            scanAnyDump(dump, builder);
+            out.clear();
+            renderColumnQueries(columns, out);
+        } });
+    }
+
+    // The compressed copies of the example dump, decompressed while they are parsed
+    static constexpr std::pair<DumpCompression, const char*> codecs[] = {
+        { DumpCompression::Gzip, ".gz" }, { DumpCompression::Zstd, ".zst" }, { DumpCompression::Xz, ".xz" },
+    };
+    std::vector<std::string> compressedCopies(std::size(codecs));
+    for (size_t c = 0; c < std::size(codecs); c++) {
+        DumpCompression compression = codecs[c].first;
+        std::string copyPath = examplePath + codecs[c].second;
+        std::string skip;
+        if (!dumpCompressionSupported(compression)) skip = std::string("skipped: built without ") + dumpCompressionName(compression);
+        else if (!readWholeFile(copyPath, compressedCopies[c])) skip = "skipped: no " + copyPath;
+        else if (sniffDumpCompression(compressedCopies[c]) != compression) skip = "skipped: " + copyPath + " isn't " + dumpCompressionName(compression);
+        if (!skip.empty() && requireCodecs) {
+            fprintf(stderr, "regression: %s, and --require-codecs was given\n", skip.substr(strlen("skipped: ")).c_str());
+            return 1;
+        }
+
+        std::string_view dump = compressedCopies[c];
+        for (SdkLanguage language : languages) {
+            SdkExportOptions options;
+            options.language = language;
+            std::string name = std::string("example/export_") + dumpCompressionName(compression) + sdkFileExtension(language);
+            cases.push_back({ name, std::string("example.export") + sdkFileExtension(language), [dump, options](std::string& out) {
+                exportToString(dump, options, out);
+            }, skip });
+        }
+    }
+
+    std::unordered_map<std::string, double> baseline = timing ? readBaseline(baselinePath) : std::unordered_map<std::string, double>();
+    if (timing && baseline.empty() && !updateTimings) {
+        fprintf(stderr, "regression: no baseline in %s, timings are not compared (run with --update-baseline)\n", baselinePath.string().c_str());
+    }
+
+    size_t failures = 0;
+    std::set<std::string> updatedGoldens;
+    std::vector<std::pair<std::string, double>> timings;
+    std::string out;
+    printf("%-44s %12s %12s %9s  %s\n", "Case", "Time", "Baseline", "Change", "Output");
+    for (const RegressionCase& test : cases) {
+        if (!filters.empty() && std::none_of(filters.begin(), filters.end(), [&](const std::string& f) { return test.name.find(f) != std::string::npos; })) {
+            continue;
+        }
+        if (!test.skip.empty()) {
+            printf("%-44s %12s %12s %9s  %s\n", test.name.c_str(), "-", "-", "-", test.skip.c_str());
+            continue;
+        }
+
+        // The first run is checked and doubles as the warm-up
+        test.run(out);
+        std::string outputResult = "ok";
+        // A golden file shared by several cases is written by the first and checked by the rest
+        if (updateGoldens && updatedGoldens.insert(test.golden).second) {
+            if (!updateGolden(goldenDir, test.golden, out)) {
+                fprintf(stderr, "regression: failed to write the golden file for %s\n", test.name.c_str());
+                return 1;
+            }
+            outputResult = "updated";
+        }
+        else if (std::string difference = compareGolden(goldenDir, test.golden, out); !difference.empty()) {
+            outputResult = "FAIL: " + difference;
+            failures++;
+        }
+
+        if (!timing) {
+            printf("%-44s %12s %12s %9s  %s\n", test.name.c_str(), "-", "-", "-", outputResult.c_str());
+            continue;
+        }
+        // The fastest run, as the others only add noise from the rest of the machine
+        auto measure = [&](double best) {
+            size_t runs = 0;
+            auto start = std::chrono::steady_clock::now();
+            do {
+                auto runStart = std::chrono::steady_clock::now();
+                test.run(out);
+                double ms = elapsedMs(runStart);
+                best = best > 0 ? std::min(best, ms) : ms;
+                runs++;
+            } while (runs < 5 || elapsedMs(start) < minTimeMs);
+            return best;
+        };
+        double best = measure(0);
+
+        auto reference = baseline.find(test.name);
+        if (reference == baseline.end() || reference->second <= 0) {
+            timings.emplace_back(test.name, best);
+            printf("%-44s %9.3f ms %12s %9s  %s\n", test.name.c_str(), best, "-", "-", outputResult.c_str());
+            continue;
+        }
+        // A case that looks slower gets a second chance, so one busy moment doesn't fail the run
+        if (!updateTimings && best > reference->second * (1.0 + tolerance)) best = measure(best);
+        timings.emplace_back(test.name, best);
+        double change = best / reference->second - 1.0;
+        bool slower = !updateTimings && change > tolerance;
+        printf("%-44s %9.3f ms %9.3f ms %+8.1f%%  %s%s\n", test.name.c_str(), best, reference->second, change * 100.0, outputResult.c_str(),
+            slower ? "; FAIL: slower than the baseline allows" : "");
+        failures += slower;
+    }
+
+    if (updateTimings) {
+        if (!writeBaseline(baselinePath, timings)) {
+            fprintf(stderr, "regression: failed to write %s\n", baselinePath.string().c_str());
+            return 1;
+        }
+        printf("baseline written to %s\n", baselinePath.string().c_str());
+    }
+    fflush(stdout);
+    if (failures) {
+        fprintf(stderr, "regression: %zu failure(s); outputs must match the golden files and be no more than %.0f%% slower than the baseline\n",
+            failures, tolerance * 100.0);
+        return 1;
+    }
+    printf("regression: all %s\n", updateGoldens ? "golden files updated" : "outputs match");
+    return 0;
+}
+
+//
+// commands <dir> [dump.txt|size] [--iterations <n>] [--seed <n>]: the plugin's
+// commands end to end through MemoryEditorHost, as Notepad++ runs them, with the
+// wall-clock of every run the way the user sees it. "Export Selection to Master
+// SDK" selects one class after another (default 500 times) and in the last
+// quarter comes back to classes it has already exported, which replaces them;
+// custom_SDK.cs must then hold each selected class once and close its namespace.
+// The other commands run on the whole dump (default the example, or a generated
+// one of `size`) a tenth as often, and the export of the entire file is cancelled
+// once, which must remove its output. A command that reports an error fails the run.
+// <dir> is emptied first and keeps the outputs. "Peak extra" is the most memory a
+// run of the command added on top of what the process held when it started;
+// on Linux the peak restarts every run, elsewhere it is the process's since it
+// started. --no-direct-access makes the host refuse the in-place view of the
+// document, so the commands read it in windows as from an editor that can't
+// share its buffer.
+//
+static int benchCommands(int argc, char** argv) {
+    if (argc < 1) {
+        fprintf(stderr, "commands: expected <dir> [dump.txt|size] [--iterations <n>] [--seed <n>] [--no-direct-access]\n");
+        return 2;
+    }
+    std::filesystem::path dir = argv[0];
+    std::string input = "test file/example_txt";
+    size_t iterations = 500;
+    bool directAccess = true;
+    DumpGeneratorOptions generated;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iterations") && i + 1 < argc) iterations = std::max<size_t>(1, static_cast<size_t>(strtoull(argv[++i], nullptr, 10)));
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) generated.seed = strtoull(argv[++i], nullptr, 10);
+        else if (!strcmp(argv[i], "--no-direct-access")) directAccess = false;
+        else input = argv[i];
+    }
+
+    std::string dump;
+    if (size_t size = parseSize(input.c_str())) {
+        dump = generateDump(generated, size);
+    }
+    else if (!readWholeFile(input, dump)) {
+        fprintf(stderr, "commands: failed to read %s\n", input.c_str());
+        return 2;
+    }
+
+    // The classes to select: whole class blocks that have fields, with the struct names they get
+    struct Selection {
+        std::string name;
+        std::string structName;
+        std::string text;
+    };
+    std::vector<Selection> selections;
+    size_t distinct = iterations - iterations / 4;
+    ClassIndex index;
+    index.build(dump);
+    for (const ClassSpan& span : index.byName()) {
+        if (selections.size() == distinct) break;
+        Selection selection{ std::string(span.name), {}, dump.substr(span.begin, span.end - span.begin) };
+        int fields = 0;
+        formatSelection(selection.text, CSharpEmitter(), selection.structName, fields);
+        if (fields > 0) selections.push_back(std::move(selection));
+    }
+    if (selections.empty()) {
+        fprintf(stderr, "commands: %s has no class with fields\n", input.c_str());
+        return 2;
+    }
+    distinct = selections.size();
+
+    std::error_code error;
+    std::filesystem::remove_all(dir, error);
+    std::filesystem::create_directories(dir);
+    // The host holds the only copy of the dump, as the editor would
+    size_t dumpSize = dump.size();
+    MemoryEditorHost host;
+    host.document = std::move(dump);
+    host.directAccess = directAccess;
+    host.directory = dir;
+    host.settingsFile = dir / "SdkFormatter.ini";
+
+    struct CommandTimes {
+        const char* name;
+        std::vector<double> ms;
+        size_t peakExtra = 0;
+    };
+    std::vector<CommandTimes> commands;
+    // Helper function to run and time a command; false if it reported an error
+    auto run = [&](const char* name, void (*command)(EditorHost&)) {
+        if (commands.empty() || strcmp(commands.back().name, name)) commands.push_back({ name, {} });
+        host.clearLog();
+        resetPeakRss();
+        size_t rssBefore = currentRss();
+        auto start = std::chrono::steady_clock::now();
+        command(host);
+        commands.back().ms.push_back(elapsedMs(start));
+        size_t peak = peakRss();
+        if (peak > rssBefore) commands.back().peakExtra = std::max(commands.back().peakExtra, peak - rssBefore);
+        for (const std::string& message : host.errors) fprintf(stderr, "commands: %s: %s\n", name, message.c_str());
+        return host.errors.empty();
+    };
+
+    for (size_t i = 0; i < iterations; i++) {
+        host.selectedText = selections[i % distinct].text;
+        if (!run("Export Selection to Master SDK", exportToMasterSDK)) return 1;
+    }
+
+    // Every selected class once, in a file that still closes its namespace
+    std::string sdkPath = (dir / "custom_SDK.cs").string();
+    std::string sdk;
+    readWholeFile(sdkPath, sdk);
+    std::set<std::string> structNames;
+    for (const Selection& selection : selections) structNames.insert(selection.structName);
+    size_t structs = 0;
+    for (size_t pos = 0; (pos = sdk.find("public readonly partial struct ", pos)) != std::string::npos; pos++) structs++;
+    bool sdkOk = hasProperNamespaceClosure(sdkPath) && structs == structNames.size();
+    for (const std::string& name : structNames) {
+        size_t startLine = 0, endLine = 0;
+        sdkOk = sdkOk && checkClassExists(name, sdkPath, startLine, endLine);
+    }
+    if (!sdkOk) {
+        fprintf(stderr, "commands: custom_SDK.cs should close its namespace and hold %zu classes once each, it holds %zu\n", structNames.size(), structs);
+        return 1;
+    }
+
+    size_t wholeFileRuns = std::max<size_t>(1, iterations / 10);
+    host.folder = dir / "classes";
+    for (size_t i = 0; i < wholeFileRuns; i++) {
+        const Selection& selection = selections[i % distinct];
+        host.selectedText = selection.text;
+        if (!run("Export Selection as Individual File", exportAsIndividualFile)) return 1;
+    }
+    for (size_t i = 0; i < wholeFileRuns; i++) {
+        host.selectedText = selections[i % distinct].name;
+        if (!run("Export Classes Matching Selection", exportMatchingClasses)) return 1;
+    }
+    for (size_t i = 0; i < wholeFileRuns; i++) {
+        if (!run("Export Entire File to SDK", exportEntireFileToSDK)) return 1;
+    }
+    // A cancelled export says so and leaves the previous custom_SDK.cs as it was
+    std::string previousSdk, cancelledSdk;
+    readWholeFile(sdkPath, previousSdk);
+    host.cancelJobs = true;
+    bool cancelled = run("Export Entire File to SDK, cancelled", exportEntireFileToSDK);
+    host.cancelJobs = false;
+    readWholeFile(sdkPath, cancelledSdk);
+    if (!cancelled || host.messages.size() != 1 || host.messages[0].find("cancelled") == std::string::npos
+        || previousSdk.empty() || cancelledSdk != previousSdk || std::filesystem::exists(sdkPath + ".tmp")) {
+        fprintf(stderr, "commands: a cancelled export should report it and leave the previous custom_SDK.cs untouched\n");
+        return 1;
+    }
+    for (size_t i = 0; i < wholeFileRuns; i++) {
+        if (!run("Export Entire File as Individual Files", exportEntireFileAsShards)) return 1;
+    }
+
+    printf("%zu bytes of dump, %zu classes selected%s\n", dumpSize, distinct, directAccess ? "" : ", read in windows");
+    printf("%-44s %6s %12s %12s %12s %12s %12s\n", "Command", "Runs", "Fastest", "Median", "99%", "Slowest", "Peak extra");
+    for (CommandTimes& command : commands) {
+        std::sort(command.ms.begin(), command.ms.end());
+        size_t n = command.ms.size();
+        printf("%-44s %6zu %9.3f ms %9.3f ms %9.3f ms %9.3f ms %9.1f MB\n", command.name, n, command.ms[0], command.ms[n / 2],
+            command.ms[std::min(n - 1, n * 99 / 100)], command.ms[n - 1], static_cast<double>(command.peakExtra) / (1024.0 * 1024.0));
+    }
+    return 0;
+}
+
+struct Benchmark {
+    const char* name;
+    const char* usage;
+    int (*run)(int argc, char** argv);
+};
+
+static const Benchmark benchmarks[] = {
+    { "pipeline", "[inputs...] [--example <dump>] [--seed <n>] [--min-time <ms>] [--interactive-limit <size>] [--filter <text>] [--no-counters] [--instrument <file>] [--allocation-sites <n>]", benchPipeline },
+    { "generator", "[size] [--threads <n>]", benchGenerator },
+    { "offsetsdb", "<SDK.cs> <file.sdkdb> [lookups]", benchOffsetsDb },
+    { "shardwriter", "<dir> [file counts...] [--size <bytes>]", benchShardWriter },
+    { "regex", "[--seed <n>] [--patterns <n>] [--size <bytes>]", benchRegex },
+    { "commands", "<dir> [dump.txt|size] [--iterations <n>] [--seed <n>] [--no-direct-access]", benchCommands },
+    { "regression", "[--golden <dir>] [--baseline <file>] [--tolerance <fraction>] [--min-time <ms>] [--example <dump>] [--filter <text>] [--update-golden] [--update-baseline] [--no-timing] [--require-codecs]", benchRegression },
+};
+
+int main(int argc, char** argv) {
+    setInstrumentAllocationCounter(threadAllocationCount);
+    if (argc >= 2) {
+        for (const Benchmark& benchmark : benchmarks) {
+            if (!strcmp(argv[1], benchmark.name)) return benchmark.run(argc - 2, argv + 2);
+        }
+    }
+
+    fprintf(stderr, "usage: SdkFormatterBench <benchmark> [args...]\n\nbenchmarks:\n");
+    for (const Benchmark& benchmark : benchmarks) fprintf(stderr, "  %s %s\n", benchmark.name, benchmark.usage);
+    return 2;
+}
@@ -0,0 +1,941 @@
+//this file is part of notepad++
+//Copyright (C)2022 Don HO <don.h@free.fr>
+//
+//This program is free software; you can redistribute it and/or
+//modify it under the terms of the GNU General Public License
+//as published by the Free Software Foundation; either
+//version 2 of the License, or (at your option) any later version.
+//
+//This program is distributed in the hope that it will be useful,
+//but WITHOUT ANY WARRANTY; without even the implied warranty of
+//MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//GNU General Public License for more details.
+//
+//You should have received a copy of the GNU General Public License
+//along with this program; if not, write to the Free Software
+//Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+
+//
+// Command line front end for the SdkCore converter, so dumps can be processed
+// without Notepad++ (and on Linux).
+//
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+#include "SdkCore/ColumnStore.h"
+#include "SdkCore/CompressedDump.h"
+#include "SdkCore/DumpGenerator.h"
+#include "SdkCore/ExportJob.h"
+#include "SdkCore/FieldFilter.h"
+#include "SdkCore/Instrument.h"
+#include "SdkCore/LazyDump.h"
+#include "SdkCore/MappedFile.h"
+#include "SdkCore/OffsetsDb.h"
+#include "SdkCore/SdkExport.h"
+#include "SdkCore/SidecarIndex.h"
+#include "SdkCore/TextEncoding.h"
+
+static void printUsage() {
+    fprintf(stderr,
+        "usage: SdkFormatterCli <command> <dump.txt> [options]\n"
+        "\n"
+        "dump.txt may be UTF-8 or UTF-16 and gzip, zstd or xz compressed (when built\n"
+        "with the codec)\n"
+        "\n"
+        "every command also takes:\n"
+        "  --instrument <file|->       write time per stage and line/class counts to a file\n"
+        "                              or stderr (builds with SDKCORE_INSTRUMENT defined)\n"
+        "  --instrument-format <text|json|trace> table, JSON, or Chrome trace events for\n"
+        "                              chrome://tracing (default: from the file name,\n"
+        "                              .trace.json or .json, else text)\n"
+        "\n"
+        "commands:\n"
+        "  export   convert the whole dump to Lone SDK.cs format\n"
+        "             -o <file>         output path (default: custom_SDK.<ext> next to the dump);\n"
+        "                               repeat to write several outputs from a single parse\n"
+        "             --lang <cs|cpp|rust|db|json> C# structs, C++ constexpr header, Rust\n"
+        "                               consts, binary offsets database or NDJSON (default:\n"
+        "                               from the output's extension, else cs)\n"
+        "             --filter <expr>   keep only matching fields/classes, e.g.\n"
+        "                               'tag != C && class ~ \"^EFT\\.\"'\n"
+        "             --template <file> custom format, see README (key = value lines)\n"
+        "             --lang, --template and --filter after an -o apply to that output only\n"
+        "             --classes <glob>  only export classes matching the glob (repeatable),\n"
+        "                               e.g. 'EFT.InventoryLogic.*'\n"
+        "             --threads <n>     workers for a single whole-dump output (default: one per\n"
+        "                               core; 1 streams the output instead)\n"
+        "             --progress        print bytes and classes done and the time left to\n"
+        "                               stderr a few times a second; Ctrl+C cancels the\n"
+        "                               export and keeps the previous outputs\n"
+        "  shard    write each class to a file of its own, <Class>_Offsets.cs\n"
+        "             -o <dir>          output directory (default: SDK next to the dump)\n"
+        "             --by-namespace    one directory per namespace, e.g. EFT/Player_Offsets.cs\n"
+        "             --lang, --template, --filter and --classes as for export\n"
+        "             --threads <n>     writer threads (default: a few per core, or one io_uring\n"
+        "                               ring per four cores)\n"
+        "             --writer <auto|threads|uring> io_uring where available (default), or a\n"
+        "                               pool of threads making blocking calls\n"
+        "  list     print the classes matching [glob] with their byte ranges and field counts\n"
+        "  show     print the fields of the classes matching <glob>; only those classes are parsed\n"
+        "             --sdk             print them as Lone SDK.cs structs instead\n"
+        "             --lang <cs|cpp|rust|json> same, in the given output language\n"
+        "             --template <file> same, in a custom format\n"
+        "  lookup   <file.sdkdb> <class> [field]: look offsets up in an exported database\n"
+        "  query    filter the dump's fields through the column store\n"
+        "             --type <name>     fields of exactly this type\n"
+        "             --min-offset <hex> fields at or above this offset\n"
+        "             --tag <I|S|C>     instance, static or const fields\n"
+        "             --histogram       print field counts per tag\n"
+        "             -o <file>         also export the dump there; the columns are then\n"
+        "                               filled by the export pass and hold what it wrote\n"
+        "             --lang, --filter  the output's language and filter, as for export\n"
+        "  generate write a synthetic dump to dump.txt, the same for the same options\n"
+        "             --size <bytes>    how much, e.g. 500M or 4G (default 100M)\n"
+        "             --seed <n>        random seed (default 1)\n"
+        "             --fields <range>  field lines per class, min-max or min-max^skew where\n"
+        "                               skew > 1 favours small counts (default 1-160^2.5)\n"
+        "             --class-size <range> bytes of fields a class adds to its base (8-1024^2)\n"
+        "             --interfaces <range> interfaces per class (0-6^3)\n"
+        "             --depth <n>       longest inheritance chain (default 12)\n"
+        "             --duplicates <rate> share of classes repeated later, e.g. 0.01\n"
+        "             --malformed <rate> share of lines the parser has to skip\n"
+        "             --threads <n>     writer threads (default: one per core)\n");
+}
+
+// Helper function to map a whole dump into memory
+static bool openDump(const std::string& path, MappedFile& file) {
+    if (file.open(path)) return true;
+    fprintf(stderr, "Failed to read %s\n", path.c_str());
+    return false;
+}
+
+// Helper function to print the offsets of bytes that aren't valid UTF-8, as
+// found in the file as given
+static void printInvalidUtf8(const std::vector<size_t>& offsets, size_t shown, const DumpTextInfo& info) {
+    if (offsets.empty()) return;
+    fprintf(stderr, "Warning: invalid UTF-8 at byte offset");
+    for (size_t i = 0; i < offsets.size() && i < shown; i++) fprintf(stderr, "%s %zu", i ? "," : "", offsets[i] + info.bomSize);
+    fprintf(stderr, "%s\n", offsets.size() > shown ? " and more" : "");
+}
+
+// Helper function to bring a dump to BOM-less UTF-8 and warn about bytes that
+// aren't valid UTF-8. With `deferred`, the check is left to checkClassesUtf8()
+// so that commands reading a few classes don't scan the whole dump for it.
+static std::string_view normalizeDump(std::string_view data, std::string& storage, DumpTextInfo* deferred = nullptr) {
+    DumpTextInfo info;
+    std::string_view text = normalizeDumpText(data, storage, &info);
+    if (deferred) {
+        *deferred = info;
+        return text;
+    }
+    if (info.encoding != DumpEncoding::Utf8) return text; // transcoding always yields valid UTF-8
+
+    const size_t shown = 10;
+    printInvalidUtf8(invalidUtf8Offsets(text, shown + 1), shown, info);
+    return text;
+}
+
+// Helper function to do the check normalizeDump() deferred. A sidecar that was
+// reused means the dump wasn't scanned, so only the class blocks the command
+// reads are checked; after a scan checking all of it costs little extra.
+static void checkClassesUtf8(std::string_view text, const DumpTextInfo& info, const SidecarIndex& index, std::vector<ClassSpan> spans) {
+    if (info.encoding != DumpEncoding::Utf8) return; // transcoding always yields valid UTF-8
+
+    const size_t shown = 10;
+    if (!index.reused()) {
+        printInvalidUtf8(invalidUtf8Offsets(text, shown + 1), shown, info);
+        return;
+    }
+
+    std::sort(spans.begin(), spans.end(), [](const ClassSpan& a, const ClassSpan& b) { return a.begin < b.begin; });
+    std::vector<size_t> offsets;
+    for (const ClassSpan& span : spans) {
+        for (size_t offset : invalidUtf8Offsets(text.substr(span.begin, span.end - span.begin), shown + 1 - offsets.size())) {
+            offsets.push_back(span.begin + offset);
+        }
+        if (offsets.size() > shown) break;
+    }
+    printInvalidUtf8(offsets, shown, info);
+}
+
+// Helper function to get the text of a mapped dump, decompressing a compressed one
+// into `inflated` for the commands that need all of it at once
+static std::string_view dumpText(const MappedFile& file, std::string& inflated, DumpTextInfo* deferred = nullptr) {
+    DumpCompression compression = sniffDumpCompression(file.view());
+    if (compression == DumpCompression::None) return normalizeDump(file.view(), inflated, deferred);
+    inflated = decompressDumpToString(file.view(), compression);
+    return normalizeDump(inflated, inflated, deferred);
+}
+
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The token of the export running in the foreground, for SIGINT to cancel
+static CancellationToken* interruptedExport = nullptr;
+
+// Cancels the export between two classes; a second Ctrl+C ends the process as usual
+extern "C" void onInterrupt(int) {
+    if (interruptedExport) interruptedExport->cancel();
+    std::signal(SIGINT, SIG_DFL);
+}
+
+// An output file requested with -o, plus the options given after it
+struct OutputSpec {
+    std::string path;
+    const char* language = nullptr;
+    const char* filter = nullptr;
+    const char* format = nullptr; // --template file
+};
+
+// Helper function to read and compile an output template file
+static bool loadTemplate(const char* path, SdkTemplate& format) {
+    MappedFile file;
+    if (!file.open(path)) {
+        fprintf(stderr, "Failed to read %s\n", path);
+        return false;
+    }
+    format = SdkTemplate::parse(file.view());
+    return true;
+}
+
+// Helper function to guess the output language from a file name
+static SdkLanguage languageForPath(const std::string& path) {
+    std::string ext = std::filesystem::path(path).extension().string();
+    if (ext == ".hpp" || ext == ".h" || ext == ".hxx") return SdkLanguage::Cpp;
+    if (ext == ".rs") return SdkLanguage::Rust;
+    if (ext == ".sdkdb") return SdkLanguage::OffsetsDb;
+    if (ext == ".ndjson" || ext == ".jsonl") return SdkLanguage::Ndjson;
+    return SdkLanguage::CSharp;
+}
+
+// Helper function to close the output files of an export that are still open;
+// false if any of them couldn't be written in full
+static bool closeOutputs(std::vector<SdkExportSink>& sinks) {
+    bool ok = true;
+    for (SdkExportSink& sink : sinks) {
+        if (!sink.out) continue;
+        ok = !ferror(sink.out) && ok;
+        ok = fclose(sink.out) == 0 && ok;
+        sink.out = nullptr;
+    }
+    return ok;
+}
+
+static int runExport(const std::string& dumpPath, int argc, char** argv) {
+    // --lang and --filter apply to the preceding -o, or to every output when given first
+    OutputSpec defaults;
+    std::vector<OutputSpec> outputs;
+    std::vector<std::string> classGlobs;
+    unsigned threads = 0;
+    bool showProgress = false;
+    for (int i = 0; i < argc; i++) {
+        OutputSpec& current = outputs.empty() ? defaults : outputs.back();
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) outputs.push_back({ argv[++i] });
+        else if (!strcmp(argv[i], "--lang") && i + 1 < argc) current.language = argv[++i];
+        else if (!strcmp(argv[i], "--template") && i + 1 < argc) current.format = argv[++i];
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) current.filter = argv[++i];
+        else if (!strcmp(argv[i], "--classes") && i + 1 < argc) classGlobs.push_back(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) threads = static_cast<unsigned>(strtoul(argv[++i], nullptr, 10));
+        else if (!strcmp(argv[i], "--progress")) showProgress = true;
+        else {
+            fprintf(stderr, "export: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+    if (outputs.empty()) outputs.push_back(defaults);
+
+    // Resolve every output before touching any file
+    std::vector<FieldFilter> filters(outputs.size());
+    std::vector<SdkTemplate> formats(outputs.size());
+    std::vector<SdkExportSink> sinks(outputs.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        OutputSpec& output = outputs[i];
+        SdkExportOptions& options = sinks[i].options;
+        const char* language = output.language ? output.language : defaults.language;
+        const char* format = output.format ? output.format : defaults.format;
+        if (format) {
+            if (!loadTemplate(format, formats[i])) return 1;
+            options.language = SdkLanguage::Template;
+            options.format = &formats[i];
+        }
+        else if (language) {
+            if (!parseSdkLanguage(language, options.language) || options.language == SdkLanguage::Template) {
+                fprintf(stderr, "export: --lang must be cs, cpp, rust, db or json (use --template <file> for templates)\n");
+                return 2;
+            }
+        }
+        else if (!output.path.empty()) {
+            options.language = languageForPath(output.path);
+        }
+        if (output.path.empty()) {
+            output.path = (std::filesystem::path(dumpPath).parent_path() / "custom_SDK").string()
+                + (format ? formats[i].extension.c_str() : sdkFileExtension(options.language));
+        }
+
+        const char* filter = output.filter ? output.filter : defaults.filter;
+        if (filter) filters[i] = FieldFilter::compile(filter);
+        options.filter = &filters[i];
+    }
+
+    MappedFile dumpFile;
+    if (!openDump(dumpPath, dumpFile)) return 1;
+    std::string_view dump = dumpFile.view();
+
+    // Compressed dumps are streamed through the decompressor by the exports below;
+    // only --classes needs the whole text, to seek in it
+    DumpCompression compression = sniffDumpCompression(dump);
+    // With --classes the encoding check is left until the classes are known
+    std::string inflated;
+    DumpTextInfo textInfo;
+    DumpTextInfo* deferred = classGlobs.empty() ? nullptr : &textInfo;
+    if (compression == DumpCompression::None) {
+        dump = normalizeDump(dump, inflated, deferred);
+    }
+    else if (!classGlobs.empty()) {
+        inflated = decompressDumpToString(dump, compression);
+        dump = normalizeDump(inflated, inflated, deferred);
+    }
+
+    // A single output of the whole dump is laid out up front and formatted in parallel;
+    // with one thread the streaming writer below is faster
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    bool parallel = sinks.size() == 1 && classGlobs.empty() && compression == DumpCompression::None && threads > 1;
+
+    // Half an SDK is worse than the previous one, so the outputs are written to
+    // temporary files next to them that only replace them once all is written
+    std::vector<std::string> tempPaths;
+    for (const OutputSpec& output : outputs) tempPaths.push_back(output.path + ".tmp");
+    auto discard = [&] {
+        closeOutputs(sinks);
+        std::error_code error;
+        for (const std::string& path : tempPaths) std::filesystem::remove(path, error);
+    };
+    if (!parallel) {
+        for (size_t i = 0; i < sinks.size(); i++) {
+            sinks[i].out = fopen(tempPaths[i].c_str(), "wb");
+            if (!sinks[i].out) {
+                fprintf(stderr, "Failed to open %s for writing.\n", tempPaths[i].c_str());
+                discard();
+                return 1;
+            }
+        }
+    }
+
+    auto work = [&](ExportProgressTracker& progress) {
+        if (parallel) {
+            LazyDump lazy;
+            lazy.load(dump);
+            sinks[0].options.progress = &progress;
+            sinks[0].stats = exportDumpAsSdkParallel(lazy, tempPaths[0], sinks[0].options, threads);
+            return;
+        }
+
+        std::vector<ClassSpan> spans;
+        if (!classGlobs.empty()) {
+            // Only the matching class blocks are parsed, found through the sidecar index
+            SidecarIndex index;
+            index.openOrBuild(dumpPath, dump);
+            for (const std::string& glob : classGlobs) {
+                std::vector<ClassSpan> matches = index.seekGlob(glob, dump);
+                spans.insert(spans.end(), matches.begin(), matches.end());
+            }
+            checkClassesUtf8(dump, textInfo, index, spans);
+        }
+
+        // A single output is written directly; several share one parse of the dump
+        if (sinks.size() == 1) {
+            SdkExportSink& sink = sinks[0];
+            sink.options.progress = &progress;
+            if (classGlobs.empty()) sink.stats = exportDumpAsSdk(dump, sink.out, sink.options);
+            else sink.stats = exportDumpAsSdk(dump, std::move(spans), sink.out, sink.options);
+        }
+        else {
+            if (classGlobs.empty()) exportDumpAsSdk(dump, sinks, &progress);
+            else exportDumpAsSdk(dump, std::move(spans), sinks, &progress);
+        }
+    };
+    auto report = [](const ExportProgress& progress) { fprintf(stderr, "\r%s    ", formatExportProgress(progress).c_str()); };
+
+    // The export runs as a job, the same as in the plugin, so Ctrl+C can stop it between two classes
+    ExportJob job;
+    ExportJobResult result;
+    interruptedExport = &job.token();
+    std::signal(SIGINT, onInterrupt);
+    auto start = std::chrono::steady_clock::now();
+    job.start(work, showProgress ? ExportProgressTracker::Callback(report) : nullptr, [&](const ExportJobResult& finished) { result = finished; });
+    job.wait();
+    double ms = elapsedMs(start);
+    std::signal(SIGINT, SIG_DFL);
+    interruptedExport = nullptr;
+    if (showProgress) fprintf(stderr, "\r%s    \n", formatExportProgress(result.progress).c_str());
+
+    if (result.outcome == ExportJobOutcome::Cancelled) {
+        discard();
+        fprintf(stderr, "Export cancelled after %llu classes; the previous outputs were left as they were.\n",
+            static_cast<unsigned long long>(result.progress.classesDone));
+        return 130;
+    }
+    if (result.outcome == ExportJobOutcome::Failed) {
+        discard();
+        fprintf(stderr, "Error: %s\n", result.error.c_str());
+        return 1;
+    }
+    if (!closeOutputs(sinks)) {
+        discard();
+        fprintf(stderr, "Error: failed to write the outputs; the previous ones were kept.\n");
+        return 1;
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        std::error_code error;
+        std::filesystem::rename(tempPaths[i], outputs[i].path, error);
+        if (error) {
+            discard();
+            fprintf(stderr, "Error: failed to replace %s: %s\n", outputs[i].path.c_str(), error.message().c_str());
+            return 1;
+        }
+    }
+
+    for (size_t i = 0; i < sinks.size(); i++) {
+        const SdkExportStats& stats = sinks[i].stats;
+        printf("Successfully exported %d classes (%zu fields, %zu duplicate classes skipped) to %s\n",
+            stats.classCount, stats.fieldCount, stats.duplicateClasses, outputs[i].path.c_str());
+        if (!filters[i].empty()) printf("Filter dropped %zu classes and %zu fields\n", stats.filteredClasses, stats.filteredFields);
+    }
+    printf("Done in %.1f ms\n", ms);
+    return 0;
+}
+
+static int runShard(const std::string& dumpPath, int argc, char** argv) {
+    std::string dir;
+    const char* language = nullptr;
+    const char* formatPath = nullptr;
+    const char* filterText = nullptr;
+    std::vector<std::string> classGlobs;
+    SdkShardOptions shard;
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc) dir = argv[++i];
+        else if (!strcmp(argv[i], "--by-namespace")) shard.byNamespace = true;
+        else if (!strcmp(argv[i], "--lang") && i + 1 < argc) language = argv[++i];
+        else if (!strcmp(argv[i], "--template") && i + 1 < argc) formatPath = argv[++i];
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) filterText = argv[++i];
+        else if (!strcmp(argv[i], "--classes") && i + 1 < argc) classGlobs.push_back(argv[++i]);
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc) shard.threads = static_cast<unsigned>(strtoul(argv[++i], nullptr, 10));
+        else if (!strcmp(argv[i], "--writer") && i + 1 < argc) {
+            if (!parseShardWriterBackend(argv[++i], shard.writer)) {
+                fprintf(stderr, "shard: --writer must be auto, threads or uring\n");
+                return 2;
+            }
+        }
+        else {
+            fprintf(stderr, "shard: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    SdkExportOptions options;
+    SdkTemplate format;
+    FieldFilter filter;
+    if (formatPath) {
+        if (!loadTemplate(formatPath, format)) return 1;
+        options.language = SdkLanguage::Template;
+        options.format = &format;
+    }
+    else if (language) {
+        if (!parseSdkLanguage(language, options.language) || options.language == SdkLanguage::Template || options.language == SdkLanguage::OffsetsDb) {
+            fprintf(stderr, "shard: --lang must be cs, cpp, rust or json (use --template <file> for templates)\n");
+            return 2;
+        }
+    }
+    if (filterText) filter = FieldFilter::compile(filterText);
+    options.filter = &filter;
+    if (dir.empty()) dir = (std::filesystem::path(dumpPath).parent_path() / "SDK").string();
+
+    MappedFile dumpFile;
+    if (!openDump(dumpPath, dumpFile)) return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    std::string inflated;
+    LazyDump dump;
+    dump.load(dumpText(dumpFile, inflated));
+    std::vector<size_t> classes;
+    if (classGlobs.empty()) {
+        classes.resize(dump.size());
+        for (size_t i = 0; i < classes.size(); i++) classes[i] = i;
+    }
+    else {
+        // A class matching several globs is still written once
+        std::vector<bool> picked(dump.size());
+        for (const std::string& glob : classGlobs) {
+            for (size_t i : dump.index().matchGlobPositions(glob)) {
+                if (!picked[i]) classes.push_back(i);
+                picked[i] = true;
+            }
+        }
+    }
+
+    const SdkExportStats stats = exportDumpAsShards(dump, std::move(classes), dir, options, shard);
+    double ms = elapsedMs(start);
+    printf("Successfully exported %d classes (%zu fields, %zu duplicate classes skipped) to %s\n",
+        stats.classCount, stats.fieldCount, stats.duplicateClasses, dir.c_str());
+    if (!filter.empty()) printf("Filter dropped %zu classes and %zu fields\n", stats.filteredClasses, stats.filteredFields);
+    printf("Done in %.1f ms\n", ms);
+    return 0;
+}
+
+static int runQuery(const std::string& dumpPath, int argc, char** argv) {
+    const char* typeName = nullptr;
+    const char* tagName = nullptr;
+    bool haveMinOffset = false;
+    uint64_t minOffset = 0;
+    bool histogram = false;
+    const char* outputPath = nullptr;
+    const char* language = nullptr;
+    const char* filterText = nullptr;
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "--type") && i + 1 < argc) typeName = argv[++i];
+        else if (!strcmp(argv[i], "--tag") && i + 1 < argc) tagName = argv[++i];
+        else if (!strcmp(argv[i], "--min-offset") && i + 1 < argc) {
+            minOffset = strtoull(argv[++i], nullptr, 16);
+            haveMinOffset = true;
+        }
+        else if (!strcmp(argv[i], "--histogram")) histogram = true;
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc) outputPath = argv[++i];
+        else if (!strcmp(argv[i], "--lang") && i + 1 < argc) language = argv[++i];
+        else if (!strcmp(argv[i], "--filter") && i + 1 < argc) filterText = argv[++i];
+        else {
+            fprintf(stderr, "query: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+
+    uint8_t tag = 0;
+    if (tagName) {
+        if (!strcmp(tagName, "I")) tag = static_cast<uint8_t>(FieldTag::Instance);
+        else if (!strcmp(tagName, "S")) tag = static_cast<uint8_t>(FieldTag::Static);
+        else if (!strcmp(tagName, "C")) tag = static_cast<uint8_t>(FieldTag::Const);
+        else {
+            fprintf(stderr, "query: --tag must be I, S or C\n");
+            return 2;
+        }
+    }
+
+    SdkExportOptions options;
+    FieldFilter filter;
+    if (outputPath) {
+        if (language) {
+            if (!parseSdkLanguage(language, options.language) || options.language == SdkLanguage::Template) {
+                fprintf(stderr, "query: --lang must be cs, cpp, rust, db or json\n");
+                return 2;
+            }
+        }
+        else {
+            options.language = languageForPath(outputPath);
+        }
+        if (filterText) filter = FieldFilter::compile(filterText);
+        options.filter = &filter;
+    }
+    else if (language || filterText) {
+        fprintf(stderr, "query: --lang and --filter only apply to an -o output\n");
+        return 2;
+    }
+
+    MappedFile dumpFile;
+    if (!openDump(dumpPath, dumpFile)) return 1;
+
+    auto buildStart = std::chrono::steady_clock::now();
+    std::string_view dump = dumpFile.view();
+    std::string transcoded;
+    if (sniffDumpCompression(dump) == DumpCompression::None) dump = normalizeDump(dump, transcoded);
+    ColumnStore columns;
+    if (outputPath) {
+        // The export fills the columns as it writes, so the dump is parsed once for both;
+        // like export, it only replaces the output once all of it is written
+        std::string tempPath = std::string(outputPath) + ".tmp";
+        FILE* out = fopen(tempPath.c_str(), "wb");
+        if (!out) {
+            fprintf(stderr, "Failed to open %s for writing.\n", tempPath.c_str());
+            return 1;
+        }
+        options.columns = &columns;
+        SdkExportStats stats;
+        bool written = false;
+        try {
+            stats = exportDumpAsSdk(dump, out, options);
+            written = !ferror(out);
+        }
+        catch (...) {
+            fclose(out);
+            std::filesystem::remove(tempPath);
+            throw;
+        }
+        written = fclose(out) == 0 && written;
+        std::error_code error;
+        if (written) std::filesystem::rename(tempPath, outputPath, error);
+        if (!written || error) {
+            std::filesystem::remove(tempPath, error);
+            fprintf(stderr, "Error: failed to write %s; the previous file was kept.\n", outputPath);
+            return 1;
+        }
+        fprintf(stderr, "Exported %d classes (%zu fields) to %s\n", stats.classCount, stats.fieldCount, outputPath);
+    }
+    else {
+        ColumnStoreBuilder builder(columns);
+        scanAnyDump(dump, builder);
+    }
+    double buildMs = elapsedMs(buildStart);
+
+    size_t count = columns.fieldCount();
+    if (histogram) {
+        size_t tagCounts[FIELD_TAG_COUNT];
+        tagHistogram(columns.tag.data(), count, tagCounts);
+        printf("instance %zu\nstatic   %zu\nconst    %zu\n",
+            tagCounts[static_cast<size_t>(FieldTag::Instance)],
+            tagCounts[static_cast<size_t>(FieldTag::Static)],
+            tagCounts[static_cast<size_t>(FieldTag::Const)]);
+        if (!typeName && !tagName && !haveMinOffset) return 0;
+    }
+
+    // Run the most selective kernel over the full column, then refine the selection
+    auto filterStart = std::chrono::steady_clock::now();
+    std::vector<uint32_t> selection(count), scratch(count);
+    size_t selected = count;
+    bool started = false;
+    if (typeName) {
+        uint32_t typeId = columns.strings.find(typeName);
+        selected = typeId == StringPool::NOT_FOUND ? 0 : selectEqual(columns.typeId.data(), count, typeId, selection.data());
+        started = true;
+    }
+    if (tagName) {
+        if (started) {
+            selected = refineEqual(columns.tag.data(), selection.data(), selected, tag, scratch.data());
+            selection.swap(scratch);
+        }
+        else selected = selectEqual(columns.tag.data(), count, tag, selection.data());
+        started = true;
+    }
+    if (haveMinOffset) {
+        if (started) {
+            selected = refineAtLeast(columns.offset.data(), selection.data(), selected, minOffset, scratch.data());
+            selection.swap(scratch);
+        }
+        else selected = selectAtLeast(columns.offset.data(), count, minOffset, selection.data());
+        started = true;
+    }
+    if (!started) {
+        for (size_t i = 0; i < count; i++) selection[i] = static_cast<uint32_t>(i);
+    }
+    double filterMs = elapsedMs(filterStart);
+
+    for (size_t i = 0; i < selected; i++) {
+        uint32_t row = selection[i];
+        std::string_view cls = columns.strings.str(columns.classNames[columns.classId[row]]);
+        std::string_view name = columns.strings.str(columns.nameId[row]);
+        std::string_view type = columns.strings.str(columns.typeId[row]);
+        printf("%.*s.%.*s = 0x%llX [%c] // %.*s\n",
+            static_cast<int>(cls.size()), cls.data(),
+            static_cast<int>(name.size()), name.data(),
+            static_cast<unsigned long long>(columns.offset[row]),
+            fieldTagLetter(static_cast<FieldTag>(columns.tag[row])),
+            static_cast<int>(type.size()), type.data());
+    }
+    fprintf(stderr, "%zu of %zu fields matched (columns built in %.1f ms, filtered in %.3f ms)\n",
+        selected, count, buildMs, filterMs);
+    return 0;
+}
+
+static int runList(const std::string& dumpPath, int argc, char** argv) {
+    MappedFile dumpFile;
+    if (!openDump(dumpPath, dumpFile)) return 1;
+    std::string inflated;
+    DumpTextInfo textInfo;
+    std::string_view dump = dumpText(dumpFile, inflated, &textInfo);
+
+    auto start = std::chrono::steady_clock::now();
+    SidecarIndex index;
+    index.openOrBuild(dumpPath, dump);
+    std::vector<ClassSpan> matches = index.seekGlob(argc > 0 ? argv[0] : "*", dump);
+    double indexMs = elapsedMs(start);
+    checkClassesUtf8(dump, textInfo, index, matches);
+
+    for (const ClassSpan& span : matches) {
+        const SidecarEntry* entry = index.find(span.name);
+        printf("%.*s [%zu, %zu) %u fields\n", static_cast<int>(span.name.size()), span.name.data(), span.begin, span.end, entry->fieldCount);
+    }
+    fprintf(stderr, "%zu of %zu classes (index %s in %.1f ms)\n", matches.size(), index.size(),
+        index.reused() ? "loaded" : "built", indexMs);
+    return 0;
+}
+
+static int runShow(const std::string& dumpPath, int argc, char** argv) {
+    const char* pattern = nullptr;
+    bool sdk = false;
+    SdkExportOptions options;
+    SdkTemplate format;
+    for (int i = 0; i < argc; i++) {
+        if (!strcmp(argv[i], "--sdk")) sdk = true;
+        else if (!strcmp(argv[i], "--lang") && i + 1 < argc) {
+            if (!parseSdkLanguage(argv[++i], options.language) || options.language == SdkLanguage::Template || options.language == SdkLanguage::OffsetsDb) {
+                fprintf(stderr, "show: --lang must be cs, cpp, rust or json\n");
+                return 2;
+            }
+            sdk = true;
+        }
+        else if (!strcmp(argv[i], "--template") && i + 1 < argc) {
+            if (!loadTemplate(argv[++i], format)) return 1;
+            options.language = SdkLanguage::Template;
+            options.format = &format;
+            sdk = true;
+        }
+        else if (!pattern) pattern = argv[i];
+        else {
+            fprintf(stderr, "show: unknown option '%s'\n", argv[i]);
+            return 2;
+        }
+    }
+    if (!pattern) {
+        fprintf(stderr, "show: missing class name or glob\n");
+        return 2;
+    }
+
+    MappedFile dumpFile;
+    if (!openDump(dumpPath, dumpFile)) return 1;
+
+    // The matching class blocks come from the sidecar index; the dump is only
+    // scanned when there is none yet or it no longer matches
+    auto start = std::chrono::steady_clock::now();
+    std::string inflated;
+    DumpTextInfo textInfo;
+    std::string_view text = dumpText(dumpFile, inflated, &textInfo);
+    SidecarIndex index;
+    index.openOrBuild(dumpPath, text);
+    LazyDump dump;
+    dump.load(text, index.seekGlob(pattern, text));
+    double loadMs = elapsedMs(start);
+    checkClassesUtf8(text, textInfo, index, dump.index().byName());
+
+    start = std::chrono::steady_clock::now();
+    std::vector<size_t> matches(dump.size());
+    std::iota(matches.begin(), matches.end(), size_t(0));
+    if (sdk) {
+        exportDumpAsSdk(dump, matches, stdout, options);
+    }
+    else {
+        for (size_t i : matches) {
+            const LazyClass& parsed = dump.get(i);
+            printf("%.*s\n", static_cast<int>(parsed.header.line.size()), parsed.header.line.data());
+            for (const DumpField& field : parsed.fields) {
+                printf("    %.*s = 0x%llX [%c] // %.*s\n",
+                    static_cast<int>(field.name.size()), field.name.data(),
+                    static_cast<unsigned long long>(field.offset),
+                    fieldTagLetter(field.tag),
+                    static_cast<int>(field.type.size()), field.type.data());
+            }
+        }
+    }
+    fprintf(stderr, "%zu of %zu classes parsed (index %s in %.1f ms, bodies parsed in %.1f ms)\n",
+        dump.parsedCount(), index.size(), index.reused() ? "loaded" : "built", loadMs, elapsedMs(start));
+    return 0;
+}
+
+static int runLookup(const std::string& dbPath, int argc, char** argv) {
+    if (argc < 1 || argc > 2) {
+        fprintf(stderr, "lookup: expected <class> [field]\n");
+        return 2;
+    }
+
+    MappedFile dbFile;
+    if (!openDump(dbPath, dbFile)) return 1;
+    OffsetsDbReader db;
+    if (!db.attach(dbFile.view().data(), dbFile.size()) || !db.validate()) {
+        fprintf(stderr, "%s is not a valid offsets database\n", dbPath.c_str());
+        return 1;
+    }
+
+    auto printField = [&](const OffsetsDbField& field) {
+        std::string_view name = db.name(field);
+        std::string_view type = db.type(field);
+        printf("%.*s = 0x%X [%c] // %.*s\n", static_cast<int>(name.size()), name.data(), field.offset,
+            fieldTagLetter(static_cast<FieldTag>(field.tag)), static_cast<int>(type.size()), type.data());
+    };
+
+    if (argc == 2) {
+        const OffsetsDbField* field = db.find(argv[0], argv[1]);
+        if (!field) {
+            fprintf(stderr, "%s.%s not found\n", argv[0], argv[1]);
+            return 1;
+        }
+        printField(*field);
+        return 0;
+    }
+
+    const OffsetsDbClass* cls = db.findClass(argv[0]);
+    if (!cls) {
+        fprintf(stderr, "%s not found\n", argv[0]);
+        return 1;
+    }
+    for (uint32_t i = 0; i < cls->fieldCount; i++) printField(db.fieldAt(cls->firstField + i));
+    return 0;
+}
+
+// Parses "100M", "4G" (also K and plain bytes); 0 if it isn't a size
+static uint64_t parseByteSize(const char* text) {
+    char* end = nullptr;
+    double value = strtod(text, &end);
+    if (end == text || value <= 0) return 0;
+    switch (*end) {
+    case 'k': case 'K': value *= 1024.0; end++; break;
+    case 'm': case 'M': value *= 1024.0 * 1024.0; end++; break;
+    case 'g': case 'G': value *= 1024.0 * 1024.0 * 1024.0; end++; break;
+    default: break;
+    }
+    if (*end == 'B' || *end == 'b') end++;
+    return *end ? 0 : static_cast<uint64_t>(value);
+}
+
+static int runGenerate(const std::string& outPath, int argc, char** argv) {
+    DumpGeneratorOptions options;
+    uint64_t size = 100ull << 20;
+    for (int i = 0; i < argc; i++) {
+        const char* option = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = value != nullptr;
+        if (!strcmp(option, "--size") && value) valid = (size = parseByteSize(value)) != 0;
+        else if (!strcmp(option, "--seed") && value) options.seed = strtoull(value, nullptr, 10);
+        else if (!strcmp(option, "--fields") && value) valid = parseGeneratorRange(value, options.fields);
+        else if (!strcmp(option, "--class-size") && value) valid = parseGeneratorRange(value, options.classSize);
+        else if (!strcmp(option, "--interfaces") && value) valid = parseGeneratorRange(value, options.interfaces);
+        else if (!strcmp(option, "--depth") && value) options.maxDepth = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+        else if (!strcmp(option, "--duplicates") && value) options.duplicateRate = strtod(value, nullptr);
+        else if (!strcmp(option, "--malformed") && value) options.malformedRate = strtod(value, nullptr);
+        else if (!strcmp(option, "--threads") && value) options.threads = static_cast<unsigned>(strtoul(value, nullptr, 10));
+        else {
+            fprintf(stderr, "generate: unknown option '%s'\n", option);
+            return 2;
+        }
+        if (!valid) {
+            fprintf(stderr, "generate: bad value '%s' for %s\n", value, option);
+            return 2;
+        }
+        i++;
+    }
+
+    FILE* file = fopen(outPath.c_str(), "wb");
+    if (!file) {
+        fprintf(stderr, "Failed to create %s\n", outPath.c_str());
+        return 1;
+    }
+    auto start = std::chrono::steady_clock::now();
+    DumpGenerator generator(options);
+    std::string text;
+    uint64_t written = 0;
+    bool ok = true;
+    while (ok && written < size) {
+        text.clear();
+        generator.generate(text, static_cast<size_t>(std::min<uint64_t>(size - written, 64ull << 20)));
+        ok = fwrite(text.data(), 1, text.size(), file) == text.size();
+        written += text.size();
+    }
+    ok = fclose(file) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "Failed to write %s\n", outPath.c_str());
+        return 1;
+    }
+
+    printf("Generated %s: %llu bytes, %llu classes (%llu duplicates, %llu fields, %llu malformed lines)\n", outPath.c_str(),
+        static_cast<unsigned long long>(written), static_cast<unsigned long long>(generator.classCount()),
+        static_cast<unsigned long long>(generator.duplicateCount()), static_cast<unsigned long long>(generator.fieldCount()),
+        static_cast<unsigned long long>(generator.malformedCount()));
+    printf("Done in %.1f ms\n", elapsedMs(start));
+    return 0;
+}
+
+// Options every command takes, removed from the command line before the command sees it
+struct InstrumentOptions {
+    const char* path = nullptr;   // "-" for stderr
+    std::string format;           // text, json or trace
+};
+
+// Helper function to take --instrument and --instrument-format out of argv
+static bool takeInstrumentOptions(int& argc, char** argv, InstrumentOptions& options) {
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "--instrument" || arg == "--instrument-format") && i + 1 >= argc) return false;
+        if (arg == "--instrument") options.path = argv[++i];
+        else if (arg == "--instrument-format") options.format = argv[++i];
+        else argv[kept++] = argv[i];
+    }
+    argc = kept;
+    if (!options.path) return options.format.empty();
+    if (options.format.empty()) {
+        std::string path = options.path;
+        auto endsWith = [&](const char* suffix) { return path.size() >= std::strlen(suffix) && path.compare(path.size() - std::strlen(suffix), std::string::npos, suffix) == 0; };
+        options.format = endsWith(".trace.json") ? "trace" : endsWith(".json") ? "json" : "text";
+    }
+    return options.format == "text" || options.format == "json" || options.format == "trace";
+}
+
+static void writeInstrumentReport(const InstrumentOptions& options) {
+    std::string report = options.format == "trace" ? formatInstrumentTrace()
+                       : options.format == "json"  ? formatInstrumentJson(collectInstrumentReport())
+                                                   : formatInstrumentText(collectInstrumentReport());
+    if (std::strcmp(options.path, "-") == 0) {
+        fputs(report.c_str(), stderr);
+        return;
+    }
+    FILE* out = fopen(options.path, "wb");
+    if (!out) {
+        fprintf(stderr, "Failed to write %s\n", options.path);
+        return;
+    }
+    fwrite(report.data(), sizeof(char), report.size(), out);
+    fclose(out);
+}
+
+// Helper function to run a command; -1 if there is no such command
+static int runCommand(const std::string& command, const std::string& dumpPath, int argc, char** argv) {
+    if (command == "export") return runExport(dumpPath, argc, argv);
+    if (command == "shard") return runShard(dumpPath, argc, argv);
+    if (command == "query") return runQuery(dumpPath, argc, argv);
+    if (command == "list") return runList(dumpPath, argc, argv);
+    if (command == "show") return runShow(dumpPath, argc, argv);
+    if (command == "lookup") return runLookup(dumpPath, argc, argv);
+    if (command == "generate") return runGenerate(dumpPath, argc, argv);
+    return -1;
+}
+
+int main(int argc, char** argv) {
+    InstrumentOptions instrument;
+    if (!takeInstrumentOptions(argc, argv, instrument) || argc < 3) {
+        printUsage();
+        return 2;
+    }
+    if (instrument.path && !INSTRUMENT_COMPILED_IN) {
+        fprintf(stderr, "Warning: this build has no instrumentation (SDKCORE_INSTRUMENT), the report will be empty\n");
+    }
+
+    int result;
+    try {
+        result = runCommand(argv[1], argv[2], argc - 3, argv + 3);
+    }
+    catch (const std::exception& e) {
+        fprintf(stderr, "Error: %s\n", e.what());
+        result = 1;
+    }
+    if (result < 0) {
+        printUsage();
+        return 2;
+    }
+
+    if (instrument.path) writeInstrumentReport(instrument);
+    return result;
+}
@@ -0,0 +1,416 @@
+namespace SDK
+{
+    // [Class] EFT.Player : UnityEngine.MonoBehaviour, IPlayer, \uE7BE, \uE7BD, \uE7BF, \uE7C8, \uE000, IDissonancePlayer
+    public readonly partial struct EFT_Player
+    {
+        public const uint ClampDeltaHeight = 0x00; // Single
+        public const uint GRIP_CULL_DISTANCE = 0x00; // Int32
+        public const uint IK_CULL_DISTANCE = 0x00; // Int32
+        public const uint MAX_IK_CULL_DISTANCE = 0x00; // Int32
+        public const uint COMPASS_RESOURCE_PATH = 0x00; // String
+        public const uint PLANT_TRIPWIRE_TEMPLATE_PATH = 0x00; // String
+        public const uint HAND_ANIMATION_BLEND_THRESHOLD = 0x00; // Single
+        public const uint TIME_BETWEEN_PRONE_SWEEPS = 0x00; // Single
+        public const uint MIN_ALLOWED_MOVEMENT_SPEED = 0x00; // Single
+        public const uint MAX_STEP_SOUND_SPEED_FACTOR = 0x00; // Single
+        public const uint SURFACE_CHECK_RAYCAST_OFFSET = 0x00; // Single
+        public const uint LANDING_VOLUME_MULT = 0x00; // Single
+        public const uint FP_GEAR_VOLUME = 0x00; // Single
+        public const uint LOCAL_AI_GEAR_VOLUME = 0x00; // Single
+        public const uint MIN_COMMON_DAMAGE = 0x00; // Single
+        public const uint FIRST_PERSON_REVERB_FACTOR = 0x00; // Single
+        public const uint DEFAULT_FP_ROLLOFF = 0x00; // Single
+        public const uint EnabledAnimatorsPlayerDefault = 0x00; // System.Int32
+        public const uint FastAnimatorMask = 0x00; // System.Int32
+        public const uint EnabledAnimatorsSpiritDefault = 0x00; // System.Int32
+        public const uint SPRINT_DAMAGE = 0x00; // Int32
+        public const uint JUMP_DAMAGE = 0x00; // Int32
+        public const uint LAYER_NAME_PLAYER = 0x00; // String
+        public const uint OnPlayerDeadStatic = 0x00; // System.Action<Player, IPlayer, \uF082, Int32>
+        public const uint ARTA_MAN_PROFILE_ID = 0x00; // String
+        public const uint ARTA_MAN_NAME = 0x00; // String
+        public const uint MAX_FACESHIELD_OPERATIONS_PER_FRAME = 0x00; // Int32
+        public const uint OffsetOfInstanceIDInCPlusPlusObject = 0x00; // Int32
+        public const uint objectIsNullMessage = 0x00; // String
+        public const uint cloneDestroyedMessage = 0x00; // String
+        public const uint _defaultDeltaTimeDelegate = 0x08; // -.Player.\uE010
+        public const uint HearingDetectionTime = 0x10; // System.TimeSpan
+        public const uint m_CachedPtr = 0x10; // IntPtr
+        public const uint m_CancellationTokenSource = 0x18; // System.Threading.CancellationTokenSource
+        public const uint OnSpeedChangedEvent = 0x20; // System.Action<Single, Single, Int32>
+        public const uint OnSightChangedEvent = 0x28; // System.Action<SightComponent>
+        public const uint OnTacticalInteractionChanged = 0x30; // System.Action<Boolean>
+        public const uint OnSmoothSightChange = 0x38; // System.Action<SightComponent, Int32>
+        public const uint _characterController = 0x40; // -.ICharacterController
+        public const uint _triggerColliderSearcher = 0x48; // -.TriggerColliderSearcher
+        public const uint _currentInteractor = 0x50; // EFT.Interactive.WorldInteractiveObject
+        public const uint MovementContext = 0x58; // EFT.MovementContext
+        public const uint Pedometer = 0x60; // -.\uE854
+        public const uint _mouseSensitivityModifiers = 0x68; // System.Collections.Generic.Dictionary<Int32, Single>
+        public const uint OnDamageReceived = 0x70; // -.Player.\uE004
+        public const uint LeftHandInteractionTarget = 0x78; // -.GripPose
+        public const uint Grounder = 0x80; // RootMotion.FinalIK.GrounderFBBIK
+        public const uint HitReaction = 0x88; // RootMotion.FinalIK.HitReaction
+        public const uint _elbowBends = 0x90; // UnityEngine.Transform[]
+        public const uint HandPosers = 0x98; // -.HandPoser[]
+        public const uint LMarkerRawBlender = 0xA0; // -.Player.ValueBlender
+        public const uint LayerWeight = 0xA8; // -.Player.ValueBlender
+        public const uint ThirdIkWeight = 0xB0; // -.Player.BetterValueBlender
+        public const uint _fbbik = 0xB8; // RootMotion.FinalIK.FullBodyBipedIK
+        public const uint _playerBody = 0xC0; // EFT.PlayerBody
+        public const uint _ribcageChildPositions = 0xC8; // UnityEngine.Vector3[]
+        public const uint _ribcageChildRotations = 0xD0; // UnityEngine.Quaternion[]
+        public const uint _markers = 0xD8; // UnityEngine.Transform[]
+        public const uint _gripReferences = 0xE0; // UnityEngine.Transform[]
+        public const uint _ikTargets = 0xE8; // UnityEngine.Transform[]
+        public const uint _vestMarker = 0xF0; // UnityEngine.Transform
+        public const uint _shoulderEffector = 0xF8; // UnityEngine.Transform
+        public const uint _propBone = 0x100; // UnityEngine.Transform
+        public const uint _twistBones = 0x108; // -.TwistRelax[]
+        public const uint _limbs = 0x110; // RootMotion.FinalIK.LimbIK[]
+        public const uint _beaconDummy = 0x118; // UnityEngine.GameObject
+        public const uint _createBeaconAction = 0x120; // System.Action
+        public const uint _beaconMaterialSetter = 0x128; // -.PreviewMaterialSetter
+        public const uint _beaconPlacer = 0x130; // EFT.Interactive.BeaconPlacer
+        public const uint _thirdWeaponEffects = 0x138; // -.FirearmsEffects
+        public const uint _firstWeaponEffects = 0x140; // -.FirearmsEffects
+        public const uint _compassArrow = 0x148; // -.CompassArrow
+        public const uint _radioTransmitterView = 0x150; // EFT.ClientItems.ClientSpecItems.RadioTransmitterView
+        public const uint _animatorPropTransforms = 0x158; // UnityEngine.Transform[]
+        public const uint _propTransforms = 0x160; // UnityEngine.Transform[]
+        public const uint _preAllocatedRenderersList = 0x168; // System.Collections.Generic.List<\uE43B>
+        public const uint TripwirePlanner = 0x170; // EFT.TripwireVisualPlacer
+        public const uint PointOfViewChanged = 0x178; // Diz.Binding.BindableEvent
+        public const uint AuthorityBlender = 0x180; // -.Player.ValueBlender
+        public const uint GrounderBlender = 0x188; // -.Player.ValueBlender
+        public const uint _handsAnimator = 0x190; // -.ObjectInHandsAnimator
+        public const uint _spawnedKey = 0x198; // UnityEngine.GameObject
+        public const uint _cacheBonesDelegate = 0x1A0; // System.Action
+        public const uint BeingHitAction = 0x1A8; // System.Action<\uF082, Int32, Single>
+        public const uint OnPropVisibility = 0x1B0; // System.Action<Boolean>
+        public const uint OnShowAmmoCountZeroingPanel = 0x1B8; // System.Action<String>
+        public const uint OnShowFireMode = 0x1C0; // System.Action<Byte>
+        public const uint OnShowAmmoDetails = 0x1C8; // System.Action<Int32, Int32, Int32, String, Boolean>
+        public const uint CameraContainer = 0x1D0; // UnityEngine.GameObject
+        public const uint CameraPosition = 0x1D8; // UnityEngine.Transform
+        public const uint ProceduralWeaponAnimation = 0x1E0; // EFT.Animations.ProceduralWeaponAnimation
+        public const uint _garbage = 0x1E8; // -.Player.\uE005
+        public const uint NestedStepSoundSource = 0x1F0; // -.BetterSource
+        public const uint _speechSource = 0x1F8; // -.BetterSource
+        public const uint FractureSound = 0x200; // UnityEngine.AudioClip
+        public const uint PropIn = 0x208; // -.BaseSoundPlayer.SoundElement
+        public const uint PropOut = 0x210; // -.BaseSoundPlayer.SoundElement
+        public const uint FaceshieldOn = 0x218; // UnityEngine.AudioClip
+        public const uint FaceshieldOff = 0x220; // UnityEngine.AudioClip
+        public const uint NightVisionOn = 0x228; // UnityEngine.AudioClip
+        public const uint SwitchHeadlights = 0x230; // UnityEngine.AudioClip
+        public const uint NightVisionOff = 0x238; // UnityEngine.AudioClip
+        public const uint ThermalVisionOn = 0x240; // UnityEngine.AudioClip
+        public const uint ThermalVisionOff = 0x248; // UnityEngine.AudioClip
+        public const uint _tinnitus = 0x250; // UnityEngine.AudioClip
+        public const uint _soundBySurface = 0x258; // System.Collections.Generic.Dictionary<Int32, SurfaceSet>
+        public const uint _currentSet = 0x260; // EFT.SurfaceSet
+        public const uint _gearSoundBank = 0x268; // EFT.SoundBank
+        public const uint _gearMediumSoundBank = 0x270; // EFT.SoundBank
+        public const uint _gearFastSoundBank = 0x278; // EFT.SoundBank
+        public const uint _backpackDropBank = 0x280; // EFT.SoundBank
+        public const uint _playerSounds = 0x288; // EFT.Sounds
+        public const uint _hearingSettings = 0x290; // EFT.Character.Data.FirstPersonPlayerHearingSettings
+        public const uint _idleCoroutine = 0x298; // UnityEngine.Coroutine
+        public const uint _runCoroutine = 0x2A0; // UnityEngine.Coroutine
+        public const uint _sprintCoroutine = 0x2A8; // UnityEngine.Coroutine
+        public const uint _gearDelay = 0x2B0; // UnityEngine.Coroutine
+        public const uint _outOfRangeSpeakingCoroutine = 0x2B8; // UnityEngine.Coroutine
+        public const uint _currentSourceCoroutine = 0x2C0; // UnityEngine.Coroutine
+        public const uint _searchSource = 0x2C8; // -.BetterSource
+        public const uint _lastClip = 0x2D0; // UnityEngine.AudioClip
+        public const uint _soundPropagationVolumes = 0x2D8; // System.Collections.Generic.List<BetterPropagationVolume>
+        public const uint _volumesBuffer = 0x2E0; // System.Collections.Generic.List<BetterPropagationVolume>
+        public const uint _mutuallyExclusive = 0x2E8; // EFT.Interactive.BetterPropagationVolume
+        public const uint _exhaustionAudibilityUnsub = 0x2F0; // System.Action
+        public const uint _vaultAudioController = 0x2F8; // -.\uEB78
+        public const uint _sprintVaultAudioController = 0x300; // -.\uEB78
+        public const uint _climbAudioController = 0x308; // -.\uEB78
+        public const uint _voipAudioSource = 0x310; // UnityEngine.AudioSource
+        public const uint _specificStepAudioController = 0x318; // -.\uE55A
+        public const uint _voipSourceBinding = 0x320; // System.Action
+        public const uint _gearSource = 0x328; // -.BetterSource
+        public const uint _tripwireInteractionSoundController = 0x330; // -.\uEAED
+        public const uint _sourcePrewarmer = 0x338; // -.\uE418
+        public const uint _dropBackPackEvents = 0x340; // EFT.IDropBackPackEvents
+        public const uint _priorityCalculator = 0x348; // -.\uE553
+        public const uint _gearWalkDelaySec = 0x350; // UnityEngine.WaitForSeconds
+        public const uint _cachedMovementRolloff = 0x358; // System.Collections.Generic.Dictionary<Byte, Single>
+        public const uint _playerAudioSettings = 0x360; // -.\uE509.\uE007
+        public const uint _interactionSource = 0x368; // -.BetterSource
+        public const uint _damageThresholdAudioChecker = 0x370; // -.\uE6B1
+        public const uint _soundUnsubscribeOnDestroy = 0x378; // System.Action
+        public const uint POM = 0x380; // -.PlayerOverlapManager
+        public const uint TriggerZones = 0x388; // System.Collections.Generic.List<String>
+        public const uint OnExitTriggerVisited = 0x390; // Diz.Binding.BindableEvent
+        public const uint InteractingWithExfiltrationPoint = 0x398; // -.\uF1CF<Boolean>
+        public const uint GameWorld = 0x3A0; // EFT.GameWorld
+        public const uint _animators = 0x3A8; // -.IAnimator[]
+        public const uint _underbarrelFastAnimator = 0x3B0; // -.IAnimator
+        public const uint Speaker = 0x3B8; // -.\uE938
+        public const uint OnPlayerDead = 0x3C0; // -.\uE88C
+        public const uint OnPlayerDeadOrUnspawn = 0x3C8; // -.\uE88D
+        public const uint Spirit = 0x3D0; // EFT.PlayerSpirit
+        public const uint Logger = 0x3D8; // -.Player.\uE00E
+        public const uint Corpse = 0x3E0; // EFT.Interactive.Corpse
+        public const uint LastAggressor = 0x3E8; // EFT.IPlayer
+        public const uint LastDamageInfo = 0x3F0; // -.\uF082
+        public const uint GetSensitivity = 0x4D0; // System.Func<Single>
+        public const uint GetAimingSensitivity = 0x4D8; // System.Func<Single>
+        public const uint _openAction = 0x4E0; // System.Action<Action>
+        public const uint recodableItemsHandler = 0x4E8; // EFT.RecodableItemsHandler
+        public const uint Fatigue = 0x4F0; // -.\uED52
+        public const uint _renderers = 0x4F8; // UnityEngine.Renderer[]
+        public const uint _camera = 0x500; // UnityEngine.Camera
+        public const uint _selfDamage = 0x508; // UnityEngine.Coroutine
+        public const uint _itemInHands = 0x510; // -.\uF1CF<Item>
+        public const uint CompositeDisposable = 0x518; // -.\uE400
+        public const uint _heavyVestsDeflectRandoms = 0x520; // -.\uF078
+        public const uint _unsubscribeOnEndSession = 0x528; // System.Action
+        public const uint _helmetLightControllers = 0x530; // System.Collections.Generic.IEnumerable<TacticalComboVisualController>
+        public const uint _createdAnimator = 0x538; // UnityEngine.Animator
+        public const uint _createdRuntimeAnimatorController = 0x540; // UnityEngine.RuntimeAnimatorController
+        public const uint _vaultingComponent = 0x548; // EFT.Vaulting.IVaultingComponent
+        public const uint _vaultingComponentDebug = 0x550; // EFT.Vaulting.IVaultingComponentDebug
+        public const uint _vaultingParameters = 0x558; // EFT.Vaulting.IVaultingParameters
+        public const uint _vaultingGameplayRestrictions = 0x560; // EFT.Vaulting.IVaultingGameplayRestrictions
+        public const uint _weaponMountingComponent = 0x568; // EFT.WeaponMounting.IWeaponMountingComponent
+        public const uint OnSenseChanged = 0x570; // System.Action<Boolean>
+        public const uint PossibleInteractionsChanged = 0x578; // System.Action
+        public const uint PhraseSituation = 0x580; // System.Action<Int32, Int32>
+        public const uint OnGlassesChanged = 0x588; // System.Action<Boolean>
+        public const uint OnInventoryOpened = 0x590; // System.Action<Player, Boolean>
+        public const uint OnStartInventoryOpen = 0x598; // System.Action
+        public const uint OnStartQuickdrawPistol = 0x5A0; // System.Action
+        public const uint EventTranslator = 0x5A8; // -.GenericEventTranslator
+        public const uint NightVisionObserver = 0x5B0; // -.Player.\uE00F<NightVisionComponent>
+        public const uint ThermalVisionObserver = 0x5B8; // -.Player.\uE00F<ThermalVisionComponent>
+        public const uint FaceShieldObserver = 0x5C0; // -.Player.\uE00F<FaceShieldComponent>
+        public const uint FaceCoverObserver = 0x5C8; // -.Player.\uE00F<FaceShieldComponent>
+        public const uint Location = 0x5D0; // String
+        public const uint SpawnPoint = 0x5D8; // EFT.Game.Spawning.ISpawnPoint
+        public const uint InteractableObject = 0x5E0; // EFT.Interactive.InteractableObject
+        public const uint InteractablePlayer = 0x5E8; // EFT.Player
+        public const uint PlaceItemZone = 0x5F0; // EFT.Interactive.PlaceItemTrigger
+        public const uint ExfiltrationPoint = 0x5F8; // EFT.Interactive.ExfiltrationPoint
+        public const uint MalfRandoms = 0x600; // EFT.GameRandoms.MalfunctionRandom
+        public const uint Profile = 0x608; // EFT.Profile
+        public const uint StatisticsManager = 0x610; // EFT.IStatisticsManager
+        public const uint Physical = 0x618; // -.\uE38F
+        public const uint OnSpecialPlaceVisited = 0x620; // System.Action<String, Int32>
+        public const uint AIData = 0x628; // -.IAIData
+        public const uint Loyalty = 0x630; // -.PlayerLoyaltyData
+        public const uint OnIPlayerDeadOrUnspawn = 0x638; // System.Action<IPlayer>
+        public const uint MainParts = 0x640; // System.Collections.Generic.Dictionary<Int32, EnemyPart>
+        public const uint _healthController = 0x648; // EFT.HealthSystem.IHealthController
+        public const uint _hitColliders = 0x650; // -.BodyPartCollider[]
+        public const uint _armorPlateColliders = 0x658; // -.ArmorPlateCollider[]
+        public const uint _inventoryController = 0x660; // -.Player.PlayerInventoryController
+        public const uint _handsController = 0x668; // -.Player.AbstractHandsController
+        public const uint _questController = 0x670; // -.\uF17C
+        public const uint _achievementsController = 0x678; // -.\uF19B
+        public const uint _prestigeController = 0x680; // -.\uEB5B
+        public const uint OnHandsControllerChanged = 0x688; // System.Action<AbstractHandsController, AbstractHandsController>
+        public const uint _fullIdInfo = 0x690; // String
+        public const uint Tracking = 0x698; // UnityEngine.Transform
+        public const uint _deltaTimeDelegate = 0x6A0; // -.Player.\uE010
+        public const uint _waitForFixedUpdate = 0x6A8; // UnityEngine.WaitForFixedUpdate
+        public const uint UpdateEvent = 0x6B0; // System.Action
+        public const uint FixedUpdateEvent = 0x6B8; // System.Action
+        public const uint _playerLookRaycastTransform = 0x6C0; // UnityEngine.Transform
+        public const uint PlayerBones = 0x6C8; // -.PlayerBones
+        public const uint _waitInventoryCoroutine = 0x6D0; // UnityEngine.Coroutine
+        public const uint _preAllocatedArmorComponents = 0x6D8; // System.Collections.Generic.List<ArmorComponent>
+        public const uint _preAllocatedBackpackPenaltyComponent = 0x6E0; // EFT.InventoryLogic.EquipmentPenaltyComponent
+        public const uint OnEpInteraction = 0x6E8; // System.Action<ExfiltrationPoint, Boolean>
+        public const uint BotsGroup = 0x6F0; // -.BotsGroup
+        public const uint ExfilUnsubscribe = 0x6F8; // System.Action
+        public const uint SessionEndUnsubscribe = 0x700; // System.Collections.Generic.List<Action>
+        public const uint FoundSecretExits = 0x708; // System.Collections.Generic.List<SecretExfiltrationPoint>
+        public const uint VoipController = 0x710; // EFT.IPlayerVoipController
+        public const uint DissonanceComms = 0x718; // Dissonance.DissonanceComms
+        public const uint _customHandRotator = 0x720; // -.\uE88F
+        public const uint BtrInteractionSide = 0x728; // EFT.Vehicle.BTRSide
+        public const uint TripwireInteractionTrigger = 0x730; // EFT.SynchronizableObjects.TripwireInteractionTrigger
+        public const uint EventObjectInteractive = 0x738; // EFT.Interactive.EventObjectInteractive
+        public const uint OnBtrStateChanged = 0x740; // System.Action<Int32>
+        public const uint ScheduledProcess = 0x748; // -.Player.AbstractProcess
+        public const uint ActiveSlot = 0x750; // EFT.InventoryLogic.Slot
+        public const uint HandsChangingEvent = 0x758; // System.Action
+        public const uint HandsChangedEvent = 0x760; // System.Action<\uE845>
+        public const uint _lastEquippedWeaponOrKnifeItem = 0x768; // EFT.InventoryLogic.Item
+        public const uint _slotPriority = 0x770; // System.Int32[]
+        public const uint _removeFromHandsCallback = 0x778; // Comfort.Common.Callback
+        public const uint _setInHandsCallback = 0x780; // Comfort.Common.Callback
+        public const uint _doorKick = 0x788; // Boolean
+        public const uint _horizontal = 0x78C; // Single
+        public const uint _vertical = 0x790; // Single
+        public const uint _resetLook = 0x794; // Boolean
+        public const uint _mouseLookControl = 0x795; // Boolean
+        public const uint _isResettingLook = 0x796; // Boolean
+        public const uint _setResetedLookNextFrame = 0x797; // Boolean
+        public const uint _isLooking = 0x798; // Boolean
+        public const uint HeadRotation = 0x79C; // UnityEngine.Vector3
+        public const uint _mouseSensitivityModifier = 0x7A8; // Single
+        public const uint _rotationPitchLimit = 0x7AC; // UnityEngine.Vector2
+        public const uint _targetRotationPitch = 0x7B4; // UnityEngine.Vector2
+        public const uint InputDirection = 0x7BC; // UnityEngine.Vector2
+        public const uint TrunkRotationLimit = 0x7C4; // Single
+        public const uint PoseMemo = 0x7C8; // Single
+        public const uint _speedMemo = 0x7CC; // Single
+        public const uint _lastSlowLean = 0x7D0; // Boolean
+        public const uint CurrentLeanType = 0x7D4; // System.Int32
+        public const uint _lastMovement = 0x7D8; // Single
+        public const uint _cachedMouseLookControl = 0x7DC; // Boolean
+        public const uint _isVaultingPressed = 0x7DD; // Boolean
+        public const uint _vaultingTiming = 0x7E0; // Single
+        public const uint _prevHeight = 0x7E4; // Single
+        public const uint HeightSmoothTime = 0x7E8; // Single
+        public const uint _dampVelocity = 0x7EC; // Single
+        public const uint _currentSmoothSpeed = 0x7F0; // Single
+        public const uint _previousY = 0x7F4; // Single
+        public const uint RibcageScaleCurrent = 0x7F8; // Single
+        public const uint RibcageScaleCurrentTarget = 0x7FC; // Single
+        public const uint UtilityLayerRange = 0x800; // UnityEngine.Vector2
+        public const uint UtilityLayerLerpSpeed = 0x808; // Single
+        public const uint GripAutoAdjust = 0x80C; // Boolean
+        public const uint CustomAnimationsAreProcessing = 0x80D; // Boolean
+        public const uint ThirdPersonWeaponRootAuthority = 0x810; // Single
+        public const uint _ribcageScaleCompensated = 0x814; // Single
+        public const uint _shoulderVel = 0x818; // Single
+        public const uint _fbbikCooldown = 0x81C; // Single
+        public const uint _turnOffFbbikAt = 0x820; // Single
+        public const uint _firstPersonRightHand = 0x824; // Single
+        public const uint _firstPersonLeftHand = 0x828; // Single
+        public const uint _utilityLayerWeight = 0x82C; // Single
+        public const uint _smoothLW = 0x830; // Single
+        public const uint _rawWeight = 0x834; // Single
+        public const uint _rawDampVelocity = 0x838; // Single
+        public const uint _interactionLayerWeight = 0x83C; // Single
+        public const uint _stored = 0x840; // Boolean
+        public const uint _pointOfViewUndecided = 0x841; // Boolean
+        public const uint _hasAnimatorPropBones = 0x842; // Boolean
+        public const uint _hasProp = 0x843; // Boolean
+        public const uint _propActive = 0x844; // Boolean
+        public const uint _compassInstantiated = 0x845; // Boolean
+        public const uint _radioTransmitterInstantiated = 0x846; // Boolean
+        public const uint _ikPosition = 0x848; // UnityEngine.Vector3
+        public const uint _lMarkerRawPosition = 0x854; // UnityEngine.Vector3
+        public const uint _lElbowRawPosition = 0x860; // UnityEngine.Vector3
+        public const uint _rElbowRawPosition = 0x86C; // UnityEngine.Vector3
+        public const uint _propRawPosition = 0x878; // UnityEngine.Vector3
+        public const uint _lMarkerRawRotation = 0x884; // UnityEngine.Quaternion
+        public const uint _propRawRotation = 0x894; // UnityEngine.Quaternion
+        public const uint _ikRotation = 0x8A4; // UnityEngine.Quaternion
+        public const uint HasGamePlayerOwner = 0x8B4; // Boolean
+        public const uint UsedSimplifiedSkeleton = 0x8B5; // Boolean
+        public const uint _ergonomicsPenalty = 0x8B8; // Single
+        public const uint _shotTime = 0x8BC; // Single
+        public const uint _isDeadAlready = 0x8C0; // Boolean
+        public const uint _isGrenadeOrKnife = 0x8C1; // Boolean
+        public const uint BeaconPosition = 0x8C4; // UnityEngine.Vector3
+        public const uint BeaconRotation = 0x8D0; // UnityEngine.Quaternion
+        public const uint AllowToPlantBeacon = 0x8E0; // Boolean
+        public const uint IsHeadLightsAnimationActive = 0x8E1; // Boolean
+        public const uint _isInteractionPlayeingLastFrame = 0x8E2; // Boolean
+        public const uint _currentHandsRotation = 0x8E4; // UnityEngine.Quaternion
+        public const uint CurrentSurface = 0x8F4; // System.Int32
+        public const uint _stepLayerMask = 0x8F8; // UnityEngine.LayerMask
+        public const uint CHECK_RANGE_BUFF = 0x8FC; // Single
+        public const uint MIN_FALL_DAMAGE = 0x900; // Single
+        public const uint Environment = 0x904; // System.Int32
+        public const uint HeavyBreath = 0x908; // Boolean
+        public const uint Muffled = 0x909; // Boolean
+        public const uint OcclusionDirty = 0x90A; // Boolean
+        public const uint DistanceDirty = 0x90B; // Boolean
+        public const uint PreviousFaceShield = 0x90C; // Boolean
+        public const uint PreviousNightVision = 0x90D; // Boolean
+        public const uint PreviousThermalVision = 0x90E; // Boolean
+        public const uint SpeechLocalPosition = 0x910; // UnityEngine.Vector3
+        public const uint _speechLocalPosition = 0x91C; // UnityEngine.Vector3
+        public const uint _playedAtLeastOneStep = 0x928; // Boolean
+        public const uint _nextJumpAfter = 0x92C; // Single
+        public const uint _searchCount = 0x930; // Single
+        public const uint _exhaustionIsAudible = 0x934; // Boolean
+        public const uint _sprintSurfaceCheck = 0x938; // Single
+        public const uint _runSurfaceCheck = 0x93C; // Single
+        public const uint _landSurfaceCheck = 0x940; // Single
+        public const uint _proneSurfaceCheck = 0x944; // Single
+        public const uint _sign = 0x948; // Single
+        public const uint _lastStepTime = 0x94C; // Single
+        public const uint _lastTimeTurnSound = 0x950; // Single
+        public const uint maxLengthTurnSound = 0x954; // Single
+        public const uint _nextSurfaceCheck = 0x958; // Single
+        public const uint _distance = 0x95C; // Single
+        public const uint _enqueuedForRelease = 0x960; // Boolean
+        public const uint _maxAllowedMovementSpeed = 0x964; // Single
+        public const uint _animatorFootstepCurveHash = 0x968; // Int32
+        public const uint _useSimpleUnderRoofCheck = 0x96C; // Boolean
+        public const uint LastDamageType = 0x970; // System.Int32
+        public const uint LastDamagedBodyPart = 0x974; // System.Int32
+        public const uint Destroyed = 0x978; // Boolean
+        public const uint QuickdrawWeaponFast = 0x979; // Boolean
+        public const uint FastSlotSelection = 0x97A; // Boolean
+        public const uint PreviousWeaponAimState = 0x97B; // Boolean
+        public const uint QuickdrawTime = 0x97C; // Single
+        public const uint IsInBufferZone = 0x980; // Boolean
+        public const uint CanManipulateWithHandsInBufferZone = 0x981; // Boolean
+        public const uint EnabledAnimators = 0x984; // System.Int32
+        public const uint LastBodyPart = 0x988; // System.Int32
+        public const uint _corpseAppliedForce = 0x98C; // Single
+        public const uint _countdownToSprintDamage = 0x990; // Single
+        public const uint _lastHitTime = 0x994; // Single
+        public const uint _lastHitDebuffFrame = 0x998; // Int32
+        public const uint _accumulatedDebuffDamage = 0x99C; // Single
+        public const uint _negativeBuffsCount = 0x9A0; // Int32
+        public const uint _sense = 0x9A4; // Boolean
+        public const uint _isInventoryOpened = 0x9A5; // Boolean
+        public const uint _displaySense = 0x9A6; // Boolean
+        public const uint RayLength = 0x9A8; // Single
+        public const uint InteractableObjectIsProxy = 0x9AC; // Boolean
+        public const uint IsAgressorInLighthouseTraderZone = 0x9AD; // Boolean
+        public const uint ExitTriggerZone = 0x9AE; // Boolean
+        public const uint PlayerId = 0x9B0; // Int32
+        public const uint _updateQueue = 0x9B4; // System.Int32
+        public const uint _armsUpdateQueue = 0x9B8; // System.Int32
+        public const uint VisibleToCameraType = 0x9BC; // System.Int32
+        public const uint IsVisibleToCamera = 0x9C0; // Boolean
+        public const uint _armsUpdateMode = 0x9C4; // System.Int32
+        public const uint _bodyUpdateMode = 0x9C8; // System.Int32
+        public const uint _awareness = 0x9CC; // Single
+        public const uint _armsupdated = 0x9D0; // Boolean
+        public const uint _armsTime = 0x9D4; // Single
+        public const uint _bodyupdated = 0x9D8; // Boolean
+        public const uint _bodyTime = 0x9DC; // Single
+        public const uint _nFixedFrames = 0x9E0; // Int32
+        public const uint _fixedTime = 0x9E4; // Single
+        public const uint LastDeltaTime = 0x9E8; // Single
+        public const uint _lastInteractionState = 0x9EC; // System.Byte
+        public const uint InteractionRayOriginOnStartOperation = 0x9F0; // UnityEngine.Vector3
+        public const uint InteractionRayDirectionOnStartOperation = 0x9FC; // UnityEngine.Vector3
+        public const uint _nextCastHasForceEvent = 0xA08; // Boolean
+        public const uint _lastStateUpdateTime = 0xA0C; // Single
+        public const uint _gameSessionEndWasCalled = 0xA10; // Boolean
+        public const uint AggressorFound = 0xA11; // Boolean
+        public const uint IsYourPlayer = 0xA12; // Boolean
+        public const uint MyHandsToBodyAngle = 0xA14; // Single
+        public const uint MovementIteration = 0xA18; // SByte
+        public const uint HearingDateTime = 0xA20; // System.DateTime
+        public const uint VoipState = 0xA28; // System.Byte
+        public const uint IgnoreCameraCollider = 0xA29; // Boolean
+        public const uint _btrState = 0xA2C; // System.Int32
+        public const uint _lastBtrStateInteractionCheck = 0xA30; // System.Int32
+        public const uint _lastBtrStateCheck = 0xA34; // System.Byte
+        public const uint _lastBtrCastResult = 0xA35; // Boolean
+        public const uint _lastTripwireCastResult = 0xA36; // Boolean
+        public const uint _lastEventObjectCastResult = 0xA37; // Boolean
+        public const uint _processStatus = 0xA38; // System.Int32
+        public const uint _lastFaceshieldOperationTime = 0xA3C; // Single
+        public const uint _faceshieldNumOperations = 0xA40; // Int32
+    }
+}
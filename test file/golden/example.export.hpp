@@ -0,0 +1,419 @@
+#pragma once
+#include <cstdint>
+
+namespace SDK
+{
+    // [Class] EFT.Player : UnityEngine.MonoBehaviour, IPlayer, \uE7BE, \uE7BD, \uE7BF, \uE7C8, \uE000, IDissonancePlayer
+    namespace EFT_Player
+    {
+        constexpr uint32_t ClampDeltaHeight = 0x00; // Single
+        constexpr uint32_t GRIP_CULL_DISTANCE = 0x00; // Int32
+        constexpr uint32_t IK_CULL_DISTANCE = 0x00; // Int32
+        constexpr uint32_t MAX_IK_CULL_DISTANCE = 0x00; // Int32
+        constexpr uint32_t COMPASS_RESOURCE_PATH = 0x00; // String
+        constexpr uint32_t PLANT_TRIPWIRE_TEMPLATE_PATH = 0x00; // String
+        constexpr uint32_t HAND_ANIMATION_BLEND_THRESHOLD = 0x00; // Single
+        constexpr uint32_t TIME_BETWEEN_PRONE_SWEEPS = 0x00; // Single
+        constexpr uint32_t MIN_ALLOWED_MOVEMENT_SPEED = 0x00; // Single
+        constexpr uint32_t MAX_STEP_SOUND_SPEED_FACTOR = 0x00; // Single
+        constexpr uint32_t SURFACE_CHECK_RAYCAST_OFFSET = 0x00; // Single
+        constexpr uint32_t LANDING_VOLUME_MULT = 0x00; // Single
+        constexpr uint32_t FP_GEAR_VOLUME = 0x00; // Single
+        constexpr uint32_t LOCAL_AI_GEAR_VOLUME = 0x00; // Single
+        constexpr uint32_t MIN_COMMON_DAMAGE = 0x00; // Single
+        constexpr uint32_t FIRST_PERSON_REVERB_FACTOR = 0x00; // Single
+        constexpr uint32_t DEFAULT_FP_ROLLOFF = 0x00; // Single
+        constexpr uint32_t EnabledAnimatorsPlayerDefault = 0x00; // System.Int32
+        constexpr uint32_t FastAnimatorMask = 0x00; // System.Int32
+        constexpr uint32_t EnabledAnimatorsSpiritDefault = 0x00; // System.Int32
+        constexpr uint32_t SPRINT_DAMAGE = 0x00; // Int32
+        constexpr uint32_t JUMP_DAMAGE = 0x00; // Int32
+        constexpr uint32_t LAYER_NAME_PLAYER = 0x00; // String
+        constexpr uint32_t OnPlayerDeadStatic = 0x00; // System.Action<Player, IPlayer, \uF082, Int32>
+        constexpr uint32_t ARTA_MAN_PROFILE_ID = 0x00; // String
+        constexpr uint32_t ARTA_MAN_NAME = 0x00; // String
+        constexpr uint32_t MAX_FACESHIELD_OPERATIONS_PER_FRAME = 0x00; // Int32
+        constexpr uint32_t OffsetOfInstanceIDInCPlusPlusObject = 0x00; // Int32
+        constexpr uint32_t objectIsNullMessage = 0x00; // String
+        constexpr uint32_t cloneDestroyedMessage = 0x00; // String
+        constexpr uint32_t _defaultDeltaTimeDelegate = 0x08; // -.Player.\uE010
+        constexpr uint32_t HearingDetectionTime = 0x10; // System.TimeSpan
+        constexpr uint32_t m_CachedPtr = 0x10; // IntPtr
+        constexpr uint32_t m_CancellationTokenSource = 0x18; // System.Threading.CancellationTokenSource
+        constexpr uint32_t OnSpeedChangedEvent = 0x20; // System.Action<Single, Single, Int32>
+        constexpr uint32_t OnSightChangedEvent = 0x28; // System.Action<SightComponent>
+        constexpr uint32_t OnTacticalInteractionChanged = 0x30; // System.Action<Boolean>
+        constexpr uint32_t OnSmoothSightChange = 0x38; // System.Action<SightComponent, Int32>
+        constexpr uint32_t _characterController = 0x40; // -.ICharacterController
+        constexpr uint32_t _triggerColliderSearcher = 0x48; // -.TriggerColliderSearcher
+        constexpr uint32_t _currentInteractor = 0x50; // EFT.Interactive.WorldInteractiveObject
+        constexpr uint32_t MovementContext = 0x58; // EFT.MovementContext
+        constexpr uint32_t Pedometer = 0x60; // -.\uE854
+        constexpr uint32_t _mouseSensitivityModifiers = 0x68; // System.Collections.Generic.Dictionary<Int32, Single>
+        constexpr uint32_t OnDamageReceived = 0x70; // -.Player.\uE004
+        constexpr uint32_t LeftHandInteractionTarget = 0x78; // -.GripPose
+        constexpr uint32_t Grounder = 0x80; // RootMotion.FinalIK.GrounderFBBIK
+        constexpr uint32_t HitReaction = 0x88; // RootMotion.FinalIK.HitReaction
+        constexpr uint32_t _elbowBends = 0x90; // UnityEngine.Transform[]
+        constexpr uint32_t HandPosers = 0x98; // -.HandPoser[]
+        constexpr uint32_t LMarkerRawBlender = 0xA0; // -.Player.ValueBlender
+        constexpr uint32_t LayerWeight = 0xA8; // -.Player.ValueBlender
+        constexpr uint32_t ThirdIkWeight = 0xB0; // -.Player.BetterValueBlender
+        constexpr uint32_t _fbbik = 0xB8; // RootMotion.FinalIK.FullBodyBipedIK
+        constexpr uint32_t _playerBody = 0xC0; // EFT.PlayerBody
+        constexpr uint32_t _ribcageChildPositions = 0xC8; // UnityEngine.Vector3[]
+        constexpr uint32_t _ribcageChildRotations = 0xD0; // UnityEngine.Quaternion[]
+        constexpr uint32_t _markers = 0xD8; // UnityEngine.Transform[]
+        constexpr uint32_t _gripReferences = 0xE0; // UnityEngine.Transform[]
+        constexpr uint32_t _ikTargets = 0xE8; // UnityEngine.Transform[]
+        constexpr uint32_t _vestMarker = 0xF0; // UnityEngine.Transform
+        constexpr uint32_t _shoulderEffector = 0xF8; // UnityEngine.Transform
+        constexpr uint32_t _propBone = 0x100; // UnityEngine.Transform
+        constexpr uint32_t _twistBones = 0x108; // -.TwistRelax[]
+        constexpr uint32_t _limbs = 0x110; // RootMotion.FinalIK.LimbIK[]
+        constexpr uint32_t _beaconDummy = 0x118; // UnityEngine.GameObject
+        constexpr uint32_t _createBeaconAction = 0x120; // System.Action
+        constexpr uint32_t _beaconMaterialSetter = 0x128; // -.PreviewMaterialSetter
+        constexpr uint32_t _beaconPlacer = 0x130; // EFT.Interactive.BeaconPlacer
+        constexpr uint32_t _thirdWeaponEffects = 0x138; // -.FirearmsEffects
+        constexpr uint32_t _firstWeaponEffects = 0x140; // -.FirearmsEffects
+        constexpr uint32_t _compassArrow = 0x148; // -.CompassArrow
+        constexpr uint32_t _radioTransmitterView = 0x150; // EFT.ClientItems.ClientSpecItems.RadioTransmitterView
+        constexpr uint32_t _animatorPropTransforms = 0x158; // UnityEngine.Transform[]
+        constexpr uint32_t _propTransforms = 0x160; // UnityEngine.Transform[]
+        constexpr uint32_t _preAllocatedRenderersList = 0x168; // System.Collections.Generic.List<\uE43B>
+        constexpr uint32_t TripwirePlanner = 0x170; // EFT.TripwireVisualPlacer
+        constexpr uint32_t PointOfViewChanged = 0x178; // Diz.Binding.BindableEvent
+        constexpr uint32_t AuthorityBlender = 0x180; // -.Player.ValueBlender
+        constexpr uint32_t GrounderBlender = 0x188; // -.Player.ValueBlender
+        constexpr uint32_t _handsAnimator = 0x190; // -.ObjectInHandsAnimator
+        constexpr uint32_t _spawnedKey = 0x198; // UnityEngine.GameObject
+        constexpr uint32_t _cacheBonesDelegate = 0x1A0; // System.Action
+        constexpr uint32_t BeingHitAction = 0x1A8; // System.Action<\uF082, Int32, Single>
+        constexpr uint32_t OnPropVisibility = 0x1B0; // System.Action<Boolean>
+        constexpr uint32_t OnShowAmmoCountZeroingPanel = 0x1B8; // System.Action<String>
+        constexpr uint32_t OnShowFireMode = 0x1C0; // System.Action<Byte>
+        constexpr uint32_t OnShowAmmoDetails = 0x1C8; // System.Action<Int32, Int32, Int32, String, Boolean>
+        constexpr uint32_t CameraContainer = 0x1D0; // UnityEngine.GameObject
+        constexpr uint32_t CameraPosition = 0x1D8; // UnityEngine.Transform
+        constexpr uint32_t ProceduralWeaponAnimation = 0x1E0; // EFT.Animations.ProceduralWeaponAnimation
+        constexpr uint32_t _garbage = 0x1E8; // -.Player.\uE005
+        constexpr uint32_t NestedStepSoundSource = 0x1F0; // -.BetterSource
+        constexpr uint32_t _speechSource = 0x1F8; // -.BetterSource
+        constexpr uint32_t FractureSound = 0x200; // UnityEngine.AudioClip
+        constexpr uint32_t PropIn = 0x208; // -.BaseSoundPlayer.SoundElement
+        constexpr uint32_t PropOut = 0x210; // -.BaseSoundPlayer.SoundElement
+        constexpr uint32_t FaceshieldOn = 0x218; // UnityEngine.AudioClip
+        constexpr uint32_t FaceshieldOff = 0x220; // UnityEngine.AudioClip
+        constexpr uint32_t NightVisionOn = 0x228; // UnityEngine.AudioClip
+        constexpr uint32_t SwitchHeadlights = 0x230; // UnityEngine.AudioClip
+        constexpr uint32_t NightVisionOff = 0x238; // UnityEngine.AudioClip
+        constexpr uint32_t ThermalVisionOn = 0x240; // UnityEngine.AudioClip
+        constexpr uint32_t ThermalVisionOff = 0x248; // UnityEngine.AudioClip
+        constexpr uint32_t _tinnitus = 0x250; // UnityEngine.AudioClip
+        constexpr uint32_t _soundBySurface = 0x258; // System.Collections.Generic.Dictionary<Int32, SurfaceSet>
+        constexpr uint32_t _currentSet = 0x260; // EFT.SurfaceSet
+        constexpr uint32_t _gearSoundBank = 0x268; // EFT.SoundBank
+        constexpr uint32_t _gearMediumSoundBank = 0x270; // EFT.SoundBank
+        constexpr uint32_t _gearFastSoundBank = 0x278; // EFT.SoundBank
+        constexpr uint32_t _backpackDropBank = 0x280; // EFT.SoundBank
+        constexpr uint32_t _playerSounds = 0x288; // EFT.Sounds
+        constexpr uint32_t _hearingSettings = 0x290; // EFT.Character.Data.FirstPersonPlayerHearingSettings
+        constexpr uint32_t _idleCoroutine = 0x298; // UnityEngine.Coroutine
+        constexpr uint32_t _runCoroutine = 0x2A0; // UnityEngine.Coroutine
+        constexpr uint32_t _sprintCoroutine = 0x2A8; // UnityEngine.Coroutine
+        constexpr uint32_t _gearDelay = 0x2B0; // UnityEngine.Coroutine
+        constexpr uint32_t _outOfRangeSpeakingCoroutine = 0x2B8; // UnityEngine.Coroutine
+        constexpr uint32_t _currentSourceCoroutine = 0x2C0; // UnityEngine.Coroutine
+        constexpr uint32_t _searchSource = 0x2C8; // -.BetterSource
+        constexpr uint32_t _lastClip = 0x2D0; // UnityEngine.AudioClip
+        constexpr uint32_t _soundPropagationVolumes = 0x2D8; // System.Collections.Generic.List<BetterPropagationVolume>
+        constexpr uint32_t _volumesBuffer = 0x2E0; // System.Collections.Generic.List<BetterPropagationVolume>
+        constexpr uint32_t _mutuallyExclusive = 0x2E8; // EFT.Interactive.BetterPropagationVolume
+        constexpr uint32_t _exhaustionAudibilityUnsub = 0x2F0; // System.Action
+        constexpr uint32_t _vaultAudioController = 0x2F8; // -.\uEB78
+        constexpr uint32_t _sprintVaultAudioController = 0x300; // -.\uEB78
+        constexpr uint32_t _climbAudioController = 0x308; // -.\uEB78
+        constexpr uint32_t _voipAudioSource = 0x310; // UnityEngine.AudioSource
+        constexpr uint32_t _specificStepAudioController = 0x318; // -.\uE55A
+        constexpr uint32_t _voipSourceBinding = 0x320; // System.Action
+        constexpr uint32_t _gearSource = 0x328; // -.BetterSource
+        constexpr uint32_t _tripwireInteractionSoundController = 0x330; // -.\uEAED
+        constexpr uint32_t _sourcePrewarmer = 0x338; // -.\uE418
+        constexpr uint32_t _dropBackPackEvents = 0x340; // EFT.IDropBackPackEvents
+        constexpr uint32_t _priorityCalculator = 0x348; // -.\uE553
+        constexpr uint32_t _gearWalkDelaySec = 0x350; // UnityEngine.WaitForSeconds
+        constexpr uint32_t _cachedMovementRolloff = 0x358; // System.Collections.Generic.Dictionary<Byte, Single>
+        constexpr uint32_t _playerAudioSettings = 0x360; // -.\uE509.\uE007
+        constexpr uint32_t _interactionSource = 0x368; // -.BetterSource
+        constexpr uint32_t _damageThresholdAudioChecker = 0x370; // -.\uE6B1
+        constexpr uint32_t _soundUnsubscribeOnDestroy = 0x378; // System.Action
+        constexpr uint32_t POM = 0x380; // -.PlayerOverlapManager
+        constexpr uint32_t TriggerZones = 0x388; // System.Collections.Generic.List<String>
+        constexpr uint32_t OnExitTriggerVisited = 0x390; // Diz.Binding.BindableEvent
+        constexpr uint32_t InteractingWithExfiltrationPoint = 0x398; // -.\uF1CF<Boolean>
+        constexpr uint32_t GameWorld = 0x3A0; // EFT.GameWorld
+        constexpr uint32_t _animators = 0x3A8; // -.IAnimator[]
+        constexpr uint32_t _underbarrelFastAnimator = 0x3B0; // -.IAnimator
+        constexpr uint32_t Speaker = 0x3B8; // -.\uE938
+        constexpr uint32_t OnPlayerDead = 0x3C0; // -.\uE88C
+        constexpr uint32_t OnPlayerDeadOrUnspawn = 0x3C8; // -.\uE88D
+        constexpr uint32_t Spirit = 0x3D0; // EFT.PlayerSpirit
+        constexpr uint32_t Logger = 0x3D8; // -.Player.\uE00E
+        constexpr uint32_t Corpse = 0x3E0; // EFT.Interactive.Corpse
+        constexpr uint32_t LastAggressor = 0x3E8; // EFT.IPlayer
+        constexpr uint32_t LastDamageInfo = 0x3F0; // -.\uF082
+        constexpr uint32_t GetSensitivity = 0x4D0; // System.Func<Single>
+        constexpr uint32_t GetAimingSensitivity = 0x4D8; // System.Func<Single>
+        constexpr uint32_t _openAction = 0x4E0; // System.Action<Action>
+        constexpr uint32_t recodableItemsHandler = 0x4E8; // EFT.RecodableItemsHandler
+        constexpr uint32_t Fatigue = 0x4F0; // -.\uED52
+        constexpr uint32_t _renderers = 0x4F8; // UnityEngine.Renderer[]
+        constexpr uint32_t _camera = 0x500; // UnityEngine.Camera
+        constexpr uint32_t _selfDamage = 0x508; // UnityEngine.Coroutine
+        constexpr uint32_t _itemInHands = 0x510; // -.\uF1CF<Item>
+        constexpr uint32_t CompositeDisposable = 0x518; // -.\uE400
+        constexpr uint32_t _heavyVestsDeflectRandoms = 0x520; // -.\uF078
+        constexpr uint32_t _unsubscribeOnEndSession = 0x528; // System.Action
+        constexpr uint32_t _helmetLightControllers = 0x530; // System.Collections.Generic.IEnumerable<TacticalComboVisualController>
+        constexpr uint32_t _createdAnimator = 0x538; // UnityEngine.Animator
+        constexpr uint32_t _createdRuntimeAnimatorController = 0x540; // UnityEngine.RuntimeAnimatorController
+        constexpr uint32_t _vaultingComponent = 0x548; // EFT.Vaulting.IVaultingComponent
+        constexpr uint32_t _vaultingComponentDebug = 0x550; // EFT.Vaulting.IVaultingComponentDebug
+        constexpr uint32_t _vaultingParameters = 0x558; // EFT.Vaulting.IVaultingParameters
+        constexpr uint32_t _vaultingGameplayRestrictions = 0x560; // EFT.Vaulting.IVaultingGameplayRestrictions
+        constexpr uint32_t _weaponMountingComponent = 0x568; // EFT.WeaponMounting.IWeaponMountingComponent
+        constexpr uint32_t OnSenseChanged = 0x570; // System.Action<Boolean>
+        constexpr uint32_t PossibleInteractionsChanged = 0x578; // System.Action
+        constexpr uint32_t PhraseSituation = 0x580; // System.Action<Int32, Int32>
+        constexpr uint32_t OnGlassesChanged = 0x588; // System.Action<Boolean>
+        constexpr uint32_t OnInventoryOpened = 0x590; // System.Action<Player, Boolean>
+        constexpr uint32_t OnStartInventoryOpen = 0x598; // System.Action
+        constexpr uint32_t OnStartQuickdrawPistol = 0x5A0; // System.Action
+        constexpr uint32_t EventTranslator = 0x5A8; // -.GenericEventTranslator
+        constexpr uint32_t NightVisionObserver = 0x5B0; // -.Player.\uE00F<NightVisionComponent>
+        constexpr uint32_t ThermalVisionObserver = 0x5B8; // -.Player.\uE00F<ThermalVisionComponent>
+        constexpr uint32_t FaceShieldObserver = 0x5C0; // -.Player.\uE00F<FaceShieldComponent>
+        constexpr uint32_t FaceCoverObserver = 0x5C8; // -.Player.\uE00F<FaceShieldComponent>
+        constexpr uint32_t Location = 0x5D0; // String
+        constexpr uint32_t SpawnPoint = 0x5D8; // EFT.Game.Spawning.ISpawnPoint
+        constexpr uint32_t InteractableObject = 0x5E0; // EFT.Interactive.InteractableObject
+        constexpr uint32_t InteractablePlayer = 0x5E8; // EFT.Player
+        constexpr uint32_t PlaceItemZone = 0x5F0; // EFT.Interactive.PlaceItemTrigger
+        constexpr uint32_t ExfiltrationPoint = 0x5F8; // EFT.Interactive.ExfiltrationPoint
+        constexpr uint32_t MalfRandoms = 0x600; // EFT.GameRandoms.MalfunctionRandom
+        constexpr uint32_t Profile = 0x608; // EFT.Profile
+        constexpr uint32_t StatisticsManager = 0x610; // EFT.IStatisticsManager
+        constexpr uint32_t Physical = 0x618; // -.\uE38F
+        constexpr uint32_t OnSpecialPlaceVisited = 0x620; // System.Action<String, Int32>
+        constexpr uint32_t AIData = 0x628; // -.IAIData
+        constexpr uint32_t Loyalty = 0x630; // -.PlayerLoyaltyData
+        constexpr uint32_t OnIPlayerDeadOrUnspawn = 0x638; // System.Action<IPlayer>
+        constexpr uint32_t MainParts = 0x640; // System.Collections.Generic.Dictionary<Int32, EnemyPart>
+        constexpr uint32_t _healthController = 0x648; // EFT.HealthSystem.IHealthController
+        constexpr uint32_t _hitColliders = 0x650; // -.BodyPartCollider[]
+        constexpr uint32_t _armorPlateColliders = 0x658; // -.ArmorPlateCollider[]
+        constexpr uint32_t _inventoryController = 0x660; // -.Player.PlayerInventoryController
+        constexpr uint32_t _handsController = 0x668; // -.Player.AbstractHandsController
+        constexpr uint32_t _questController = 0x670; // -.\uF17C
+        constexpr uint32_t _achievementsController = 0x678; // -.\uF19B
+        constexpr uint32_t _prestigeController = 0x680; // -.\uEB5B
+        constexpr uint32_t OnHandsControllerChanged = 0x688; // System.Action<AbstractHandsController, AbstractHandsController>
+        constexpr uint32_t _fullIdInfo = 0x690; // String
+        constexpr uint32_t Tracking = 0x698; // UnityEngine.Transform
+        constexpr uint32_t _deltaTimeDelegate = 0x6A0; // -.Player.\uE010
+        constexpr uint32_t _waitForFixedUpdate = 0x6A8; // UnityEngine.WaitForFixedUpdate
+        constexpr uint32_t UpdateEvent = 0x6B0; // System.Action
+        constexpr uint32_t FixedUpdateEvent = 0x6B8; // System.Action
+        constexpr uint32_t _playerLookRaycastTransform = 0x6C0; // UnityEngine.Transform
+        constexpr uint32_t PlayerBones = 0x6C8; // -.PlayerBones
+        constexpr uint32_t _waitInventoryCoroutine = 0x6D0; // UnityEngine.Coroutine
+        constexpr uint32_t _preAllocatedArmorComponents = 0x6D8; // System.Collections.Generic.List<ArmorComponent>
+        constexpr uint32_t _preAllocatedBackpackPenaltyComponent = 0x6E0; // EFT.InventoryLogic.EquipmentPenaltyComponent
+        constexpr uint32_t OnEpInteraction = 0x6E8; // System.Action<ExfiltrationPoint, Boolean>
+        constexpr uint32_t BotsGroup = 0x6F0; // -.BotsGroup
+        constexpr uint32_t ExfilUnsubscribe = 0x6F8; // System.Action
+        constexpr uint32_t SessionEndUnsubscribe = 0x700; // System.Collections.Generic.List<Action>
+        constexpr uint32_t FoundSecretExits = 0x708; // System.Collections.Generic.List<SecretExfiltrationPoint>
+        constexpr uint32_t VoipController = 0x710; // EFT.IPlayerVoipController
+        constexpr uint32_t DissonanceComms = 0x718; // Dissonance.DissonanceComms
+        constexpr uint32_t _customHandRotator = 0x720; // -.\uE88F
+        constexpr uint32_t BtrInteractionSide = 0x728; // EFT.Vehicle.BTRSide
+        constexpr uint32_t TripwireInteractionTrigger = 0x730; // EFT.SynchronizableObjects.TripwireInteractionTrigger
+        constexpr uint32_t EventObjectInteractive = 0x738; // EFT.Interactive.EventObjectInteractive
+        constexpr uint32_t OnBtrStateChanged = 0x740; // System.Action<Int32>
+        constexpr uint32_t ScheduledProcess = 0x748; // -.Player.AbstractProcess
+        constexpr uint32_t ActiveSlot = 0x750; // EFT.InventoryLogic.Slot
+        constexpr uint32_t HandsChangingEvent = 0x758; // System.Action
+        constexpr uint32_t HandsChangedEvent = 0x760; // System.Action<\uE845>
+        constexpr uint32_t _lastEquippedWeaponOrKnifeItem = 0x768; // EFT.InventoryLogic.Item
+        constexpr uint32_t _slotPriority = 0x770; // System.Int32[]
+        constexpr uint32_t _removeFromHandsCallback = 0x778; // Comfort.Common.Callback
+        constexpr uint32_t _setInHandsCallback = 0x780; // Comfort.Common.Callback
+        constexpr uint32_t _doorKick = 0x788; // Boolean
+        constexpr uint32_t _horizontal = 0x78C; // Single
+        constexpr uint32_t _vertical = 0x790; // Single
+        constexpr uint32_t _resetLook = 0x794; // Boolean
+        constexpr uint32_t _mouseLookControl = 0x795; // Boolean
+        constexpr uint32_t _isResettingLook = 0x796; // Boolean
+        constexpr uint32_t _setResetedLookNextFrame = 0x797; // Boolean
+        constexpr uint32_t _isLooking = 0x798; // Boolean
+        constexpr uint32_t HeadRotation = 0x79C; // UnityEngine.Vector3
+        constexpr uint32_t _mouseSensitivityModifier = 0x7A8; // Single
+        constexpr uint32_t _rotationPitchLimit = 0x7AC; // UnityEngine.Vector2
+        constexpr uint32_t _targetRotationPitch = 0x7B4; // UnityEngine.Vector2
+        constexpr uint32_t InputDirection = 0x7BC; // UnityEngine.Vector2
+        constexpr uint32_t TrunkRotationLimit = 0x7C4; // Single
+        constexpr uint32_t PoseMemo = 0x7C8; // Single
+        constexpr uint32_t _speedMemo = 0x7CC; // Single
+        constexpr uint32_t _lastSlowLean = 0x7D0; // Boolean
+        constexpr uint32_t CurrentLeanType = 0x7D4; // System.Int32
+        constexpr uint32_t _lastMovement = 0x7D8; // Single
+        constexpr uint32_t _cachedMouseLookControl = 0x7DC; // Boolean
+        constexpr uint32_t _isVaultingPressed = 0x7DD; // Boolean
+        constexpr uint32_t _vaultingTiming = 0x7E0; // Single
+        constexpr uint32_t _prevHeight = 0x7E4; // Single
+        constexpr uint32_t HeightSmoothTime = 0x7E8; // Single
+        constexpr uint32_t _dampVelocity = 0x7EC; // Single
+        constexpr uint32_t _currentSmoothSpeed = 0x7F0; // Single
+        constexpr uint32_t _previousY = 0x7F4; // Single
+        constexpr uint32_t RibcageScaleCurrent = 0x7F8; // Single
+        constexpr uint32_t RibcageScaleCurrentTarget = 0x7FC; // Single
+        constexpr uint32_t UtilityLayerRange = 0x800; // UnityEngine.Vector2
+        constexpr uint32_t UtilityLayerLerpSpeed = 0x808; // Single
+        constexpr uint32_t GripAutoAdjust = 0x80C; // Boolean
+        constexpr uint32_t CustomAnimationsAreProcessing = 0x80D; // Boolean
+        constexpr uint32_t ThirdPersonWeaponRootAuthority = 0x810; // Single
+        constexpr uint32_t _ribcageScaleCompensated = 0x814; // Single
+        constexpr uint32_t _shoulderVel = 0x818; // Single
+        constexpr uint32_t _fbbikCooldown = 0x81C; // Single
+        constexpr uint32_t _turnOffFbbikAt = 0x820; // Single
+        constexpr uint32_t _firstPersonRightHand = 0x824; // Single
+        constexpr uint32_t _firstPersonLeftHand = 0x828; // Single
+        constexpr uint32_t _utilityLayerWeight = 0x82C; // Single
+        constexpr uint32_t _smoothLW = 0x830; // Single
+        constexpr uint32_t _rawWeight = 0x834; // Single
+        constexpr uint32_t _rawDampVelocity = 0x838; // Single
+        constexpr uint32_t _interactionLayerWeight = 0x83C; // Single
+        constexpr uint32_t _stored = 0x840; // Boolean
+        constexpr uint32_t _pointOfViewUndecided = 0x841; // Boolean
+        constexpr uint32_t _hasAnimatorPropBones = 0x842; // Boolean
+        constexpr uint32_t _hasProp = 0x843; // Boolean
+        constexpr uint32_t _propActive = 0x844; // Boolean
+        constexpr uint32_t _compassInstantiated = 0x845; // Boolean
+        constexpr uint32_t _radioTransmitterInstantiated = 0x846; // Boolean
+        constexpr uint32_t _ikPosition = 0x848; // UnityEngine.Vector3
+        constexpr uint32_t _lMarkerRawPosition = 0x854; // UnityEngine.Vector3
+        constexpr uint32_t _lElbowRawPosition = 0x860; // UnityEngine.Vector3
+        constexpr uint32_t _rElbowRawPosition = 0x86C; // UnityEngine.Vector3
+        constexpr uint32_t _propRawPosition = 0x878; // UnityEngine.Vector3
+        constexpr uint32_t _lMarkerRawRotation = 0x884; // UnityEngine.Quaternion
+        constexpr uint32_t _propRawRotation = 0x894; // UnityEngine.Quaternion
+        constexpr uint32_t _ikRotation = 0x8A4; // UnityEngine.Quaternion
+        constexpr uint32_t HasGamePlayerOwner = 0x8B4; // Boolean
+        constexpr uint32_t UsedSimplifiedSkeleton = 0x8B5; // Boolean
+        constexpr uint32_t _ergonomicsPenalty = 0x8B8; // Single
+        constexpr uint32_t _shotTime = 0x8BC; // Single
+        constexpr uint32_t _isDeadAlready = 0x8C0; // Boolean
+        constexpr uint32_t _isGrenadeOrKnife = 0x8C1; // Boolean
+        constexpr uint32_t BeaconPosition = 0x8C4; // UnityEngine.Vector3
+        constexpr uint32_t BeaconRotation = 0x8D0; // UnityEngine.Quaternion
+        constexpr uint32_t AllowToPlantBeacon = 0x8E0; // Boolean
+        constexpr uint32_t IsHeadLightsAnimationActive = 0x8E1; // Boolean
+        constexpr uint32_t _isInteractionPlayeingLastFrame = 0x8E2; // Boolean
+        constexpr uint32_t _currentHandsRotation = 0x8E4; // UnityEngine.Quaternion
+        constexpr uint32_t CurrentSurface = 0x8F4; // System.Int32
+        constexpr uint32_t _stepLayerMask = 0x8F8; // UnityEngine.LayerMask
+        constexpr uint32_t CHECK_RANGE_BUFF = 0x8FC; // Single
+        constexpr uint32_t MIN_FALL_DAMAGE = 0x900; // Single
+        constexpr uint32_t Environment = 0x904; // System.Int32
+        constexpr uint32_t HeavyBreath = 0x908; // Boolean
+        constexpr uint32_t Muffled = 0x909; // Boolean
+        constexpr uint32_t OcclusionDirty = 0x90A; // Boolean
+        constexpr uint32_t DistanceDirty = 0x90B; // Boolean
+        constexpr uint32_t PreviousFaceShield = 0x90C; // Boolean
+        constexpr uint32_t PreviousNightVision = 0x90D; // Boolean
+        constexpr uint32_t PreviousThermalVision = 0x90E; // Boolean
+        constexpr uint32_t SpeechLocalPosition = 0x910; // UnityEngine.Vector3
+        constexpr uint32_t _speechLocalPosition = 0x91C; // UnityEngine.Vector3
+        constexpr uint32_t _playedAtLeastOneStep = 0x928; // Boolean
+        constexpr uint32_t _nextJumpAfter = 0x92C; // Single
+        constexpr uint32_t _searchCount = 0x930; // Single
+        constexpr uint32_t _exhaustionIsAudible = 0x934; // Boolean
+        constexpr uint32_t _sprintSurfaceCheck = 0x938; // Single
+        constexpr uint32_t _runSurfaceCheck = 0x93C; // Single
+        constexpr uint32_t _landSurfaceCheck = 0x940; // Single
+        constexpr uint32_t _proneSurfaceCheck = 0x944; // Single
+        constexpr uint32_t _sign = 0x948; // Single
+        constexpr uint32_t _lastStepTime = 0x94C; // Single
+        constexpr uint32_t _lastTimeTurnSound = 0x950; // Single
+        constexpr uint32_t maxLengthTurnSound = 0x954; // Single
+        constexpr uint32_t _nextSurfaceCheck = 0x958; // Single
+        constexpr uint32_t _distance = 0x95C; // Single
+        constexpr uint32_t _enqueuedForRelease = 0x960; // Boolean
+        constexpr uint32_t _maxAllowedMovementSpeed = 0x964; // Single
+        constexpr uint32_t _animatorFootstepCurveHash = 0x968; // Int32
+        constexpr uint32_t _useSimpleUnderRoofCheck = 0x96C; // Boolean
+        constexpr uint32_t LastDamageType = 0x970; // System.Int32
+        constexpr uint32_t LastDamagedBodyPart = 0x974; // System.Int32
+        constexpr uint32_t Destroyed = 0x978; // Boolean
+        constexpr uint32_t QuickdrawWeaponFast = 0x979; // Boolean
+        constexpr uint32_t FastSlotSelection = 0x97A; // Boolean
+        constexpr uint32_t PreviousWeaponAimState = 0x97B; // Boolean
+        constexpr uint32_t QuickdrawTime = 0x97C; // Single
+        constexpr uint32_t IsInBufferZone = 0x980; // Boolean
+        constexpr uint32_t CanManipulateWithHandsInBufferZone = 0x981; // Boolean
+        constexpr uint32_t EnabledAnimators = 0x984; // System.Int32
+        constexpr uint32_t LastBodyPart = 0x988; // System.Int32
+        constexpr uint32_t _corpseAppliedForce = 0x98C; // Single
+        constexpr uint32_t _countdownToSprintDamage = 0x990; // Single
+        constexpr uint32_t _lastHitTime = 0x994; // Single
+        constexpr uint32_t _lastHitDebuffFrame = 0x998; // Int32
+        constexpr uint32_t _accumulatedDebuffDamage = 0x99C; // Single
+        constexpr uint32_t _negativeBuffsCount = 0x9A0; // Int32
+        constexpr uint32_t _sense = 0x9A4; // Boolean
+        constexpr uint32_t _isInventoryOpened = 0x9A5; // Boolean
+        constexpr uint32_t _displaySense = 0x9A6; // Boolean
+        constexpr uint32_t RayLength = 0x9A8; // Single
+        constexpr uint32_t InteractableObjectIsProxy = 0x9AC; // Boolean
+        constexpr uint32_t IsAgressorInLighthouseTraderZone = 0x9AD; // Boolean
+        constexpr uint32_t ExitTriggerZone = 0x9AE; // Boolean
+        constexpr uint32_t PlayerId = 0x9B0; // Int32
+        constexpr uint32_t _updateQueue = 0x9B4; // System.Int32
+        constexpr uint32_t _armsUpdateQueue = 0x9B8; // System.Int32
+        constexpr uint32_t VisibleToCameraType = 0x9BC; // System.Int32
+        constexpr uint32_t IsVisibleToCamera = 0x9C0; // Boolean
+        constexpr uint32_t _armsUpdateMode = 0x9C4; // System.Int32
+        constexpr uint32_t _bodyUpdateMode = 0x9C8; // System.Int32
+        constexpr uint32_t _awareness = 0x9CC; // Single
+        constexpr uint32_t _armsupdated = 0x9D0; // Boolean
+        constexpr uint32_t _armsTime = 0x9D4; // Single
+        constexpr uint32_t _bodyupdated = 0x9D8; // Boolean
+        constexpr uint32_t _bodyTime = 0x9DC; // Single
+        constexpr uint32_t _nFixedFrames = 0x9E0; // Int32
+        constexpr uint32_t _fixedTime = 0x9E4; // Single
+        constexpr uint32_t LastDeltaTime = 0x9E8; // Single
+        constexpr uint32_t _lastInteractionState = 0x9EC; // System.Byte
+        constexpr uint32_t InteractionRayOriginOnStartOperation = 0x9F0; // UnityEngine.Vector3
+        constexpr uint32_t InteractionRayDirectionOnStartOperation = 0x9FC; // UnityEngine.Vector3
+        constexpr uint32_t _nextCastHasForceEvent = 0xA08; // Boolean
+        constexpr uint32_t _lastStateUpdateTime = 0xA0C; // Single
+        constexpr uint32_t _gameSessionEndWasCalled = 0xA10; // Boolean
+        constexpr uint32_t AggressorFound = 0xA11; // Boolean
+        constexpr uint32_t IsYourPlayer = 0xA12; // Boolean
+        constexpr uint32_t MyHandsToBodyAngle = 0xA14; // Single
+        constexpr uint32_t MovementIteration = 0xA18; // SByte
+        constexpr uint32_t HearingDateTime = 0xA20; // System.DateTime
+        constexpr uint32_t VoipState = 0xA28; // System.Byte
+        constexpr uint32_t IgnoreCameraCollider = 0xA29; // Boolean
+        constexpr uint32_t _btrState = 0xA2C; // System.Int32
+        constexpr uint32_t _lastBtrStateInteractionCheck = 0xA30; // System.Int32
+        constexpr uint32_t _lastBtrStateCheck = 0xA34; // System.Byte
+        constexpr uint32_t _lastBtrCastResult = 0xA35; // Boolean
+        constexpr uint32_t _lastTripwireCastResult = 0xA36; // Boolean
+        constexpr uint32_t _lastEventObjectCastResult = 0xA37; // Boolean
+        constexpr uint32_t _processStatus = 0xA38; // System.Int32
+        constexpr uint32_t _lastFaceshieldOperationTime = 0xA3C; // Single
+        constexpr uint32_t _faceshieldNumOperations = 0xA40; // Int32
+    }
+}
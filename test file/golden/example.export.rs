@@ -0,0 +1,414 @@
+#![allow(non_snake_case, non_upper_case_globals, dead_code)]
+
+// [Class] EFT.Player : UnityEngine.MonoBehaviour, IPlayer, \uE7BE, \uE7BD, \uE7BF, \uE7C8, \uE000, IDissonancePlayer
+pub mod EFT_Player {
+    pub const ClampDeltaHeight: u32 = 0x00; // Single
+    pub const GRIP_CULL_DISTANCE: u32 = 0x00; // Int32
+    pub const IK_CULL_DISTANCE: u32 = 0x00; // Int32
+    pub const MAX_IK_CULL_DISTANCE: u32 = 0x00; // Int32
+    pub const COMPASS_RESOURCE_PATH: u32 = 0x00; // String
+    pub const PLANT_TRIPWIRE_TEMPLATE_PATH: u32 = 0x00; // String
+    pub const HAND_ANIMATION_BLEND_THRESHOLD: u32 = 0x00; // Single
+    pub const TIME_BETWEEN_PRONE_SWEEPS: u32 = 0x00; // Single
+    pub const MIN_ALLOWED_MOVEMENT_SPEED: u32 = 0x00; // Single
+    pub const MAX_STEP_SOUND_SPEED_FACTOR: u32 = 0x00; // Single
+    pub const SURFACE_CHECK_RAYCAST_OFFSET: u32 = 0x00; // Single
+    pub const LANDING_VOLUME_MULT: u32 = 0x00; // Single
+    pub const FP_GEAR_VOLUME: u32 = 0x00; // Single
+    pub const LOCAL_AI_GEAR_VOLUME: u32 = 0x00; // Single
+    pub const MIN_COMMON_DAMAGE: u32 = 0x00; // Single
+    pub const FIRST_PERSON_REVERB_FACTOR: u32 = 0x00; // Single
+    pub const DEFAULT_FP_ROLLOFF: u32 = 0x00; // Single
+    pub const EnabledAnimatorsPlayerDefault: u32 = 0x00; // System.Int32
+    pub const FastAnimatorMask: u32 = 0x00; // System.Int32
+    pub const EnabledAnimatorsSpiritDefault: u32 = 0x00; // System.Int32
+    pub const SPRINT_DAMAGE: u32 = 0x00; // Int32
+    pub const JUMP_DAMAGE: u32 = 0x00; // Int32
+    pub const LAYER_NAME_PLAYER: u32 = 0x00; // String
+    pub const OnPlayerDeadStatic: u32 = 0x00; // System.Action<Player, IPlayer, \uF082, Int32>
+    pub const ARTA_MAN_PROFILE_ID: u32 = 0x00; // String
+    pub const ARTA_MAN_NAME: u32 = 0x00; // String
+    pub const MAX_FACESHIELD_OPERATIONS_PER_FRAME: u32 = 0x00; // Int32
+    pub const OffsetOfInstanceIDInCPlusPlusObject: u32 = 0x00; // Int32
+    pub const objectIsNullMessage: u32 = 0x00; // String
+    pub const cloneDestroyedMessage: u32 = 0x00; // String
+    pub const _defaultDeltaTimeDelegate: u32 = 0x08; // -.Player.\uE010
+    pub const HearingDetectionTime: u32 = 0x10; // System.TimeSpan
+    pub const m_CachedPtr: u32 = 0x10; // IntPtr
+    pub const m_CancellationTokenSource: u32 = 0x18; // System.Threading.CancellationTokenSource
+    pub const OnSpeedChangedEvent: u32 = 0x20; // System.Action<Single, Single, Int32>
+    pub const OnSightChangedEvent: u32 = 0x28; // System.Action<SightComponent>
+    pub const OnTacticalInteractionChanged: u32 = 0x30; // System.Action<Boolean>
+    pub const OnSmoothSightChange: u32 = 0x38; // System.Action<SightComponent, Int32>
+    pub const _characterController: u32 = 0x40; // -.ICharacterController
+    pub const _triggerColliderSearcher: u32 = 0x48; // -.TriggerColliderSearcher
+    pub const _currentInteractor: u32 = 0x50; // EFT.Interactive.WorldInteractiveObject
+    pub const MovementContext: u32 = 0x58; // EFT.MovementContext
+    pub const Pedometer: u32 = 0x60; // -.\uE854
+    pub const _mouseSensitivityModifiers: u32 = 0x68; // System.Collections.Generic.Dictionary<Int32, Single>
+    pub const OnDamageReceived: u32 = 0x70; // -.Player.\uE004
+    pub const LeftHandInteractionTarget: u32 = 0x78; // -.GripPose
+    pub const Grounder: u32 = 0x80; // RootMotion.FinalIK.GrounderFBBIK
+    pub const HitReaction: u32 = 0x88; // RootMotion.FinalIK.HitReaction
+    pub const _elbowBends: u32 = 0x90; // UnityEngine.Transform[]
+    pub const HandPosers: u32 = 0x98; // -.HandPoser[]
+    pub const LMarkerRawBlender: u32 = 0xA0; // -.Player.ValueBlender
+    pub const LayerWeight: u32 = 0xA8; // -.Player.ValueBlender
+    pub const ThirdIkWeight: u32 = 0xB0; // -.Player.BetterValueBlender
+    pub const _fbbik: u32 = 0xB8; // RootMotion.FinalIK.FullBodyBipedIK
+    pub const _playerBody: u32 = 0xC0; // EFT.PlayerBody
+    pub const _ribcageChildPositions: u32 = 0xC8; // UnityEngine.Vector3[]
+    pub const _ribcageChildRotations: u32 = 0xD0; // UnityEngine.Quaternion[]
+    pub const _markers: u32 = 0xD8; // UnityEngine.Transform[]
+    pub const _gripReferences: u32 = 0xE0; // UnityEngine.Transform[]
+    pub const _ikTargets: u32 = 0xE8; // UnityEngine.Transform[]
+    pub const _vestMarker: u32 = 0xF0; // UnityEngine.Transform
+    pub const _shoulderEffector: u32 = 0xF8; // UnityEngine.Transform
+    pub const _propBone: u32 = 0x100; // UnityEngine.Transform
+    pub const _twistBones: u32 = 0x108; // -.TwistRelax[]
+    pub const _limbs: u32 = 0x110; // RootMotion.FinalIK.LimbIK[]
+    pub const _beaconDummy: u32 = 0x118; // UnityEngine.GameObject
+    pub const _createBeaconAction: u32 = 0x120; // System.Action
+    pub const _beaconMaterialSetter: u32 = 0x128; // -.PreviewMaterialSetter
+    pub const _beaconPlacer: u32 = 0x130; // EFT.Interactive.BeaconPlacer
+    pub const _thirdWeaponEffects: u32 = 0x138; // -.FirearmsEffects
+    pub const _firstWeaponEffects: u32 = 0x140; // -.FirearmsEffects
+    pub const _compassArrow: u32 = 0x148; // -.CompassArrow
+    pub const _radioTransmitterView: u32 = 0x150; // EFT.ClientItems.ClientSpecItems.RadioTransmitterView
+    pub const _animatorPropTransforms: u32 = 0x158; // UnityEngine.Transform[]
+    pub const _propTransforms: u32 = 0x160; // UnityEngine.Transform[]
+    pub const _preAllocatedRenderersList: u32 = 0x168; // System.Collections.Generic.List<\uE43B>
+    pub const TripwirePlanner: u32 = 0x170; // EFT.TripwireVisualPlacer
+    pub const PointOfViewChanged: u32 = 0x178; // Diz.Binding.BindableEvent
+    pub const AuthorityBlender: u32 = 0x180; // -.Player.ValueBlender
+    pub const GrounderBlender: u32 = 0x188; // -.Player.ValueBlender
+    pub const _handsAnimator: u32 = 0x190; // -.ObjectInHandsAnimator
+    pub const _spawnedKey: u32 = 0x198; // UnityEngine.GameObject
+    pub const _cacheBonesDelegate: u32 = 0x1A0; // System.Action
+    pub const BeingHitAction: u32 = 0x1A8; // System.Action<\uF082, Int32, Single>
+    pub const OnPropVisibility: u32 = 0x1B0; // System.Action<Boolean>
+    pub const OnShowAmmoCountZeroingPanel: u32 = 0x1B8; // System.Action<String>
+    pub const OnShowFireMode: u32 = 0x1C0; // System.Action<Byte>
+    pub const OnShowAmmoDetails: u32 = 0x1C8; // System.Action<Int32, Int32, Int32, String, Boolean>
+    pub const CameraContainer: u32 = 0x1D0; // UnityEngine.GameObject
+    pub const CameraPosition: u32 = 0x1D8; // UnityEngine.Transform
+    pub const ProceduralWeaponAnimation: u32 = 0x1E0; // EFT.Animations.ProceduralWeaponAnimation
+    pub const _garbage: u32 = 0x1E8; // -.Player.\uE005
+    pub const NestedStepSoundSource: u32 = 0x1F0; // -.BetterSource
+    pub const _speechSource: u32 = 0x1F8; // -.BetterSource
+    pub const FractureSound: u32 = 0x200; // UnityEngine.AudioClip
+    pub const PropIn: u32 = 0x208; // -.BaseSoundPlayer.SoundElement
+    pub const PropOut: u32 = 0x210; // -.BaseSoundPlayer.SoundElement
+    pub const FaceshieldOn: u32 = 0x218; // UnityEngine.AudioClip
+    pub const FaceshieldOff: u32 = 0x220; // UnityEngine.AudioClip
+    pub const NightVisionOn: u32 = 0x228; // UnityEngine.AudioClip
+    pub const SwitchHeadlights: u32 = 0x230; // UnityEngine.AudioClip
+    pub const NightVisionOff: u32 = 0x238; // UnityEngine.AudioClip
+    pub const ThermalVisionOn: u32 = 0x240; // UnityEngine.AudioClip
+    pub const ThermalVisionOff: u32 = 0x248; // UnityEngine.AudioClip
+    pub const _tinnitus: u32 = 0x250; // UnityEngine.AudioClip
+    pub const _soundBySurface: u32 = 0x258; // System.Collections.Generic.Dictionary<Int32, SurfaceSet>
+    pub const _currentSet: u32 = 0x260; // EFT.SurfaceSet
+    pub const _gearSoundBank: u32 = 0x268; // EFT.SoundBank
+    pub const _gearMediumSoundBank: u32 = 0x270; // EFT.SoundBank
+    pub const _gearFastSoundBank: u32 = 0x278; // EFT.SoundBank
+    pub const _backpackDropBank: u32 = 0x280; // EFT.SoundBank
+    pub const _playerSounds: u32 = 0x288; // EFT.Sounds
+    pub const _hearingSettings: u32 = 0x290; // EFT.Character.Data.FirstPersonPlayerHearingSettings
+    pub const _idleCoroutine: u32 = 0x298; // UnityEngine.Coroutine
+    pub const _runCoroutine: u32 = 0x2A0; // UnityEngine.Coroutine
+    pub const _sprintCoroutine: u32 = 0x2A8; // UnityEngine.Coroutine
+    pub const _gearDelay: u32 = 0x2B0; // UnityEngine.Coroutine
+    pub const _outOfRangeSpeakingCoroutine: u32 = 0x2B8; // UnityEngine.Coroutine
+    pub const _currentSourceCoroutine: u32 = 0x2C0; // UnityEngine.Coroutine
+    pub const _searchSource: u32 = 0x2C8; // -.BetterSource
+    pub const _lastClip: u32 = 0x2D0; // UnityEngine.AudioClip
+    pub const _soundPropagationVolumes: u32 = 0x2D8; // System.Collections.Generic.List<BetterPropagationVolume>
+    pub const _volumesBuffer: u32 = 0x2E0; // System.Collections.Generic.List<BetterPropagationVolume>
+    pub const _mutuallyExclusive: u32 = 0x2E8; // EFT.Interactive.BetterPropagationVolume
+    pub const _exhaustionAudibilityUnsub: u32 = 0x2F0; // System.Action
+    pub const _vaultAudioController: u32 = 0x2F8; // -.\uEB78
+    pub const _sprintVaultAudioController: u32 = 0x300; // -.\uEB78
+    pub const _climbAudioController: u32 = 0x308; // -.\uEB78
+    pub const _voipAudioSource: u32 = 0x310; // UnityEngine.AudioSource
+    pub const _specificStepAudioController: u32 = 0x318; // -.\uE55A
+    pub const _voipSourceBinding: u32 = 0x320; // System.Action
+    pub const _gearSource: u32 = 0x328; // -.BetterSource
+    pub const _tripwireInteractionSoundController: u32 = 0x330; // -.\uEAED
+    pub const _sourcePrewarmer: u32 = 0x338; // -.\uE418
+    pub const _dropBackPackEvents: u32 = 0x340; // EFT.IDropBackPackEvents
+    pub const _priorityCalculator: u32 = 0x348; // -.\uE553
+    pub const _gearWalkDelaySec: u32 = 0x350; // UnityEngine.WaitForSeconds
+    pub const _cachedMovementRolloff: u32 = 0x358; // System.Collections.Generic.Dictionary<Byte, Single>
+    pub const _playerAudioSettings: u32 = 0x360; // -.\uE509.\uE007
+    pub const _interactionSource: u32 = 0x368; // -.BetterSource
+    pub const _damageThresholdAudioChecker: u32 = 0x370; // -.\uE6B1
+    pub const _soundUnsubscribeOnDestroy: u32 = 0x378; // System.Action
+    pub const POM: u32 = 0x380; // -.PlayerOverlapManager
+    pub const TriggerZones: u32 = 0x388; // System.Collections.Generic.List<String>
+    pub const OnExitTriggerVisited: u32 = 0x390; // Diz.Binding.BindableEvent
+    pub const InteractingWithExfiltrationPoint: u32 = 0x398; // -.\uF1CF<Boolean>
+    pub const GameWorld: u32 = 0x3A0; // EFT.GameWorld
+    pub const _animators: u32 = 0x3A8; // -.IAnimator[]
+    pub const _underbarrelFastAnimator: u32 = 0x3B0; // -.IAnimator
+    pub const Speaker: u32 = 0x3B8; // -.\uE938
+    pub const OnPlayerDead: u32 = 0x3C0; // -.\uE88C
+    pub const OnPlayerDeadOrUnspawn: u32 = 0x3C8; // -.\uE88D
+    pub const Spirit: u32 = 0x3D0; // EFT.PlayerSpirit
+    pub const Logger: u32 = 0x3D8; // -.Player.\uE00E
+    pub const Corpse: u32 = 0x3E0; // EFT.Interactive.Corpse
+    pub const LastAggressor: u32 = 0x3E8; // EFT.IPlayer
+    pub const LastDamageInfo: u32 = 0x3F0; // -.\uF082
+    pub const GetSensitivity: u32 = 0x4D0; // System.Func<Single>
+    pub const GetAimingSensitivity: u32 = 0x4D8; // System.Func<Single>
+    pub const _openAction: u32 = 0x4E0; // System.Action<Action>
+    pub const recodableItemsHandler: u32 = 0x4E8; // EFT.RecodableItemsHandler
+    pub const Fatigue: u32 = 0x4F0; // -.\uED52
+    pub const _renderers: u32 = 0x4F8; // UnityEngine.Renderer[]
+    pub const _camera: u32 = 0x500; // UnityEngine.Camera
+    pub const _selfDamage: u32 = 0x508; // UnityEngine.Coroutine
+    pub const _itemInHands: u32 = 0x510; // -.\uF1CF<Item>
+    pub const CompositeDisposable: u32 = 0x518; // -.\uE400
+    pub const _heavyVestsDeflectRandoms: u32 = 0x520; // -.\uF078
+    pub const _unsubscribeOnEndSession: u32 = 0x528; // System.Action
+    pub const _helmetLightControllers: u32 = 0x530; // System.Collections.Generic.IEnumerable<TacticalComboVisualController>
+    pub const _createdAnimator: u32 = 0x538; // UnityEngine.Animator
+    pub const _createdRuntimeAnimatorController: u32 = 0x540; // UnityEngine.RuntimeAnimatorController
+    pub const _vaultingComponent: u32 = 0x548; // EFT.Vaulting.IVaultingComponent
+    pub const _vaultingComponentDebug: u32 = 0x550; // EFT.Vaulting.IVaultingComponentDebug
+    pub const _vaultingParameters: u32 = 0x558; // EFT.Vaulting.IVaultingParameters
+    pub const _vaultingGameplayRestrictions: u32 = 0x560; // EFT.Vaulting.IVaultingGameplayRestrictions
+    pub const _weaponMountingComponent: u32 = 0x568; // EFT.WeaponMounting.IWeaponMountingComponent
+    pub const OnSenseChanged: u32 = 0x570; // System.Action<Boolean>
+    pub const PossibleInteractionsChanged: u32 = 0x578; // System.Action
+    pub const PhraseSituation: u32 = 0x580; // System.Action<Int32, Int32>
+    pub const OnGlassesChanged: u32 = 0x588; // System.Action<Boolean>
+    pub const OnInventoryOpened: u32 = 0x590; // System.Action<Player, Boolean>
+    pub const OnStartInventoryOpen: u32 = 0x598; // System.Action
+    pub const OnStartQuickdrawPistol: u32 = 0x5A0; // System.Action
+    pub const EventTranslator: u32 = 0x5A8; // -.GenericEventTranslator
+    pub const NightVisionObserver: u32 = 0x5B0; // -.Player.\uE00F<NightVisionComponent>
+    pub const ThermalVisionObserver: u32 = 0x5B8; // -.Player.\uE00F<ThermalVisionComponent>
+    pub const FaceShieldObserver: u32 = 0x5C0; // -.Player.\uE00F<FaceShieldComponent>
+    pub const FaceCoverObserver: u32 = 0x5C8; // -.Player.\uE00F<FaceShieldComponent>
+    pub const Location: u32 = 0x5D0; // String
+    pub const SpawnPoint: u32 = 0x5D8; // EFT.Game.Spawning.ISpawnPoint
+    pub const InteractableObject: u32 = 0x5E0; // EFT.Interactive.InteractableObject
+    pub const InteractablePlayer: u32 = 0x5E8; // EFT.Player
+    pub const PlaceItemZone: u32 = 0x5F0; // EFT.Interactive.PlaceItemTrigger
+    pub const ExfiltrationPoint: u32 = 0x5F8; // EFT.Interactive.ExfiltrationPoint
+    pub const MalfRandoms: u32 = 0x600; // EFT.GameRandoms.MalfunctionRandom
+    pub const Profile: u32 = 0x608; // EFT.Profile
+    pub const StatisticsManager: u32 = 0x610; // EFT.IStatisticsManager
+    pub const Physical: u32 = 0x618; // -.\uE38F
+    pub const OnSpecialPlaceVisited: u32 = 0x620; // System.Action<String, Int32>
+    pub const AIData: u32 = 0x628; // -.IAIData
+    pub const Loyalty: u32 = 0x630; // -.PlayerLoyaltyData
+    pub const OnIPlayerDeadOrUnspawn: u32 = 0x638; // System.Action<IPlayer>
+    pub const MainParts: u32 = 0x640; // System.Collections.Generic.Dictionary<Int32, EnemyPart>
+    pub const _healthController: u32 = 0x648; // EFT.HealthSystem.IHealthController
+    pub const _hitColliders: u32 = 0x650; // -.BodyPartCollider[]
+    pub const _armorPlateColliders: u32 = 0x658; // -.ArmorPlateCollider[]
+    pub const _inventoryController: u32 = 0x660; // -.Player.PlayerInventoryController
+    pub const _handsController: u32 = 0x668; // -.Player.AbstractHandsController
+    pub const _questController: u32 = 0x670; // -.\uF17C
+    pub const _achievementsController: u32 = 0x678; // -.\uF19B
+    pub const _prestigeController: u32 = 0x680; // -.\uEB5B
+    pub const OnHandsControllerChanged: u32 = 0x688; // System.Action<AbstractHandsController, AbstractHandsController>
+    pub const _fullIdInfo: u32 = 0x690; // String
+    pub const Tracking: u32 = 0x698; // UnityEngine.Transform
+    pub const _deltaTimeDelegate: u32 = 0x6A0; // -.Player.\uE010
+    pub const _waitForFixedUpdate: u32 = 0x6A8; // UnityEngine.WaitForFixedUpdate
+    pub const UpdateEvent: u32 = 0x6B0; // System.Action
+    pub const FixedUpdateEvent: u32 = 0x6B8; // System.Action
+    pub const _playerLookRaycastTransform: u32 = 0x6C0; // UnityEngine.Transform
+    pub const PlayerBones: u32 = 0x6C8; // -.PlayerBones
+    pub const _waitInventoryCoroutine: u32 = 0x6D0; // UnityEngine.Coroutine
+    pub const _preAllocatedArmorComponents: u32 = 0x6D8; // System.Collections.Generic.List<ArmorComponent>
+    pub const _preAllocatedBackpackPenaltyComponent: u32 = 0x6E0; // EFT.InventoryLogic.EquipmentPenaltyComponent
+    pub const OnEpInteraction: u32 = 0x6E8; // System.Action<ExfiltrationPoint, Boolean>
+    pub const BotsGroup: u32 = 0x6F0; // -.BotsGroup
+    pub const ExfilUnsubscribe: u32 = 0x6F8; // System.Action
+    pub const SessionEndUnsubscribe: u32 = 0x700; // System.Collections.Generic.List<Action>
+    pub const FoundSecretExits: u32 = 0x708; // System.Collections.Generic.List<SecretExfiltrationPoint>
+    pub const VoipController: u32 = 0x710; // EFT.IPlayerVoipController
+    pub const DissonanceComms: u32 = 0x718; // Dissonance.DissonanceComms
+    pub const _customHandRotator: u32 = 0x720; // -.\uE88F
+    pub const BtrInteractionSide: u32 = 0x728; // EFT.Vehicle.BTRSide
+    pub const TripwireInteractionTrigger: u32 = 0x730; // EFT.SynchronizableObjects.TripwireInteractionTrigger
+    pub const EventObjectInteractive: u32 = 0x738; // EFT.Interactive.EventObjectInteractive
+    pub const OnBtrStateChanged: u32 = 0x740; // System.Action<Int32>
+    pub const ScheduledProcess: u32 = 0x748; // -.Player.AbstractProcess
+    pub const ActiveSlot: u32 = 0x750; // EFT.InventoryLogic.Slot
+    pub const HandsChangingEvent: u32 = 0x758; // System.Action
+    pub const HandsChangedEvent: u32 = 0x760; // System.Action<\uE845>
+    pub const _lastEquippedWeaponOrKnifeItem: u32 = 0x768; // EFT.InventoryLogic.Item
+    pub const _slotPriority: u32 = 0x770; // System.Int32[]
+    pub const _removeFromHandsCallback: u32 = 0x778; // Comfort.Common.Callback
+    pub const _setInHandsCallback: u32 = 0x780; // Comfort.Common.Callback
+    pub const _doorKick: u32 = 0x788; // Boolean
+    pub const _horizontal: u32 = 0x78C; // Single
+    pub const _vertical: u32 = 0x790; // Single
+    pub const _resetLook: u32 = 0x794; // Boolean
+    pub const _mouseLookControl: u32 = 0x795; // Boolean
+    pub const _isResettingLook: u32 = 0x796; // Boolean
+    pub const _setResetedLookNextFrame: u32 = 0x797; // Boolean
+    pub const _isLooking: u32 = 0x798; // Boolean
+    pub const HeadRotation: u32 = 0x79C; // UnityEngine.Vector3
+    pub const _mouseSensitivityModifier: u32 = 0x7A8; // Single
+    pub const _rotationPitchLimit: u32 = 0x7AC; // UnityEngine.Vector2
+    pub const _targetRotationPitch: u32 = 0x7B4; // UnityEngine.Vector2
+    pub const InputDirection: u32 = 0x7BC; // UnityEngine.Vector2
+    pub const TrunkRotationLimit: u32 = 0x7C4; // Single
+    pub const PoseMemo: u32 = 0x7C8; // Single
+    pub const _speedMemo: u32 = 0x7CC; // Single
+    pub const _lastSlowLean: u32 = 0x7D0; // Boolean
+    pub const CurrentLeanType: u32 = 0x7D4; // System.Int32
+    pub const _lastMovement: u32 = 0x7D8; // Single
+    pub const _cachedMouseLookControl: u32 = 0x7DC; // Boolean
+    pub const _isVaultingPressed: u32 = 0x7DD; // Boolean
+    pub const _vaultingTiming: u32 = 0x7E0; // Single
+    pub const _prevHeight: u32 = 0x7E4; // Single
+    pub const HeightSmoothTime: u32 = 0x7E8; // Single
+    pub const _dampVelocity: u32 = 0x7EC; // Single
+    pub const _currentSmoothSpeed: u32 = 0x7F0; // Single
+    pub const _previousY: u32 = 0x7F4; // Single
+    pub const RibcageScaleCurrent: u32 = 0x7F8; // Single
+    pub const RibcageScaleCurrentTarget: u32 = 0x7FC; // Single
+    pub const UtilityLayerRange: u32 = 0x800; // UnityEngine.Vector2
+    pub const UtilityLayerLerpSpeed: u32 = 0x808; // Single
+    pub const GripAutoAdjust: u32 = 0x80C; // Boolean
+    pub const CustomAnimationsAreProcessing: u32 = 0x80D; // Boolean
+    pub const ThirdPersonWeaponRootAuthority: u32 = 0x810; // Single
+    pub const _ribcageScaleCompensated: u32 = 0x814; // Single
+    pub const _shoulderVel: u32 = 0x818; // Single
+    pub const _fbbikCooldown: u32 = 0x81C; // Single
+    pub const _turnOffFbbikAt: u32 = 0x820; // Single
+    pub const _firstPersonRightHand: u32 = 0x824; // Single
+    pub const _firstPersonLeftHand: u32 = 0x828; // Single
+    pub const _utilityLayerWeight: u32 = 0x82C; // Single
+    pub const _smoothLW: u32 = 0x830; // Single
+    pub const _rawWeight: u32 = 0x834; // Single
+    pub const _rawDampVelocity: u32 = 0x838; // Single
+    pub const _interactionLayerWeight: u32 = 0x83C; // Single
+    pub const _stored: u32 = 0x840; // Boolean
+    pub const _pointOfViewUndecided: u32 = 0x841; // Boolean
+    pub const _hasAnimatorPropBones: u32 = 0x842; // Boolean
+    pub const _hasProp: u32 = 0x843; // Boolean
+    pub const _propActive: u32 = 0x844; // Boolean
+    pub const _compassInstantiated: u32 = 0x845; // Boolean
+    pub const _radioTransmitterInstantiated: u32 = 0x846; // Boolean
+    pub const _ikPosition: u32 = 0x848; // UnityEngine.Vector3
+    pub const _lMarkerRawPosition: u32 = 0x854; // UnityEngine.Vector3
+    pub const _lElbowRawPosition: u32 = 0x860; // UnityEngine.Vector3
+    pub const _rElbowRawPosition: u32 = 0x86C; // UnityEngine.Vector3
+    pub const _propRawPosition: u32 = 0x878; // UnityEngine.Vector3
+    pub const _lMarkerRawRotation: u32 = 0x884; // UnityEngine.Quaternion
+    pub const _propRawRotation: u32 = 0x894; // UnityEngine.Quaternion
+    pub const _ikRotation: u32 = 0x8A4; // UnityEngine.Quaternion
+    pub const HasGamePlayerOwner: u32 = 0x8B4; // Boolean
+    pub const UsedSimplifiedSkeleton: u32 = 0x8B5; // Boolean
+    pub const _ergonomicsPenalty: u32 = 0x8B8; // Single
+    pub const _shotTime: u32 = 0x8BC; // Single
+    pub const _isDeadAlready: u32 = 0x8C0; // Boolean
+    pub const _isGrenadeOrKnife: u32 = 0x8C1; // Boolean
+    pub const BeaconPosition: u32 = 0x8C4; // UnityEngine.Vector3
+    pub const BeaconRotation: u32 = 0x8D0; // UnityEngine.Quaternion
+    pub const AllowToPlantBeacon: u32 = 0x8E0; // Boolean
+    pub const IsHeadLightsAnimationActive: u32 = 0x8E1; // Boolean
+    pub const _isInteractionPlayeingLastFrame: u32 = 0x8E2; // Boolean
+    pub const _currentHandsRotation: u32 = 0x8E4; // UnityEngine.Quaternion
+    pub const CurrentSurface: u32 = 0x8F4; // System.Int32
+    pub const _stepLayerMask: u32 = 0x8F8; // UnityEngine.LayerMask
+    pub const CHECK_RANGE_BUFF: u32 = 0x8FC; // Single
+    pub const MIN_FALL_DAMAGE: u32 = 0x900; // Single
+    pub const Environment: u32 = 0x904; // System.Int32
+    pub const HeavyBreath: u32 = 0x908; // Boolean
+    pub const Muffled: u32 = 0x909; // Boolean
+    pub const OcclusionDirty: u32 = 0x90A; // Boolean
+    pub const DistanceDirty: u32 = 0x90B; // Boolean
+    pub const PreviousFaceShield: u32 = 0x90C; // Boolean
+    pub const PreviousNightVision: u32 = 0x90D; // Boolean
+    pub const PreviousThermalVision: u32 = 0x90E; // Boolean
+    pub const SpeechLocalPosition: u32 = 0x910; // UnityEngine.Vector3
+    pub const _speechLocalPosition: u32 = 0x91C; // UnityEngine.Vector3
+    pub const _playedAtLeastOneStep: u32 = 0x928; // Boolean
+    pub const _nextJumpAfter: u32 = 0x92C; // Single
+    pub const _searchCount: u32 = 0x930; // Single
+    pub const _exhaustionIsAudible: u32 = 0x934; // Boolean
+    pub const _sprintSurfaceCheck: u32 = 0x938; // Single
+    pub const _runSurfaceCheck: u32 = 0x93C; // Single
+    pub const _landSurfaceCheck: u32 = 0x940; // Single
+    pub const _proneSurfaceCheck: u32 = 0x944; // Single
+    pub const _sign: u32 = 0x948; // Single
+    pub const _lastStepTime: u32 = 0x94C; // Single
+    pub const _lastTimeTurnSound: u32 = 0x950; // Single
+    pub const maxLengthTurnSound: u32 = 0x954; // Single
+    pub const _nextSurfaceCheck: u32 = 0x958; // Single
+    pub const _distance: u32 = 0x95C; // Single
+    pub const _enqueuedForRelease: u32 = 0x960; // Boolean
+    pub const _maxAllowedMovementSpeed: u32 = 0x964; // Single
+    pub const _animatorFootstepCurveHash: u32 = 0x968; // Int32
+    pub const _useSimpleUnderRoofCheck: u32 = 0x96C; // Boolean
+    pub const LastDamageType: u32 = 0x970; // System.Int32
+    pub const LastDamagedBodyPart: u32 = 0x974; // System.Int32
+    pub const Destroyed: u32 = 0x978; // Boolean
+    pub const QuickdrawWeaponFast: u32 = 0x979; // Boolean
+    pub const FastSlotSelection: u32 = 0x97A; // Boolean
+    pub const PreviousWeaponAimState: u32 = 0x97B; // Boolean
+    pub const QuickdrawTime: u32 = 0x97C; // Single
+    pub const IsInBufferZone: u32 = 0x980; // Boolean
+    pub const CanManipulateWithHandsInBufferZone: u32 = 0x981; // Boolean
+    pub const EnabledAnimators: u32 = 0x984; // System.Int32
+    pub const LastBodyPart: u32 = 0x988; // System.Int32
+    pub const _corpseAppliedForce: u32 = 0x98C; // Single
+    pub const _countdownToSprintDamage: u32 = 0x990; // Single
+    pub const _lastHitTime: u32 = 0x994; // Single
+    pub const _lastHitDebuffFrame: u32 = 0x998; // Int32
+    pub const _accumulatedDebuffDamage: u32 = 0x99C; // Single
+    pub const _negativeBuffsCount: u32 = 0x9A0; // Int32
+    pub const _sense: u32 = 0x9A4; // Boolean
+    pub const _isInventoryOpened: u32 = 0x9A5; // Boolean
+    pub const _displaySense: u32 = 0x9A6; // Boolean
+    pub const RayLength: u32 = 0x9A8; // Single
+    pub const InteractableObjectIsProxy: u32 = 0x9AC; // Boolean
+    pub const IsAgressorInLighthouseTraderZone: u32 = 0x9AD; // Boolean
+    pub const ExitTriggerZone: u32 = 0x9AE; // Boolean
+    pub const PlayerId: u32 = 0x9B0; // Int32
+    pub const _updateQueue: u32 = 0x9B4; // System.Int32
+    pub const _armsUpdateQueue: u32 = 0x9B8; // System.Int32
+    pub const VisibleToCameraType: u32 = 0x9BC; // System.Int32
+    pub const IsVisibleToCamera: u32 = 0x9C0; // Boolean
+    pub const _armsUpdateMode: u32 = 0x9C4; // System.Int32
+    pub const _bodyUpdateMode: u32 = 0x9C8; // System.Int32
+    pub const _awareness: u32 = 0x9CC; // Single
+    pub const _armsupdated: u32 = 0x9D0; // Boolean
+    pub const _armsTime: u32 = 0x9D4; // Single
+    pub const _bodyupdated: u32 = 0x9D8; // Boolean
+    pub const _bodyTime: u32 = 0x9DC; // Single
+    pub const _nFixedFrames: u32 = 0x9E0; // Int32
+    pub const _fixedTime: u32 = 0x9E4; // Single
+    pub const LastDeltaTime: u32 = 0x9E8; // Single
+    pub const _lastInteractionState: u32 = 0x9EC; // System.Byte
+    pub const InteractionRayOriginOnStartOperation: u32 = 0x9F0; // UnityEngine.Vector3
+    pub const InteractionRayDirectionOnStartOperation: u32 = 0x9FC; // UnityEngine.Vector3
+    pub const _nextCastHasForceEvent: u32 = 0xA08; // Boolean
+    pub const _lastStateUpdateTime: u32 = 0xA0C; // Single
+    pub const _gameSessionEndWasCalled: u32 = 0xA10; // Boolean
+    pub const AggressorFound: u32 = 0xA11; // Boolean
+    pub const IsYourPlayer: u32 = 0xA12; // Boolean
+    pub const MyHandsToBodyAngle: u32 = 0xA14; // Single
+    pub const MovementIteration: u32 = 0xA18; // SByte
+    pub const HearingDateTime: u32 = 0xA20; // System.DateTime
+    pub const VoipState: u32 = 0xA28; // System.Byte
+    pub const IgnoreCameraCollider: u32 = 0xA29; // Boolean
+    pub const _btrState: u32 = 0xA2C; // System.Int32
+    pub const _lastBtrStateInteractionCheck: u32 = 0xA30; // System.Int32
+    pub const _lastBtrStateCheck: u32 = 0xA34; // System.Byte
+    pub const _lastBtrCastResult: u32 = 0xA35; // Boolean
+    pub const _lastTripwireCastResult: u32 = 0xA36; // Boolean
+    pub const _lastEventObjectCastResult: u32 = 0xA37; // Boolean
+    pub const _processStatus: u32 = 0xA38; // System.Int32
+    pub const _lastFaceshieldOperationTime: u32 = 0xA3C; // Single
+    pub const _faceshieldNumOperations: u32 = 0xA40; // Int32
+}